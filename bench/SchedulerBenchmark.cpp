@@ -0,0 +1,805 @@
+/**
+ * SchedulerBenchmark.cpp - Scheduling Kernel Benchmark Suite
+ *
+ * Standalone benchmark program for the scheduling core. It measures:
+ * - Kernels: push/pop cost of every ready queue container and of the CFS and
+ *   MLFQ run queues, at a steady queue length, and the cost per row of the
+ *   vectorised metric reduction
+ * - Simulations: end-to-end runs of every Scheduler subclass over synthetic
+ *   workloads from WorkloadGenerator (batch or Poisson arrivals at a given
+ *   load, uniform, exponential, heavy-tailed or bimodal bursts), reporting
+ *   simulated events per second, cost per dispatch and cost per admitted
+ *   arrival; EDF and Rate Monotonic run the same workloads as harmonic
+ *   periodic task sets, so they meet real periods and deadlines
+ * - Live submission: producer threads submit a workload through a
+ *   LiveArrivalSource while an FCFS simulation consumes it, reporting
+ *   submissions per second and the end-to-end cost per submission
+ * Results are written as JSON, one record per line, and can be compared with a
+ * previous result file to flag regressions.
+ *
+ * Build (from the repository root):
+ *   g++ -std=c++17 -O2 -pthread -I include src/[A-Z]*.cpp bench/SchedulerBenchmark.cpp -o scheduler_benchmark
+ *
+ */
+
+#include <algorithm>    // For sort and min
+#include <chrono>       // For wall-clock timing
+#include <climits>      // For INT_MAX
+#include <cstdlib>      // For strtod
+#include <cstring>      // For strlen
+#include <fstream>      // For result files
+#include <functional>   // For kernel requeue hooks
+#include <iostream>     // For input/output operations
+#include <map>          // For baseline lookup
+#include <memory>       // For smart pointers
+#include <random>       // For kernel slice lengths
+#include <sstream>      // For list parsing
+#include <string>       // For string operations
+#include <thread>       // For hardware_concurrency
+#include <vector>       // For dynamic arrays
+
+#include "CFSScheduler.h"
+#include "EDFScheduler.h"
+#include "FCFSScheduler.h"
+#include "LiveArrivalSource.h"
+#include "MLFQScheduler.h"
+#include "PriorityScheduler.h"
+#include "ProcessTable.h"
+#include "RateMonotonicScheduler.h"
+#include "ReadyQueue.h"
+#include "RoundRobinScheduler.h"
+#include "SJFScheduler.h"
+#include "VectorKernels.h"
+#include "WorkloadGenerator.h"
+
+using namespace std;
+using BenchClock = chrono::steady_clock;
+
+// ========================================================================================
+// CONFIGURATION
+// ========================================================================================
+
+namespace {
+
+/**
+ * Benchmark Options
+ */
+struct BenchmarkOptions {
+    vector<size_t> sizes = {1000, 10000, 100000, 1000000};     // Processes per workload
+    vector<string> algorithms = {"fcfs", "sjf", "srtf", "rr", "priority", "ppriority", "mlfq", "cfs",
+                                  "edf", "rm"};
+    vector<double> loads = {0.0, 0.5, 0.95};                    // Offered load (0 = batch arrival)
+    vector<BurstDistribution> bursts = {BurstDistribution::EXPONENTIAL, BurstDistribution::PARETO};
+    int meanBurst = 10;                     // Mean CPU burst
+    int quantum = 3;                        // Round Robin / MLFQ level 0 quantum
+    int cpus = 1;                           // Simulated CPUs
+    int repeat = 3;                         // Least timed runs per configuration
+    double minTime = 100.0;                 // Least total timed milliseconds per configuration
+    uint64_t seed = 42;                     // Workload generator seed
+    bool kernels = true;                    // Run the kernel benchmarks
+    bool simulations = true;                // Run the simulation benchmarks
+    bool live = true;                       // Run the live submission benchmarks
+    vector<int> producers = {1, 4};         // Producer threads of the live benchmarks
+    string outputPath;                      // JSON destination (empty = stdout)
+    string baselinePath;                    // Earlier result file to compare with
+    double tolerance = 10.0;                // Allowed slowdown in percent
+};
+
+// ========================================================================================
+// SYNTHETIC WORKLOADS
+// ========================================================================================
+
+/**
+ * Generate Workload
+ * Poisson arrivals whose rate keeps the CPUs busy the given fraction of the
+ * time, or every process at time 0 when the load is 0
+ *
+ * @param count - Number of processes
+ * @param load - Offered load per CPU (0 = batch arrival)
+ * @param distribution - Burst distribution
+ * @param options - Mean burst, CPU count and seed
+ * @return Generated workload
+ */
+shared_ptr<Workload> generateWorkload(size_t count, double load, BurstDistribution distribution,
+                                      const BenchmarkOptions& options) {
+    WorkloadGeneratorOptions shape;
+    shape.seed = options.seed;
+    shape.count = count;
+    shape.arrivals = load > 0.0 ? ArrivalPattern::POISSON : ArrivalPattern::BATCH;
+    shape.arrivalRate = load > 0.0 ? load * options.cpus / options.meanBurst : shape.arrivalRate;
+    shape.bursts = distribution;
+    shape.meanBurst = options.meanBurst;
+    return WorkloadGenerator::generate(shape);
+}
+
+/**
+ * Periodic Task Set
+ * Generated workload whose processes are periodic tasks, with the release
+ * horizon it is simulated to and the number of jobs released before it
+ */
+struct PeriodicTaskSet {
+    shared_ptr<Workload> workload;      // Tasks, first released at their arrival time
+    SimTime horizon = 0;                // Jobs are released before this time
+    long long jobs = 0;                 // Jobs released over the whole run
+};
+
+/**
+ * Generate Periodic Task Set
+ * The workload of generateWorkload() with harmonic periods T, 2T, 4T and 8T
+ * dealt out in turn and implicit deadlines (deadline = period). T is chosen so
+ * the tasks use the CPUs the offered fraction of the time once all have
+ * arrived (a batch task set fills them), and the releases run for one
+ * hyperperiod after the last first release
+ *
+ * @param count - Number of tasks
+ * @param load - Offered load per CPU (0 = batch arrival)
+ * @param distribution - Burst distribution
+ * @param options - Mean burst, CPU count and seed
+ * @return Task set with its horizon and job count
+ */
+PeriodicTaskSet generatePeriodicTaskSet(size_t count, double load, BurstDistribution distribution,
+                                        const BenchmarkOptions& options) {
+    static const int PERIOD_MULTIPLIERS[] = {1, 2, 4, 8};
+
+    PeriodicTaskSet taskSet;
+    taskSet.workload = generateWorkload(count, load, distribution, options);
+    Workload& workload = *taskSet.workload;
+
+    // Mean utilisation per task is meanBurst * (1 + 1/2 + 1/4 + 1/8) / 4 / T
+    double utilisation = (load > 0.0 ? load : 1.0) * options.cpus;
+    double basePeriod = static_cast<double>(count) * options.meanBurst * 15.0 / 32.0 / utilisation;
+    int period = static_cast<int>(min(max(basePeriod, 1.0), static_cast<double>(INT_MAX / 8)));
+
+    SimTime latestRelease = 0;
+    for (ProcessHandle handle = 0; handle < workload.size(); ++handle) {
+        workload.setTiming(handle, period * PERIOD_MULTIPLIERS[handle % 4], 0);
+        latestRelease = max(latestRelease, workload.arrivalTime[handle]);
+    }
+    taskSet.horizon = latestRelease + static_cast<SimTime>(period) * 8;
+    for (ProcessHandle handle = 0; handle < workload.size(); ++handle) {
+        SimTime taskPeriod = workload.periodOf(handle);
+        taskSet.jobs += (taskSet.horizon - workload.arrivalTime[handle] + taskPeriod - 1) / taskPeriod;
+    }
+    return taskSet;
+}
+
+unique_ptr<Scheduler> createScheduler(const string& algorithm, const BenchmarkOptions& options) {
+    if (algorithm == "fcfs") return make_unique<FCFSScheduler>();
+    if (algorithm == "sjf") return make_unique<SJFScheduler>();
+    if (algorithm == "srtf") return make_unique<SJFScheduler>(true);
+    if (algorithm == "rr") return make_unique<RoundRobinScheduler>(options.quantum);
+    if (algorithm == "priority") return make_unique<PriorityScheduler>();
+    if (algorithm == "ppriority") return make_unique<PriorityScheduler>(true);
+    if (algorithm == "mlfq") return make_unique<MLFQScheduler>(3, options.quantum);
+    if (algorithm == "cfs") return make_unique<CFSScheduler>();
+    if (algorithm == "edf") return make_unique<EDFScheduler>();
+    if (algorithm == "rm") return make_unique<RateMonotonicScheduler>();
+    return nullptr;
+}
+
+// ========================================================================================
+// RESULT RECORDS
+// ========================================================================================
+
+/**
+ * Result Record
+ * One line of the JSON output: an id, the metric compared against baselines
+ * (lower is better) and the remaining fields, already formatted
+ */
+struct ResultRecord {
+    string id;                              // Unique configuration key
+    string metric;                          // Name of the compared field
+    double value = 0.0;                     // Value of the compared field
+    string fields;                          // Every field, JSON-formatted
+};
+
+double median(vector<double> values) {
+    sort(values.begin(), values.end());
+    return values.empty() ? 0.0 : values[values.size() / 2];
+}
+
+string formatNumber(double value) {
+    ostringstream text;
+    text.precision(6);
+    text << value;
+    return text.str();
+}
+
+// ========================================================================================
+// KERNEL BENCHMARKS
+// ========================================================================================
+
+/**
+ * Kernel Queue
+ * A run queue under test and the per-dispatch state change that precedes
+ * putting a process back (time used, level change, ...)
+ */
+struct KernelQueue {
+    string name;
+    unique_ptr<ReadyQueue> queue;
+    function<void(ProcessHandle, int)> requeue;     // Called with the slice the process ran
+};
+
+/**
+ * Time Kernel
+ * Fills the queue, then repeatedly dispatches the top process and puts it
+ * back after a short slice, so the queue stays at its full length
+ *
+ * @return Nanoseconds per pop + push pair
+ */
+double timeKernel(KernelQueue& kernel, ProcessTable& table, size_t size, mt19937_64& rng) {
+    ReadyQueue& queue = *kernel.queue;
+    queue.clear();
+    for (ProcessHandle handle = 0; handle < size; ++handle) {
+        queue.push(handle);
+    }
+
+    const size_t operations = max<size_t>(size, 1000000);
+    auto start = BenchClock::now();
+    for (size_t i = 0; i < operations; ++i) {
+        ProcessHandle handle = queue.pop();
+        int slice = 1 + static_cast<int>(rng() & 7);
+        if (table.remainingTime[handle] > slice) {
+            table.remainingTime[handle] -= slice;
+        } else {
+            table.remainingTime[handle] = table.burstTime(handle);
+        }
+        if (kernel.requeue) kernel.requeue(handle, slice);
+        queue.push(handle);
+    }
+    auto elapsed = chrono::duration<double, nano>(BenchClock::now() - start).count();
+    queue.clear();
+    return elapsed / static_cast<double>(operations);
+}
+
+/**
+ * Time Metric Sums
+ * Repeatedly reduces the metric columns of a completed table
+ *
+ * @return Nanoseconds per row
+ */
+double timeMetricSums(const ProcessTable& table, const vector<SimTime>& arrival) {
+    const size_t rows = table.size();
+    const size_t passes = max<size_t>(1, 4000000 / max<size_t>(rows, 1));
+    int64_t checksum = 0;
+    auto start = BenchClock::now();
+    for (size_t i = 0; i < passes; ++i) {
+        ProcessMetricTotals totals = sumProcessMetrics(arrival.data(), table.startTime.data(),
+                                                       table.completionTime.data(), table.waitingTime.data(), rows);
+        checksum += totals.waiting + totals.turnaround + totals.response;
+    }
+    auto elapsed = chrono::duration<double, nano>(BenchClock::now() - start).count();
+    volatile int64_t sink = checksum;   // Keeps the reductions from being optimised away
+    (void)sink;
+    return elapsed / static_cast<double>(passes * max<size_t>(rows, 1));
+}
+
+/**
+ * Record Kernel
+ * Appends the best of the samples as a kernel result
+ */
+void recordKernel(const string& name, size_t size, const vector<double>& samples, vector<ResultRecord>& records) {
+    double best = *min_element(samples.begin(), samples.end());
+
+    ResultRecord record;
+    record.id = "kernel/" + name + "/n=" + to_string(size);
+    record.metric = "ns_per_op";
+    record.value = best;
+    record.fields = "\"kind\":\"kernel\",\"queue\":\"" + name + "\",\"size\":" + to_string(size) +
+                    ",\"ns_per_op\":" + formatNumber(best) +
+                    ",\"ns_per_op_median\":" + formatNumber(median(samples));
+    records.push_back(record);
+    cerr << "  " << record.id << ": " << formatNumber(best) << " ns/op" << endl;
+}
+
+/// Largest ready set timed with the linear-scan queue
+const size_t LINEAR_SCAN_LIMIT = 4096;
+
+void runKernelBenchmarks(const BenchmarkOptions& options, vector<ResultRecord>& records) {
+    const ReadyQueueOrder orders[] = {ReadyQueueOrder::BURST_TIME, ReadyQueueOrder::PRIORITY,
+                                      ReadyQueueOrder::REMAINING_TIME};
+    const char* orderNames[] = {"burst", "priority", "remaining"};
+
+    for (size_t size : options.sizes) {
+        auto workload = generateWorkload(size, 0.0, BurstDistribution::EXPONENTIAL, options);
+        ProcessTable table;
+        table.bind(workload);
+        mt19937_64 rng(options.seed);
+
+        vector<KernelQueue> kernels;
+        kernels.push_back({"fifo", createReadyQueue(ReadyQueueKind::FIFO, ReadyQueueOrder::FIFO, table), nullptr});
+        for (int i = 0; i < 3; ++i) {
+            kernels.push_back({string("binary-heap/") + orderNames[i],
+                               createReadyQueue(ReadyQueueKind::BINARY_HEAP, orders[i], table), nullptr});
+            kernels.push_back({string("pairing-heap/") + orderNames[i],
+                               createReadyQueue(ReadyQueueKind::PAIRING_HEAP, orders[i], table), nullptr});
+            // Every pop scans the whole set, so only small ready sets are timed
+            if (size <= LINEAR_SCAN_LIMIT) {
+                kernels.push_back({string("linear-scan/") + orderNames[i],
+                                   createReadyQueue(ReadyQueueKind::LINEAR_SCAN, orders[i], table), nullptr});
+            }
+        }
+
+        // CFS: charge the slice to the vruntime on the way back in
+        static const int weights[3] = {3121, CFSScheduler::NICE_0_WEIGHT, 335};
+        vector<CfsEntity> entities(size);
+        kernels.push_back({"cfs-rbtree", make_unique<CfsRunQueue>(entities, table, weights),
+                           [&entities, &table](ProcessHandle handle, int slice) {
+                               entities[handle].runStartRemaining = table.remainingTime[handle] + slice;
+                           }});
+
+        // MLFQ: one process in eight drops a level
+        FeedbackLevels levels;
+        kernels.push_back({"mlfq-levels", make_unique<MultilevelReadyQueue>(3, levels, table),
+                           [&levels, &table](ProcessHandle handle, int slice) {
+                               if (slice == 8) {
+                                   levels.set(handle, min(levels.get(handle) + 1, 2), table.remainingTime[handle]);
+                               }
+                           }});
+
+        for (KernelQueue& kernel : kernels) {
+            vector<double> samples;
+            for (int run = 0; run < options.repeat; ++run) {
+                table.reset();
+                samples.push_back(timeKernel(kernel, table, size, rng));
+            }
+            recordKernel(kernel.name, size, samples, records);
+        }
+
+        // Metric reduction over the columns of a finished run
+        table.reset();
+        vector<SimTime> arrival(size);
+        for (ProcessHandle handle = 0; handle < size; ++handle) {
+            arrival[handle] = table.arrivalTime(handle);
+            table.startTime[handle] = arrival[handle] + static_cast<SimTime>(rng() & 63);
+            table.completionTime[handle] = table.startTime[handle] + table.burstTime(handle);
+            table.waitingTime[handle] = table.startTime[handle] - arrival[handle];
+        }
+        vector<double> samples;
+        for (int run = 0; run < options.repeat; ++run) {
+            samples.push_back(timeMetricSums(table, arrival));
+        }
+        recordKernel(string("metric-sums/") + getVectorInstructionSet(), size, samples, records);
+    }
+}
+
+// ========================================================================================
+// SIMULATION BENCHMARKS
+// ========================================================================================
+
+void runSimulationBenchmarks(const BenchmarkOptions& options, vector<ResultRecord>& records) {
+    for (size_t size : options.sizes) {
+        for (double load : options.loads) {
+            for (BurstDistribution distribution : options.bursts) {
+                auto workload = generateWorkload(size, load, distribution, options);
+                string arrivals = load > 0.0 ? "poisson-" + formatNumber(load) : "batch";
+
+                // The real-time policies get the same processes as periodic tasks
+                PeriodicTaskSet taskSet;
+                for (const string& algorithm : options.algorithms) {
+                    if ((algorithm == "edf" || algorithm == "rm") && !taskSet.workload) {
+                        taskSet = generatePeriodicTaskSet(size, load, distribution, options);
+                    }
+                }
+
+                for (const string& algorithm : options.algorithms) {
+                    bool periodic = algorithm == "edf" || algorithm == "rm";
+                    auto scheduler = createScheduler(algorithm, options);
+                    scheduler->setVerbosity(Verbosity::QUIET);
+                    scheduler->setCpuCount(options.cpus);
+                    if (options.cpus > 1) {
+                        scheduler->setLoadBalancing(LoadBalancing::WORK_STEALING);
+                    }
+                    scheduler->setWorkload(periodic ? taskSet.workload : workload);
+                    if (periodic) {
+                        scheduler->setReleaseHorizon(taskSet.horizon);
+                    }
+                    long long jobs = periodic ? taskSet.jobs : static_cast<long long>(size);
+
+                    // The first run sorts the arrivals and sizes the queues; the
+                    // timed runs then rewind the scheduler in place
+                    scheduler->schedule();
+                    vector<double> samples;
+                    double total = 0.0;
+                    while (static_cast<int>(samples.size()) < options.repeat || total < options.minTime) {
+                        auto start = BenchClock::now();
+                        scheduler->schedule();
+                        samples.push_back(chrono::duration<double, milli>(BenchClock::now() - start).count());
+                        total += samples.back();
+                    }
+                    double best = *min_element(samples.begin(), samples.end());
+                    double seconds = best / 1000.0;
+                    long long events = scheduler->getEventCount();
+                    long long dispatches = scheduler->getContextSwitchCount();
+
+                    ResultRecord record;
+                    record.id = "simulation/" + algorithm + "/n=" + to_string(size) + "/" + arrivals + "/" +
+                                burstDistributionToString(distribution) + "/c=" + to_string(options.cpus);
+                    record.metric = "ns_per_event";
+                    record.value = events > 0 ? best * 1e6 / events : 0.0;
+                    record.fields =
+                        "\"kind\":\"simulation\",\"algorithm\":\"" + algorithm + "\",\"processes\":" + to_string(size) +
+                        ",\"arrivals\":\"" + arrivals + "\",\"load\":" + formatNumber(load) +
+                        ",\"burst\":\"" + burstDistributionToString(distribution) +
+                        "\",\"cpus\":" + to_string(options.cpus) + ",\"jobs\":" + to_string(jobs) +
+                        ",\"events\":" + to_string(events) + ",\"dispatches\":" + to_string(dispatches) +
+                        ",\"makespan\":" + to_string(scheduler->getTotalExecutionTime()) +
+                        ",\"runs\":" + to_string(samples.size()) +
+                        ",\"wall_ms\":" + formatNumber(best) + ",\"wall_ms_median\":" + formatNumber(median(samples)) +
+                        ",\"events_per_sec\":" + formatNumber(seconds > 0 ? events / seconds : 0.0) +
+                        ",\"ns_per_event\":" + formatNumber(record.value) +
+                        ",\"ns_per_dispatch\":" + formatNumber(dispatches > 0 ? best * 1e6 / dispatches : 0.0) +
+                        ",\"ns_per_arrival\":" + formatNumber(best * 1e6 / static_cast<double>(jobs));
+                    records.push_back(record);
+                    cerr << "  " << record.id << ": " << formatNumber(best) << " ms, "
+                         << formatNumber(seconds > 0 ? events / seconds / 1e6 : 0.0) << " M events/s" << endl;
+                }
+            }
+        }
+    }
+}
+
+// ========================================================================================
+// LIVE SUBMISSION BENCHMARKS
+// ========================================================================================
+
+void runLiveBenchmarks(const BenchmarkOptions& options, vector<ResultRecord>& records) {
+    for (size_t size : options.sizes) {
+        auto workload = generateWorkload(size, 0.95, BurstDistribution::EXPONENTIAL, options);
+
+        for (int producerCount : options.producers) {
+            auto scheduler = createScheduler("fcfs", options);
+            scheduler->setVerbosity(Verbosity::QUIET);
+            scheduler->setCpuCount(options.cpus);
+
+            vector<double> samples;
+            vector<double> submitSamples;
+            double total = 0.0;
+            while (static_cast<int>(samples.size()) < options.repeat || total < options.minTime) {
+                // Producer p submits every producerCount-th process, prepared outside the timing
+                vector<vector<ProcessSpec>> stripes(producerCount);
+                for (size_t row = 0; row < workload->size(); ++row) {
+                    ProcessSpec spec;
+                    spec.name = "job";
+                    spec.arrivalTime = workload->arrivalTime[row];
+                    spec.burstTime = workload->burstTime[row];
+                    spec.priority = workload->priority[row];
+                    stripes[row % producerCount].push_back(std::move(spec));
+                }
+                auto source = make_unique<LiveArrivalSource>(LiveClock::VIRTUAL);
+                LiveArrivalSource* feed = source.get();
+                scheduler->setArrivalSource(std::move(source), false);
+
+                auto start = BenchClock::now();
+                double submitMilliseconds = 0.0;
+                vector<thread> threads;
+                for (int p = 0; p < producerCount; ++p) {
+                    threads.emplace_back([feed, &stripes, p]() {
+                        for (ProcessSpec& spec : stripes[p]) feed->submit(std::move(spec));
+                    });
+                }
+                thread closer([&threads, feed, start, &submitMilliseconds]() {
+                    for (thread& producer : threads) producer.join();
+                    submitMilliseconds = chrono::duration<double, milli>(BenchClock::now() - start).count();
+                    feed->close();
+                });
+                scheduler->schedule();
+                closer.join();
+                samples.push_back(chrono::duration<double, milli>(BenchClock::now() - start).count());
+                submitSamples.push_back(submitMilliseconds);
+                total += samples.back();
+            }
+            double best = *min_element(samples.begin(), samples.end());
+            double submitBest = *min_element(submitSamples.begin(), submitSamples.end());
+
+            ResultRecord record;
+            record.id = "live/fcfs/n=" + to_string(size) + "/producers=" + to_string(producerCount) +
+                        "/c=" + to_string(options.cpus);
+            record.metric = "ns_per_submission";
+            record.value = best * 1e6 / static_cast<double>(size);
+            record.fields =
+                "\"kind\":\"live\",\"algorithm\":\"fcfs\",\"processes\":" + to_string(size) +
+                ",\"producers\":" + to_string(producerCount) + ",\"cpus\":" + to_string(options.cpus) +
+                ",\"runs\":" + to_string(samples.size()) +
+                ",\"wall_ms\":" + formatNumber(best) + ",\"submit_ms\":" + formatNumber(submitBest) +
+                ",\"submissions_per_sec\":" + formatNumber(submitBest > 0 ? size / (submitBest / 1000.0) : 0.0) +
+                ",\"ns_per_submission\":" + formatNumber(record.value);
+            records.push_back(record);
+            cerr << "  " << record.id << ": " << formatNumber(best) << " ms, "
+                 << formatNumber(submitBest > 0 ? size / (submitBest / 1000.0) / 1e6 : 0.0)
+                 << " M submissions/s" << endl;
+        }
+    }
+}
+
+// ========================================================================================
+// OUTPUT AND BASELINE COMPARISON
+// ========================================================================================
+
+void writeResults(ostream& output, const BenchmarkOptions& options, const vector<ResultRecord>& records) {
+    output << "{\"suite\":\"scheduler-benchmark\",\"version\":1,\n"
+           << "\"config\":{\"seed\":" << options.seed << ",\"repeat\":" << options.repeat
+           << ",\"cpus\":" << options.cpus << ",\"mean_burst\":" << options.meanBurst
+           << ",\"quantum\":" << options.quantum << ",\"min_time_ms\":" << options.minTime
+           << ",\"host_threads\":" << thread::hardware_concurrency()
+           << ",\"vector_isa\":\"" << getVectorInstructionSet() << "\"},\n"
+           << "\"results\":[\n";
+    for (size_t i = 0; i < records.size(); ++i) {
+        output << "{\"id\":\"" << records[i].id << "\"," << records[i].fields << "}"
+               << (i + 1 < records.size() ? ",\n" : "\n");
+    }
+    output << "]}\n";
+}
+
+/**
+ * Read Baseline
+ * Reads the compared metric of every record of an earlier result file (the
+ * one-record-per-line layout written by writeResults)
+ */
+bool readBaseline(const string& path, map<string, double>& baseline) {
+    ifstream input(path);
+    if (!input) {
+        cerr << "Error: Cannot open baseline file " << path << endl;
+        return false;
+    }
+    string line;
+    while (getline(input, line)) {
+        size_t idStart = line.find("{\"id\":\"");
+        if (idStart == string::npos) continue;
+        idStart += 7;
+        size_t idEnd = line.find('"', idStart);
+        string id = line.substr(idStart, idEnd - idStart);
+        for (const char* metric : {"\"ns_per_op\":", "\"ns_per_event\":"}) {
+            size_t at = line.find(metric);
+            if (at != string::npos) {
+                baseline[id] = strtod(line.c_str() + at + strlen(metric), nullptr);
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Compare With Baseline
+ *
+ * @return Number of records slower than the baseline by more than the tolerance
+ */
+int compareWithBaseline(const vector<ResultRecord>& records, const map<string, double>& baseline,
+                        double tolerance) {
+    int regressions = 0;
+    int compared = 0;
+    for (const ResultRecord& record : records) {
+        auto it = baseline.find(record.id);
+        if (it == baseline.end() || it->second <= 0.0) continue;
+        compared++;
+        double change = 100.0 * (record.value - it->second) / it->second;
+        if (change > tolerance) {
+            regressions++;
+            cerr << "Regression: " << record.id << " " << record.metric << " "
+                 << formatNumber(it->second) << " -> " << formatNumber(record.value)
+                 << " (+" << formatNumber(change) << "%)" << endl;
+        }
+    }
+    cerr << compared << " results compared with the baseline, " << regressions
+         << " slower by more than " << formatNumber(tolerance) << "%" << endl;
+    return regressions;
+}
+
+// ========================================================================================
+// COMMAND LINE INTERFACE
+// ========================================================================================
+
+void printUsage(const char* program) {
+    cout << "Usage: " << program << " [options]\n\n"
+         << "Options:\n"
+         << "      --suite NAME         kernels, simulations, live or all (default: all)\n"
+         << "      --sizes LIST         Processes per workload, e.g. 1e3,1e4,1e8\n"
+         << "                           (default: 1e3,1e4,1e5,1e6)\n"
+         << "      --algorithms LIST    fcfs,sjf,srtf,rr,priority,ppriority,mlfq,cfs,edf,rm\n"
+         << "                           (default: all; edf and rm run periodic task sets)\n"
+         << "      --loads LIST         Offered load per CPU, 0 = every process at time 0\n"
+         << "                           (default: 0,0.5,0.95)\n"
+         << "      --bursts LIST        uniform, exponential, pareto, bimodal (default: exponential,pareto)\n"
+         << "      --producers LIST     Producer threads of the live benchmarks (default: 1,4)\n"
+         << "      --mean-burst N       Mean CPU burst (default: 10)\n"
+         << "  -q, --quantum N          Round Robin / MLFQ level 0 quantum (default: 3)\n"
+         << "  -c, --cpus N             Simulated CPUs, work stealing when above 1 (default: 1)\n"
+         << "      --repeat N           Least timed runs per configuration, best is reported (default: 3)\n"
+         << "      --min-time MS        Keep repeating until this much time was measured (default: 100)\n"
+         << "      --seed N             Workload generator seed (default: 42)\n"
+         << "  -o, --output FILE        JSON results (default: stdout)\n"
+         << "      --baseline FILE      Compare with an earlier result file; exits with 2 on regressions\n"
+         << "      --tolerance PCT      Allowed slowdown against the baseline (default: 10)\n"
+         << "  -h, --help               Show this help\n";
+}
+
+vector<string> splitList(const string& text) {
+    vector<string> items;
+    stringstream stream(text);
+    string item;
+    while (getline(stream, item, ',')) {
+        if (!item.empty()) items.push_back(item);
+    }
+    return items;
+}
+
+bool parseNumber(const string& text, double& value) {
+    char* end = nullptr;
+    value = strtod(text.c_str(), &end);
+    return !text.empty() && *end == '\0';
+}
+
+int parseCommandLine(int argc, char* argv[], BenchmarkOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        string text;
+        auto value = [&](string& out) {
+            if (i + 1 >= argc) {
+                cerr << "Error: Option " << arg << " requires a value" << endl;
+                return false;
+            }
+            out = argv[++i];
+            return true;
+        };
+        auto number = [&](double& out, double minimum) {
+            if (!value(text)) return false;
+            if (!parseNumber(text, out) || out < minimum) {
+                cerr << "Error: Invalid value '" << text << "' for " << arg << endl;
+                return false;
+            }
+            return true;
+        };
+        double parsed = 0.0;
+
+        if (arg == "-h" || arg == "--help") {
+            printUsage(argv[0]);
+            return 1;
+        } else if (arg == "--suite") {
+            if (!value(text)) return -1;
+            if (text != "kernels" && text != "simulations" && text != "live" && text != "all") {
+                cerr << "Error: Unknown suite '" << text << "'" << endl;
+                return -1;
+            }
+            options.kernels = text == "kernels" || text == "all";
+            options.simulations = text == "simulations" || text == "all";
+            options.live = text == "live" || text == "all";
+        } else if (arg == "--sizes") {
+            if (!value(text)) return -1;
+            options.sizes.clear();
+            for (const string& item : splitList(text)) {
+                if (!parseNumber(item, parsed) || parsed < 1 || parsed > 2e9) {
+                    cerr << "Error: Invalid size '" << item << "'" << endl;
+                    return -1;
+                }
+                options.sizes.push_back(static_cast<size_t>(parsed));
+            }
+        } else if (arg == "--algorithms") {
+            if (!value(text)) return -1;
+            options.algorithms = splitList(text);
+            for (const string& algorithm : options.algorithms) {
+                if (!createScheduler(algorithm, options)) {
+                    cerr << "Error: Unknown algorithm '" << algorithm << "'" << endl;
+                    return -1;
+                }
+            }
+        } else if (arg == "--loads") {
+            if (!value(text)) return -1;
+            options.loads.clear();
+            for (const string& item : splitList(text)) {
+                if (!parseNumber(item, parsed) || parsed < 0) {
+                    cerr << "Error: Invalid load '" << item << "'" << endl;
+                    return -1;
+                }
+                options.loads.push_back(parsed);
+            }
+        } else if (arg == "--bursts") {
+            if (!value(text)) return -1;
+            options.bursts.clear();
+            for (const string& item : splitList(text)) {
+                if (item == "uniform") options.bursts.push_back(BurstDistribution::UNIFORM);
+                else if (item == "exponential") options.bursts.push_back(BurstDistribution::EXPONENTIAL);
+                else if (item == "pareto") options.bursts.push_back(BurstDistribution::PARETO);
+                else if (item == "bimodal") options.bursts.push_back(BurstDistribution::BIMODAL);
+                else {
+                    cerr << "Error: Unknown burst distribution '" << item << "'" << endl;
+                    return -1;
+                }
+            }
+        } else if (arg == "--producers") {
+            if (!value(text)) return -1;
+            options.producers.clear();
+            for (const string& item : splitList(text)) {
+                if (!parseNumber(item, parsed) || parsed < 1 || parsed > 256) {
+                    cerr << "Error: Invalid producer count '" << item << "'" << endl;
+                    return -1;
+                }
+                options.producers.push_back(static_cast<int>(parsed));
+            }
+        } else if (arg == "--mean-burst") {
+            if (!number(parsed, 2)) return -1;
+            options.meanBurst = static_cast<int>(parsed);
+        } else if (arg == "-q" || arg == "--quantum") {
+            if (!number(parsed, 1)) return -1;
+            options.quantum = static_cast<int>(parsed);
+        } else if (arg == "-c" || arg == "--cpus") {
+            if (!number(parsed, 1)) return -1;
+            options.cpus = static_cast<int>(min(parsed, 256.0));
+        } else if (arg == "--repeat") {
+            if (!number(parsed, 1)) return -1;
+            options.repeat = static_cast<int>(parsed);
+        } else if (arg == "--min-time") {
+            if (!number(options.minTime, 0)) return -1;
+        } else if (arg == "--seed") {
+            if (!number(parsed, 0)) return -1;
+            options.seed = static_cast<uint64_t>(parsed);
+        } else if (arg == "-o" || arg == "--output") {
+            if (!value(options.outputPath)) return -1;
+        } else if (arg == "--baseline") {
+            if (!value(options.baselinePath)) return -1;
+        } else if (arg == "--tolerance") {
+            if (!number(options.tolerance, 0)) return -1;
+        } else {
+            cerr << "Error: Unknown option '" << arg << "'" << endl;
+            return -1;
+        }
+    }
+    return 0;
+}
+
+} // namespace
+
+// ========================================================================================
+// MAIN FUNCTION
+// ========================================================================================
+
+/**
+ * Main Function - Benchmark Entry Point
+ * Progress goes to stderr, results to the output file or stdout
+ */
+int main(int argc, char* argv[]) {
+    Scheduler::setDefaultVerbosity(Verbosity::QUIET);
+    BenchmarkOptions options;
+    int parsed = parseCommandLine(argc, argv, options);
+    if (parsed != 0) {
+        if (parsed < 0) {
+            cerr << "Run '" << argv[0] << " --help' for usage." << endl;
+        }
+        return parsed > 0 ? 0 : 1;
+    }
+
+    map<string, double> baseline;
+    if (!options.baselinePath.empty() && !readBaseline(options.baselinePath, baseline)) {
+        return 1;
+    }
+
+    vector<ResultRecord> records;
+    if (options.kernels) {
+        cerr << "Kernel benchmarks" << endl;
+        runKernelBenchmarks(options, records);
+    }
+    if (options.simulations) {
+        cerr << "Simulation benchmarks" << endl;
+        runSimulationBenchmarks(options, records);
+    }
+    if (options.live) {
+        cerr << "Live submission benchmarks" << endl;
+        runLiveBenchmarks(options, records);
+    }
+
+    if (options.outputPath.empty()) {
+        writeResults(cout, options, records);
+    } else {
+        ofstream output(options.outputPath);
+        if (!output) {
+            cerr << "Error: Cannot write " << options.outputPath << endl;
+            return 1;
+        }
+        writeResults(output, options, records);
+    }
+
+    if (!options.baselinePath.empty() && compareWithBaseline(records, baseline, options.tolerance) > 0) {
+        return 2;
+    }
+    return 0;
+}
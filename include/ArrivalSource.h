@@ -0,0 +1,137 @@
+/**
+ * ArrivalSource.h - Streaming Process Arrival Source HEADER FILE
+ *
+ * This header file defines the ArrivalSource interface used to feed processes
+ * into a Scheduler lazily, in arrival order, instead of preloading the whole
+ * workload with addProcess(). The scheduler only pulls a process from the
+ * source once the simulation clock reaches its arrival time.
+ *
+ */
+
+#ifndef ARRIVAL_SOURCE_H
+#define ARRIVAL_SOURCE_H
+
+#include <istream>      // For streamed input
+#include <memory>       // For smart pointers
+#include <string>       // For string operations
+
+#include "ProcessTable.h" // Include process specification and time types
+
+using namespace std;
+
+// ========================================================================================
+// ABSTRACT ARRIVAL SOURCE
+// ========================================================================================
+
+/**
+ * Abstract Arrival Source
+ *
+ * Produces processes in non-decreasing order of arrival time.
+ * Implementations must be able to report the arrival time of the next
+ * process without consuming it.
+ */
+class ArrivalSource {
+public:
+    /**
+     * Virtual Destructor
+     */
+    virtual ~ArrivalSource() = default;
+
+    /**
+     * Has Next Process
+     *
+     * @return True if at least one more process will be produced
+     */
+    virtual bool hasNext() const = 0;
+
+    /**
+     * Peek Arrival Time
+     * Returns the arrival time of the next process without consuming it
+     *
+     * @return Arrival time of the next process (undefined if hasNext() is false)
+     */
+    virtual SimTime peekArrivalTime() const = 0;
+
+    /**
+     * Next Process
+     * Consumes the next process and writes its description into spec
+     *
+     * @param spec - Receives the next process
+     * @return False if the source is exhausted
+     */
+    virtual bool next(ProcessSpec& spec) = 0;
+
+    /**
+     * Rewind
+     * Restarts the source at its first process, so a later run can replay
+     * the same arrivals. Sources that cannot replay keep their position.
+     *
+     * @return True if the source was restarted
+     */
+    virtual bool rewind() { return false; }
+
+    /**
+     * Is Live
+     * Live sources are still being fed while the simulation runs, so they
+     * cannot know their next arrival until their clock has passed it
+     *
+     * @return True if the scheduler must call awaitArrivals() before every step
+     */
+    virtual bool isLive() const { return false; }
+
+    /**
+     * Await Arrivals
+     * Blocks until every process arriving at or before the given time has
+     * been produced. Sources that know all their processes return at once.
+     *
+     * @param time - Time the simulation is about to advance to
+     * @return False if an earlier arrival (or the end of the source) showed up
+     *         while waiting, so the caller must recompute its next step
+     */
+    virtual bool awaitArrivals(SimTime time) { (void)time; return true; }
+};
+
+// ========================================================================================
+// STREAM ARRIVAL SOURCE
+// ========================================================================================
+
+/**
+ * Stream Arrival Source
+ *
+ * Reads one process per line from an input stream, in the CSV trace format
+ * of WorkloadLoader::loadCsv(): "name,arrival,burst[,priority[,io...]]"
+ * (commas or whitespace as separators), where an io field is an I/O request
+ * "cpuBefore:duration[@device]", "period=N", "deadline=N" or "group=PATH".
+ * Empty lines, '#' comments and a leading header line are skipped. Lines
+ * must be sorted by arrival time; out-of-order lines are clamped to the
+ * previous arrival time with a warning.
+ */
+class StreamArrivalSource : public ArrivalSource {
+private:
+    istream& input;                     // Stream the processes are read from
+    ProcessSpec pending;                // Next process, already parsed
+    bool hasPending;                    // Whether pending holds a process
+    bool seenData;                      // Whether a non-blank line was read
+    SimTime lastArrivalTime;            // Arrival time of the last produced process
+    long long lineNumber;               // Current input line (for diagnostics)
+
+    /**
+     * Read Next Line
+     * Parses lines until a valid process is found or the stream ends
+     */
+    void readNext();
+
+public:
+    /**
+     * Stream Arrival Source Constructor
+     *
+     * @param stream - Input stream to read from (must outlive the source)
+     */
+    explicit StreamArrivalSource(istream& stream);
+
+    bool hasNext() const override;
+    SimTime peekArrivalTime() const override;
+    bool next(ProcessSpec& spec) override;
+};
+
+#endif // ARRIVAL_SOURCE_H
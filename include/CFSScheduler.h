@@ -0,0 +1,235 @@
+#ifndef CFS_SCHEDULER_H
+#define CFS_SCHEDULER_H
+
+#include "Scheduler.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * ========================================================================================
+ * SCHEDULING ENTITIES
+ * ========================================================================================
+ *
+ * CFS Entity
+ *
+ * Per-process CFS state, including the red-black tree links. Entities live
+ * in one array indexed by process handle and shared by every run queue of the
+ * scheduler (a process is queued on at most one CPU at a time), so enqueue
+ * and dequeue never allocate.
+ */
+struct CfsEntity {
+    int64_t vruntime = 0;                   // Virtual runtime (time scaled by NICE_0_WEIGHT / weight)
+    long long sequence = 0;                 // Enqueue order (breaks vruntime ties FIFO)
+    ProcessHandle parent = INVALID_PROCESS; // Tree links
+    ProcessHandle left = INVALID_PROCESS;
+    ProcessHandle right = INVALID_PROCESS;
+    bool red = false;                       // Node colour
+    bool placed = false;                    // Whether the vruntime was initialised this run
+    int runStartRemaining = -1;             // Remaining time when dispatched (-1 if not running)
+};
+
+/**
+ * ========================================================================================
+ * CFS RUN QUEUE
+ * ========================================================================================
+ *
+ * CFS Run Queue
+ *
+ * Runnable processes in a red-black tree ordered by (vruntime, enqueue order),
+ * with the leftmost node cached: top() is O(1), push() and pop() O(log n).
+ * The queue also tracks the total weight of its processes for slice sizing
+ * and a monotonic minimum vruntime used to place new processes.
+ */
+class CfsRunQueue : public ReadyQueue {
+private:
+    vector<CfsEntity>& entities;            // Shared entity array (owned by the scheduler)
+    const ProcessTable& processes;          // Source of priorities and remaining times
+    const int* weights;                     // Load weight per priority level
+    ProcessHandle root;                     // Tree root (INVALID_PROCESS if empty)
+    ProcessHandle leftmost;                 // Cached smallest entry
+    size_t count;                           // Queued processes
+    int64_t totalWeight;                    // Sum of the queued weights
+    int64_t minVruntime;                    // Never decreases during a run
+
+    bool less(ProcessHandle a, ProcessHandle b) const;
+    void rotateLeft(ProcessHandle x);
+    void rotateRight(ProcessHandle x);
+    void insertFixup(ProcessHandle x);
+    void eraseFixup(ProcessHandle x, ProcessHandle parent);
+    void erase(ProcessHandle z);
+
+public:
+    /**
+     * CFS Run Queue Constructor
+     *
+     * @param shared - Entity array indexed by process handle
+     * @param table - Table the queued handles refer to
+     * @param priorityWeights - Weight per Priority value (index = value - 1)
+     */
+    CfsRunQueue(vector<CfsEntity>& shared, const ProcessTable& table, const int* priorityWeights);
+
+    /**
+     * Push Process
+     * Charges the virtual runtime of a process coming off the CPU, or places a
+     * new process at the queue's minimum vruntime, then inserts it
+     */
+    void push(ProcessHandle handle) override;
+    ProcessHandle top() const override;
+    ProcessHandle pop() override;
+    size_t size() const override;
+    void clear() override;
+
+    /**
+     * Collect Processes
+     * In-order walk of the tree from the leftmost node
+     */
+    void collect(vector<ProcessHandle>& out) const override;
+
+    /**
+     * Outranks
+     * Smaller virtual runtime (including time run in the current slice)
+     */
+    bool outranks(ProcessHandle a, ProcessHandle b) const override;
+
+    /**
+     * Get Weight
+     *
+     * @param handle - Process
+     * @return Load weight of its priority
+     */
+    int getWeight(ProcessHandle handle) const;
+
+    /**
+     * Get Current Vruntime
+     * Virtual runtime including the part of the current slice already run
+     *
+     * @param handle - Process
+     * @return Virtual runtime
+     */
+    int64_t currentVruntime(ProcessHandle handle) const;
+
+    /**
+     * Get Total Weight
+     *
+     * @return Sum of the weights of the queued processes
+     */
+    int64_t getTotalWeight() const { return totalWeight; }
+
+    /**
+     * Get Minimum Vruntime
+     *
+     * @return Monotonic minimum virtual runtime of the queue
+     */
+    int64_t getMinVruntime() const { return minVruntime; }
+
+    /**
+     * Set Minimum Vruntime
+     * Used when a snapshot is restored into an empty queue
+     *
+     * @param vruntime - Minimum virtual runtime to continue from
+     */
+    void setMinVruntime(int64_t vruntime) { minVruntime = vruntime; }
+};
+
+/**
+ * ========================================================================================
+ * COMPLETELY FAIR SCHEDULER (CFS)
+ * ========================================================================================
+ *
+ * CFS Scheduler
+ *
+ * Model of the Linux Completely Fair Scheduler. Every process accumulates
+ * virtual runtime at a rate inversely proportional to its weight, and the
+ * process with the smallest virtual runtime runs next.
+ *
+ * Slices: the scheduling period is the target latency, stretched to
+ * runnable * minimum granularity when many processes are runnable, and is
+ * shared out in proportion to weight (never below the minimum granularity).
+ * An arrival or I/O wakeup preempts the running process if it trails it by
+ * more than the wakeup granularity of virtual time. Sleeping earns no credit:
+ * a woken process rejoins at no less than the queue's minimum vruntime.
+ *
+ * Characteristics:
+ * - Preemptive, weighted fair sharing
+ * - Priority maps to weight: HIGH = nice -5, MEDIUM = nice 0, LOW = nice 5
+ * - O(log n) dispatch regardless of the number of runnable processes
+ */
+class CFSScheduler : public Scheduler {
+private:
+    SimTime targetLatency;          // Scheduling period with few runnable processes
+    SimTime minGranularity;         // Shortest slice
+    SimTime wakeupGranularity;      // Vruntime lead an arrival needs to preempt
+    int weights[3];                 // Load weight per Priority (HIGH, MEDIUM, LOW)
+    vector<CfsEntity> entities;     // Per-process state and tree nodes
+
+    CfsRunQueue& cfsQueue(int cpu) const;
+    CfsRunQueue& cfsQueue(int cpu, ProcessHandle process) const;   // Queue of the process's group
+    int cpuOf(ProcessHandle process) const;
+
+public:
+    static constexpr int NICE_0_WEIGHT = 1024;     // Weight of nice 0 in the Linux table
+
+    /**
+     * CFS Constructor
+     *
+     * @param latency - Target latency (default: 24)
+     * @param granularity - Minimum granularity (default: 3)
+     */
+    CFSScheduler(SimTime latency = 24, SimTime granularity = 3);
+
+    /**
+     * CFS Scheduling Algorithm Implementation
+     */
+    bool schedule() override;
+
+    /**
+     * Set Target Latency
+     *
+     * @param latency - Scheduling period with few runnable processes
+     */
+    void setTargetLatency(SimTime latency);
+
+    /**
+     * Set Minimum Granularity
+     *
+     * @param granularity - Shortest slice (also used as wakeup granularity)
+     */
+    void setMinGranularity(SimTime granularity);
+
+    /**
+     * Set Priority Weight
+     *
+     * @param priority - Priority level
+     * @param weight - Load weight (positive)
+     */
+    void setPriorityWeight(Priority priority, int weight);
+
+    /**
+     * Get Target Latency
+     *
+     * @return Scheduling period with few runnable processes
+     */
+    SimTime getTargetLatency() const { return targetLatency; }
+
+    /**
+     * Get Minimum Granularity
+     *
+     * @return Shortest slice
+     */
+    SimTime getMinGranularity() const { return minGranularity; }
+
+protected:
+    friend class Scheduler;     // Its kernel calls the hooks below statically
+    unique_ptr<ReadyQueue> createRunQueue(ReadyQueueOrder order) override;
+    ProcessHandle selectNextProcess(int cpu) override;
+    int getTimeSlice(ProcessHandle process) const override;
+    string getDispatchMessage(ProcessHandle process) const override;
+    bool shouldPreempt(ProcessHandle running, ProcessHandle candidate, int cpu) const override;
+    void onProcessBlocked(ProcessHandle process, int cpu) override;
+    void onProcessRecycled(ProcessHandle process) override;
+    void savePolicyState(vector<int64_t>& state) const override;
+    void restorePolicyState(const SchedulerSnapshot& source, bool samePolicy) override;
+};
+
+#endif // CFS_SCHEDULER_H
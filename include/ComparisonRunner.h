@@ -0,0 +1,219 @@
+/**
+ * ComparisonRunner.h - Parallel Multi-Algorithm Comparison HEADER FILE
+ *
+ * This header file defines the ComparisonRunner, which runs many independent
+ * Scheduler instances over one shared, read-only Workload on a pool of worker
+ * threads and collects their metrics into a single comparison table.
+ *
+ * Every scheduler owns its ProcessTable, ready queue and event queue, so the
+ * runs share nothing mutable and scale with the number of cores.
+ *
+ */
+
+#ifndef COMPARISON_RUNNER_H
+#define COMPARISON_RUNNER_H
+
+#include <functional>   // For parallel job callbacks
+#include <memory>       // For smart pointers
+#include <string>       // For string operations
+#include <vector>       // For scheduler and result storage
+
+#include "Scheduler.h"  // Include Scheduler base class
+#include "ProcessTable.h" // Include shared workload definition
+
+using namespace std;
+
+// ========================================================================================
+// PARALLEL EXECUTION
+// ========================================================================================
+
+/**
+ * Run Parallel
+ * Calls job(0) .. job(jobCount - 1) on a pool of worker threads. Workers claim
+ * the next index from a shared atomic counter, so uneven jobs balance out.
+ * Runs inline when only one worker would be used.
+ *
+ * @param jobCount - Number of jobs
+ * @param threads - Worker threads (0 = one per hardware thread)
+ * @param job - Job to run for each index (must be safe to call concurrently)
+ */
+void runParallel(size_t jobCount, size_t threads, const function<void(size_t)>& job);
+
+// ========================================================================================
+// CSV OUTPUT
+// ========================================================================================
+
+/**
+ * Quote CSV Field
+ * Encloses a field that holds a comma, quote or line break in double quotes,
+ * doubling its quotes, so that labels such as "MLFQ (3 levels, q=3)" stay
+ * one column
+ *
+ * @param text - Field text
+ * @return Field as written to a CSV row
+ */
+string quoteCsvField(const string& text);
+
+// ========================================================================================
+// COMPARISON RESULT
+// ========================================================================================
+
+/**
+ * Comparison Result
+ * Metrics of one scheduler run
+ */
+struct ComparisonResult {
+    string label;                   // Name shown in the comparison table
+    bool success = false;           // Whether the simulation completed
+    long long processCount = 0;     // Processes completed, streamed ones included
+    double averageWaitingTime = 0.0;        // Mean time spent in the ready queue
+    double averageTurnaroundTime = 0.0;     // Mean completion minus arrival
+    double averageResponseTime = 0.0;       // Mean first dispatch minus arrival
+    SimTime totalExecutionTime = 0;         // Time the last process completed
+    long long contextSwitches = 0;          // CPU handed to a different process
+    int cpuCount = 1;                       // Simulated CPUs
+    long long migrations = 0;               // Dispatches on another CPU than last time
+    SimTime overheadTime = 0;               // CPU time spent on dispatch overhead
+    double utilisation = 0.0;               // Mean busy fraction of the CPUs
+    double throughput = 0.0;                // Completed processes per time unit
+    RunStatistics statistics;               // Percentile sketches and throughput series
+    double wallMilliseconds = 0.0;          // Host time spent simulating
+};
+
+/**
+ * Collect Result
+ * Copies the metrics of a completed run (label, success and wall time are
+ * left to the caller)
+ *
+ * @param scheduler - Scheduler whose last run completed
+ * @param result - Result to fill
+ */
+void collectResult(const Scheduler& scheduler, ComparisonResult& result);
+
+// ========================================================================================
+// COMPARISON RUNNER
+// ========================================================================================
+
+/**
+ * Comparison Runner
+ *
+ * Collects configured schedulers, then runs them all against the same workload.
+ * Worker threads pull the next pending scheduler from a shared counter, so long
+ * and short runs balance out without any locking. Results are stored by the
+ * index the scheduler was added with, keeping the table order deterministic.
+ */
+class ComparisonRunner {
+private:
+    shared_ptr<const Workload> workload;        // Workload shared by every run
+    shared_ptr<const SchedulerSnapshot> snapshot;   // Common starting point of every run (optional)
+    vector<unique_ptr<Scheduler>> schedulers;   // Schedulers to compare
+    vector<string> labels;                      // Table label of each scheduler
+    vector<ComparisonResult> results;           // Results of the last run()
+    size_t threadCount;                         // Worker threads to use
+    Verbosity verbosity;                        // Reporting level of the runs
+
+    /**
+     * Run One Scheduler
+     * Executes the scheduler at the given index and stores its result
+     *
+     * @param index - Index returned by addScheduler()
+     */
+    void runOne(size_t index);
+
+public:
+    /**
+     * Comparison Runner Constructor
+     *
+     * @param sharedWorkload - Workload every scheduler simulates
+     * @param threads - Worker threads (0 = one per hardware thread)
+     */
+    explicit ComparisonRunner(shared_ptr<const Workload> sharedWorkload, size_t threads = 0);
+
+    /**
+     * Add Scheduler
+     * Registers a configured scheduler; its own process list is replaced by the shared workload
+     *
+     * @param scheduler - Scheduler to run
+     * @param label - Name in the comparison table (default: algorithm name)
+     * @return Index of the scheduler
+     */
+    size_t addScheduler(unique_ptr<Scheduler> scheduler, const string& label = "");
+
+    /**
+     * Set Snapshot
+     * Forks every run from a paused simulation instead of starting it at time 0;
+     * the snapshot is read-only, so all branches share it. Each scheduler must
+     * simulate as many CPUs with the same load balancing as the snapshot.
+     *
+     * @param start - Snapshot to resume from (nullptr = start from the workload)
+     */
+    void setSnapshot(shared_ptr<const SchedulerSnapshot> start);
+
+    /**
+     * Set Thread Count
+     *
+     * @param threads - Worker threads (0 = one per hardware thread)
+     */
+    void setThreadCount(size_t threads);
+
+    /**
+     * Get Thread Count
+     *
+     * @return Number of worker threads used by run()
+     */
+    size_t getThreadCount() const;
+
+    /**
+     * Set Verbosity
+     * Runs are QUIET by default. At Verbosity::TRACE every run prints its
+     * execution trace, which forces a single worker so traces stay in order.
+     *
+     * @param level - Reporting level of the runs
+     */
+    void setVerbosity(Verbosity level);
+
+    /**
+     * Get Scheduler Count
+     *
+     * @return Number of registered schedulers
+     */
+    size_t getSchedulerCount() const;
+
+    /**
+     * Get Scheduler
+     * Gives access to a scheduler, e.g. to print its per-process statistics after run()
+     *
+     * @param index - Index returned by addScheduler()
+     * @return Scheduler at that index
+     */
+    const Scheduler& getScheduler(size_t index) const;
+
+    /**
+     * Run All Schedulers
+     * Simulates every registered scheduler in parallel
+     *
+     * @return Results in the order the schedulers were added
+     */
+    const vector<ComparisonResult>& run();
+
+    /**
+     * Get Results
+     *
+     * @return Results of the last run()
+     */
+    const vector<ComparisonResult>& getResults() const;
+
+    /**
+     * Print Comparison Table
+     * Displays one row of averages per scheduler
+     */
+    void printComparison() const;
+
+    /**
+     * Print Comparison CSV
+     * Writes a header and one comma-separated row of averages per scheduler
+     */
+    void printCsv() const;
+};
+
+#endif // COMPARISON_RUNNER_H
@@ -0,0 +1,305 @@
+/**
+ * DistributedSweep.h - Multi-Node Parameter Sweep HEADER FILE
+ *
+ * This header file defines the coordinator and the worker of a parameter
+ * sweep that spans several machines. The sweep is every configuration
+ * (algorithm and quantum) on every workload:
+ * - The coordinator listens on a TCP port and hands the configurations out
+ *   in shards, each sized to the worker's thread count and sharing one
+ *   workload, so a node runs a whole shard in parallel
+ * - A workload crosses the network at most once per worker, in the binary
+ *   workload format; workers keep it in memory and, with a cache directory,
+ *   on disk for later sweeps
+ * - Workers send back the run's summary and its mergeable statistics
+ *   sketches instead of per-process results; the coordinator pools the
+ *   sketches of every workload per configuration
+ * - A shard whose worker disconnects or times out goes back to the queue
+ *   and is retried on another worker; workers can join at any time
+ *
+ */
+
+#ifndef DISTRIBUTED_SWEEP_H
+#define DISTRIBUTED_SWEEP_H
+
+#include <cstdint>      // For shard and digest identifiers
+#include <functional>   // For the scheduler factory
+#include <memory>       // For smart pointers
+#include <string>       // For labels and host names
+#include <vector>       // For tasks and results
+
+#include "ComparisonRunner.h" // Include ComparisonResult definition
+#include "ProcessTable.h" // Include shared workload definition
+#include "Scheduler.h"  // Include machine settings and SchedulingMetric
+
+using namespace std;
+
+// ========================================================================================
+// SWEEP DEFINITION
+// ========================================================================================
+
+/**
+ * Sweep Settings
+ * Machine and policy parameters shared by every run of a sweep
+ */
+struct SweepSettings {
+    int cpus = 1;                           // Simulated CPUs
+    LoadBalancing balancing = LoadBalancing::GLOBAL_QUEUE;  // How CPUs share ready processes
+    int balanceInterval = 10;               // Time between periodic balancing passes
+    DispatchCosts dispatchCosts;            // Overhead charged on every dispatch
+    int throughputWindow = 100;             // Initial width of the throughput windows
+    int releaseHorizon = 0;                 // Time after which periodic jobs stop (0 = automatic)
+    int mlfqLevels = 3;                     // MLFQ levels
+    int boostInterval = 100;                // MLFQ priority boost interval
+    int agingThreshold = 50;                // MLFQ aging threshold
+    int targetLatency = 24;                 // CFS target latency
+    int minGranularity = 3;                 // CFS minimum granularity
+};
+
+/**
+ * Sweep Task
+ * One configuration on one workload
+ */
+struct SweepTask {
+    string algorithm;                       // Command line name of the algorithm
+    int quantum = 0;                        // Time quantum (0 for policies without one)
+    uint32_t workload = 0;                  // Index returned by addWorkload()
+    string label;                           // Configuration name in the results
+};
+
+/**
+ * Sweep Task Result
+ */
+struct SweepTaskResult {
+    SweepTask task;                         // Configuration and workload
+    ComparisonResult result;                // Summary and statistics sketches of the run
+    unsigned attempts = 0;                  // Times the task was handed to a worker
+};
+
+/**
+ * Sweep Scheduler Factory
+ * Creates a configured scheduler for a task (nullptr if the algorithm is unknown)
+ */
+using SweepSchedulerFactory = function<unique_ptr<Scheduler>(const SweepTask&, const SweepSettings&)>;
+
+// ========================================================================================
+// SWEEP COORDINATOR
+// ========================================================================================
+
+/**
+ * Sweep Coordinator
+ *
+ * run() accepts worker connections and serves each one on its own thread.
+ * A connection takes the next shard from the queue: the oldest pending task
+ * and the following tasks of the same workload, up to the worker's thread
+ * count. When the connection fails, its shard is requeued; a task that
+ * failed on as many connections as allowed is reported as failed. run()
+ * returns once every task has a result.
+ *
+ * Results do not depend on which worker ran a task or how the sweep was
+ * sharded, because every simulation is deterministic.
+ */
+class SweepCoordinator {
+private:
+    struct State;                           // Queue and connections shared with the serving threads
+
+    SweepSettings settings;                 // Machine of every run
+    vector<shared_ptr<const Workload>> workloads;   // Workloads by index
+    vector<string> workloadNames;           // Shown in progress messages
+    vector<SweepTask> tasks;                // Every configuration on every workload
+    vector<SweepTaskResult> results;        // Results of the last run(), in task order
+    SchedulingMetric objective;             // Metric that picks the best configuration
+    int listenSocket;                       // Listening socket (-1 until listen())
+    int port;                               // TCP port listened on
+    size_t shardSize;                       // Most tasks per shard (0 = the worker's thread count)
+    unsigned maxAttempts;                   // Connections a task may fail on
+    double shardTimeout;                    // Seconds a worker may stay silent (0 = no limit)
+    bool progress;                          // Whether progress goes to cerr
+
+    /**
+     * Serve Worker
+     * Body of a connection thread
+     *
+     * @param state - Shared queue
+     * @param socket - Connected worker
+     * @param peer - Worker address for messages
+     */
+    void serveWorker(State& state, int socket, const string& peer);
+
+public:
+    static constexpr unsigned DEFAULT_RETRIES = 3;      // Requeues of a task before it fails
+
+    /**
+     * Sweep Coordinator Constructor
+     *
+     * @param machine - Machine of every run
+     * @param target - Metric that picks the best configuration (default: waiting time)
+     */
+    explicit SweepCoordinator(const SweepSettings& machine,
+                              SchedulingMetric target = SchedulingMetric::WAITING_TIME);
+
+    /**
+     * Destructor
+     * Closes the listening socket
+     */
+    ~SweepCoordinator();
+
+    SweepCoordinator(const SweepCoordinator&) = delete;
+    SweepCoordinator& operator=(const SweepCoordinator&) = delete;
+
+    /**
+     * Add Workload
+     *
+     * @param workload - Workload to sweep
+     * @param name - Name in progress messages
+     * @return Index of the workload
+     */
+    uint32_t addWorkload(shared_ptr<const Workload> workload, const string& name);
+
+    /**
+     * Add Task
+     *
+     * @param algorithm - Command line name of the algorithm
+     * @param quantum - Time quantum (0 for policies without one)
+     * @param workload - Index returned by addWorkload()
+     * @param label - Configuration name in the results
+     */
+    void addTask(const string& algorithm, int quantum, uint32_t workload, const string& label);
+
+    /**
+     * Set Shard Size
+     *
+     * @param size - Most tasks per shard (0 = the worker's thread count)
+     */
+    void setShardSize(size_t size) { shardSize = size; }
+
+    /**
+     * Set Retries
+     *
+     * @param retries - Times a task is requeued after its worker failed
+     */
+    void setRetries(unsigned retries) { maxAttempts = retries + 1; }
+
+    /**
+     * Set Shard Timeout
+     *
+     * @param seconds - Longest silence of a worker before its shard is requeued (0 = no limit)
+     */
+    void setShardTimeout(double seconds) { shardTimeout = seconds > 0.0 ? seconds : 0.0; }
+
+    /**
+     * Set Progress
+     *
+     * @param enabled - Whether joining workers, retries and shards are reported on cerr
+     */
+    void setProgress(bool enabled) { progress = enabled; }
+
+    /**
+     * Listen
+     * Opens the TCP port; workers may connect as soon as it returns
+     *
+     * @param listenPort - Port to listen on (0 = any free port)
+     * @return True if the port was opened
+     */
+    bool listen(int listenPort);
+
+    /**
+     * Get Port
+     *
+     * @return Port listened on (after listen())
+     */
+    int getPort() const { return port; }
+
+    /**
+     * Run Sweep
+     * Serves workers until every task has a result, then closes the port
+     * (call listen() again before another run)
+     *
+     * @return True if every task completed
+     */
+    bool run();
+
+    /**
+     * Get Results
+     *
+     * @return Results of the last run(), in the order the tasks were added
+     */
+    const vector<SweepTaskResult>& getResults() const { return results; }
+
+    /**
+     * Print Sweep Table
+     * One row per configuration, pooled over every workload
+     */
+    void printResults() const;
+
+    /**
+     * Print Sweep CSV
+     * Writes a header and one comma-separated row per configuration
+     */
+    void printCsv() const;
+};
+
+// ========================================================================================
+// SWEEP WORKER
+// ========================================================================================
+
+/**
+ * Sweep Worker
+ *
+ * Connects to a coordinator and runs the shards it is given with a
+ * ComparisonRunner over the shard's workload, until the coordinator reports
+ * that the sweep is done. A workload is asked for only when it is neither
+ * in memory nor in the cache directory.
+ */
+class SweepWorker {
+private:
+    SweepSchedulerFactory factory;          // Builds the scheduler of each task
+    size_t threadCount;                     // Threads of a shard (0 = one per hardware thread)
+    string cacheDirectory;                  // Workload cache on disk (empty = none)
+    uint64_t shardCount;                    // Shards run so far
+    uint64_t workloadsReceived;             // Workloads the coordinator had to send
+
+public:
+    static constexpr size_t MEMORY_CACHE_ENTRIES = 4;   // Workloads kept loaded
+    static constexpr double CONNECT_SECONDS = 30.0;     // How long to wait for the coordinator
+
+    /**
+     * Sweep Worker Constructor
+     *
+     * @param schedulerFactory - Builds the scheduler of each task
+     * @param threads - Threads of a shard (0 = one per hardware thread)
+     */
+    explicit SweepWorker(SweepSchedulerFactory schedulerFactory, size_t threads = 0);
+
+    /**
+     * Set Cache Directory
+     *
+     * @param directory - Existing directory holding received workloads (empty = none)
+     */
+    void setCacheDirectory(const string& directory) { cacheDirectory = directory; }
+
+    /**
+     * Run Worker
+     * Serves one coordinator until the sweep is done
+     *
+     * @param host - Coordinator host name or address
+     * @param port - Coordinator port
+     * @return True if the coordinator ended the sweep normally
+     */
+    bool run(const string& host, int port);
+
+    /**
+     * Get Shard Count
+     *
+     * @return Shards run so far
+     */
+    uint64_t getShardCount() const { return shardCount; }
+
+    /**
+     * Get Workloads Received
+     *
+     * @return Workloads the coordinator sent (the others came from a cache)
+     */
+    uint64_t getWorkloadsReceived() const { return workloadsReceived; }
+};
+
+#endif // DISTRIBUTED_SWEEP_H
@@ -0,0 +1,47 @@
+#ifndef EDFSCHEDULER_H
+#define EDFSCHEDULER_H
+
+#include "Scheduler.h"
+#include <iostream>
+#include <memory>
+#include <vector>
+using namespace std;
+
+/**
+ * Earliest Deadline First Scheduler
+ * 
+ * Preemptive real-time scheduling algorithm that always runs the ready
+ * process whose absolute deadline (arrival + relative deadline) is nearest.
+ * Periodic processes release a new job every period from the event queue.
+ * 
+ * Characteristics:
+ * - Preemptive: a job with an earlier deadline takes the CPU at once
+ * - Dynamic priorities: each job's priority follows from its own deadline
+ * - Optimal on one CPU: meets every deadline whenever utilisation <= 1
+ * - Processes without a deadline only run when no deadline is pending
+ */
+class EDFScheduler : public Scheduler {
+public:
+    /**
+     * EDF Scheduler Constructor
+     * Ready queue is ordered by absolute deadline (ties: arrival, then PID)
+     */
+    EDFScheduler();
+
+    /**
+     * EDF Scheduling Algorithm Implementation
+     * Always selects the process with the earliest absolute deadline
+     */
+    bool schedule() override;
+
+protected:
+    friend class Scheduler;     // Its kernel calls the hooks below statically
+
+    /**
+     * Get Dispatch Message
+     * Includes the absolute deadline in the trace line
+     */
+    string getDispatchMessage(ProcessHandle process) const override;
+};
+
+#endif
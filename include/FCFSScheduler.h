@@ -36,7 +36,7 @@ public:
      * FCFS Scheduling Algorithm Implementation
      * Processes are executed in arrival order without preemption
      */
-    void schedule() override;
+    bool schedule() override;
 };
 
 #endif // FCFS_SCHEDULER_H
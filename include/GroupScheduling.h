@@ -0,0 +1,502 @@
+/**
+ * GroupScheduling.h - Hierarchical Process Groups HEADER FILE
+ *
+ * This header file defines cgroup-like process groups for multi-tenant
+ * machines. Groups form a tree named by paths such as "tenantA/batch"; every
+ * process belongs to one group (the root group by default):
+ * - Shares: siblings divide the CPU in proportion to their weights. Each
+ *   group level picks the child with the least weighted virtual runtime, so
+ *   selection costs O(log n) per level of the hierarchy
+ * - Bandwidth: a group may run for at most its quota in every period; once
+ *   the quota is used up the whole subtree is throttled until the next period
+ * - Policy: inside a group, processes are ordered by the scheduler's own
+ *   run queue (FCFS, SJF, RR, MLFQ, CFS, ...), one per group
+ * - Metrics: per-group CPU time, utilisation, throttled time and latency
+ *   distributions, to size tenant quotas
+ *
+ */
+
+#ifndef GROUP_SCHEDULING_H
+#define GROUP_SCHEDULING_H
+
+#include <cstdint>      // For weights and virtual runtimes
+#include <functional>   // For the queue factory and refill callback
+#include <memory>       // For smart pointers
+#include <set>          // For the per-level ordered entities
+#include <string>       // For group paths
+#include <string_view>  // For path lookups
+#include <vector>       // For the group tree
+
+#include "ProcessTable.h" // Include process handles and SimTime
+#include "ReadyQueue.h" // Include ReadyQueue interface
+#include "RunStatistics.h" // Include LogHistogram
+
+using namespace std;
+
+// ========================================================================================
+// GROUP CONFIGURATION
+// ========================================================================================
+
+/**
+ * Group Specification
+ * Declared settings of one group
+ */
+struct GroupSpec {
+    string path;                            // Path from the root, components separated by '/'
+    int weight = 1024;                      // Share relative to the sibling groups
+    SimTime quota = 0;                      // CPU time allowed per period (0 = unlimited)
+    SimTime period = 100;                   // Bandwidth period
+};
+
+/**
+ * Group Hierarchy
+ *
+ * Immutable-once-built set of declared groups, shared by every scheduler of
+ * a run. Groups that processes name without a declaration, including the
+ * parents of declared groups, get the default weight and no quota.
+ *
+ * File format: one group per line, "path,weight[,quota=N][,period=N]";
+ * empty lines and '#' comments are skipped.
+ */
+class GroupHierarchy {
+private:
+    vector<GroupSpec> groups;               // Declared groups in declaration order
+
+public:
+    static constexpr int DEFAULT_WEIGHT = 1024;         // Weight of undeclared groups
+    static constexpr SimTime DEFAULT_PERIOD = 100;      // Period of a quota without one
+
+    /**
+     * Add Group
+     *
+     * @param spec - Group settings (the path must not be empty)
+     * @return False if the settings are invalid or the path was declared before
+     */
+    bool add(const GroupSpec& spec);
+
+    /**
+     * Find Group
+     *
+     * @param path - Group path
+     * @return Declared settings (nullptr if the group was not declared)
+     */
+    const GroupSpec* find(string_view path) const;
+
+    /**
+     * Get Groups
+     *
+     * @return Declared groups in declaration order
+     */
+    const vector<GroupSpec>& getGroups() const { return groups; }
+
+    /**
+     * Load Hierarchy
+     *
+     * @param path - Group file
+     * @return Loaded hierarchy (nullptr on error)
+     */
+    static shared_ptr<GroupHierarchy> load(const string& path);
+};
+
+// ========================================================================================
+// GROUP STATISTICS
+// ========================================================================================
+
+/**
+ * Group Statistics
+ * Metrics of one group over a run; every figure covers the whole subtree
+ */
+struct GroupStatistics {
+    string path;                            // Group path ("" for the root group)
+    int depth = 0;                          // Levels below the root
+    int weight = GroupHierarchy::DEFAULT_WEIGHT;    // Share relative to the siblings
+    SimTime quota = 0;                      // CPU time per period (0 = unlimited)
+    SimTime period = 0;                     // Bandwidth period
+    SimTime runTime = 0;                    // CPU time the processes received
+    double utilisation = 0.0;               // Run time over the makespan times the CPU count
+    SimTime throttledTime = 0;              // Time ready processes waited for the quota
+    long long throttles = 0;                // Times the group started waiting for its quota
+    LogHistogram waiting;                   // Waiting time of the completed processes
+    LogHistogram response;                  // Response time of the completed processes
+    LogHistogram turnaround;                // Turnaround time of the completed processes
+};
+
+// ========================================================================================
+// PROCESS GROUPS (PER-RUN STATE)
+// ========================================================================================
+
+class GroupReadyQueue;
+
+/**
+ * Process Groups
+ *
+ * The group tree of one scheduler: membership of the processes, quota
+ * bookkeeping and statistics. Nodes are created from the hierarchy on
+ * reset() and for undeclared paths the first time a process names them.
+ *
+ * Quotas are handed out as grants: a CPU that dispatches a process takes
+ * its slice from the pool of every limited group on the process's path, and
+ * returns what it did not use when the process leaves the CPU. A grant never
+ * runs past the end of its period. A group whose pool is empty is throttled:
+ * its processes stay queued but cannot be selected until the pool refills.
+ */
+class ProcessGroups {
+public:
+    using RefillCallback = function<void(SimTime, uint32_t)>;
+
+    static constexpr uint32_t ROOT = 0;     // Node of the root group
+
+private:
+    /**
+     * Group Node
+     */
+    struct Node {
+        string path;                        // Group path
+        uint32_t parent = ROOT;             // Parent node (ROOT for the root itself)
+        int depth = 0;                      // Levels below the root
+        int weight = GroupHierarchy::DEFAULT_WEIGHT;    // Share relative to the siblings
+        SimTime quota = 0;                  // CPU time per period (0 = unlimited)
+        SimTime period = 0;                 // Bandwidth period
+        SimTime pool = 0;                   // Quota left to grant in the current period
+        SimTime periodIndex = -1;           // Period the pool belongs to
+        int grants = 0;                     // CPUs holding a grant of this group
+        long long waiting = 0;              // Queued processes in the subtree
+        bool throttled = false;             // Whether the pool is empty
+        bool refillPending = false;         // Whether a refill is scheduled
+        SimTime heldSince = -1;             // Start of the current throttled wait (-1 if none)
+        SimTime runTime = 0;                // Statistics, see GroupStatistics
+        SimTime throttledTime = 0;
+        long long throttles = 0;
+        LogHistogram waitingTimes;
+        LogHistogram responseTimes;
+        LogHistogram turnaroundTimes;
+    };
+
+    /**
+     * CPU Grant
+     * Quota taken by the process running on a CPU
+     */
+    struct Grant {
+        uint32_t node = ROOT;               // Group of the process
+        SimTime amount = 0;                 // Quota not used yet
+        SimTime start = 0;                  // Time the grant starts
+        bool active = false;                // Whether the CPU holds a grant
+    };
+
+    shared_ptr<const GroupHierarchy> hierarchy; // Declared groups
+    const ProcessTable& table;              // Source of the process group ids
+    const SimTime& clock;                   // Current simulated time of the scheduler
+    vector<Node> nodes;                     // Group tree, parents before children
+    vector<uint32_t> nodeOfPath;            // Node of each workload group path id
+    const Workload* mappedWorkload;         // Workload nodeOfPath was built for
+    vector<Grant> grants;                   // Grant of each CPU
+    vector<GroupReadyQueue*> queues;        // Queues to tell about throttling
+    RefillCallback scheduleRefill;          // Schedules the refill of a throttled group
+    bool limited;                           // Whether any group has a quota
+
+    /**
+     * Find or Create Node
+     * Creates the missing groups of the path, parents first
+     *
+     * @param path - Group path
+     * @return Node of the group
+     */
+    uint32_t resolve(string_view path);
+
+    /**
+     * Refresh Pool
+     * Refills the pool of a limited group when time has moved past its period
+     *
+     * @param node - Limited group
+     * @param time - Current time
+     */
+    void refresh(uint32_t node, SimTime time);
+
+    /**
+     * Set Throttled
+     * Updates the flag and the queues, and schedules the refill of a newly
+     * throttled group
+     */
+    void setThrottled(uint32_t node, bool throttled);
+
+    /**
+     * Update Held Time
+     * A group is held while it is throttled, has ready processes and no CPU
+     * uses its quota any more
+     */
+    void updateHeld(uint32_t node);
+
+public:
+    /**
+     * Process Groups Constructor
+     *
+     * @param groups - Declared groups
+     * @param processTable - Table of the scheduler
+     * @param currentTime - Clock of the scheduler
+     */
+    ProcessGroups(shared_ptr<const GroupHierarchy> groups, const ProcessTable& processTable,
+                  const SimTime& currentTime);
+
+    ProcessGroups(const ProcessGroups&) = delete;
+    ProcessGroups& operator=(const ProcessGroups&) = delete;
+
+    /**
+     * Reset
+     * Rebuilds the tree from the hierarchy for a new run
+     *
+     * @param cpuCount - Simulated CPUs
+     */
+    void reset(int cpuCount);
+
+    /**
+     * Set Refill Callback
+     *
+     * @param callback - Called with the refill time and the node of a throttled group
+     */
+    void setRefillCallback(RefillCallback callback) { scheduleRefill = std::move(callback); }
+
+    /**
+     * Get Hierarchy
+     *
+     * @return Declared groups
+     */
+    shared_ptr<const GroupHierarchy> getHierarchy() const { return hierarchy; }
+
+    /**
+     * Get Node of Process
+     *
+     * @param process - Process handle
+     * @return Node of the process's group
+     */
+    uint32_t nodeOf(ProcessHandle process) {
+        uint32_t id = table.group(process);
+        if (id >= nodeOfPath.size() || mappedWorkload != &table.getWorkload()) {
+            return resolveProcess(process);
+        }
+        return nodeOfPath[id];
+    }
+
+    /**
+     * Resolve Process
+     * Slow path of nodeOf(): maps the workload's group paths not seen yet
+     *
+     * @param process - Process handle
+     * @return Node of the process's group
+     */
+    uint32_t resolveProcess(ProcessHandle process);
+
+    size_t size() const { return nodes.size(); }
+    uint32_t parentOf(uint32_t node) const { return nodes[node].parent; }
+    int weightOf(uint32_t node) const { return nodes[node].weight; }
+    bool isThrottled(uint32_t node) const { return nodes[node].throttled; }
+
+    /**
+     * Is Process Throttled
+     *
+     * @param process - Process handle
+     * @return True if the process's group or one of its parents is throttled
+     */
+    bool isProcessThrottled(ProcessHandle process);
+
+    /**
+     * Same Group
+     *
+     * @return True if both processes belong to the same group
+     */
+    bool sameGroup(ProcessHandle a, ProcessHandle b) { return nodeOf(a) == nodeOf(b); }
+
+    /**
+     * Register Queue
+     *
+     * @param queue - Queue to tell about throttling changes
+     */
+    void registerQueue(GroupReadyQueue* queue);
+
+    /**
+     * Unregister Queue
+     *
+     * @param queue - Queue being destroyed
+     */
+    void unregisterQueue(GroupReadyQueue* queue);
+
+    /**
+     * Change Waiting
+     * Called by the queues when processes join or leave them
+     *
+     * @param node - Group of the processes
+     * @param delta - Change of the queued process count
+     */
+    void changeWaiting(uint32_t node, long long delta);
+
+    /**
+     * Grant Time Slice
+     * Bounds a slice by the quota left on the process's path and takes it
+     * from the pools; a CPU's previous grant is returned first
+     *
+     * @param cpu - CPU the process runs on
+     * @param process - Process starting a slice
+     * @param slice - Slice the policy asked for
+     * @param start - Time the slice starts (after the dispatch overhead)
+     * @return Granted slice (at most slice)
+     */
+    SimTime grant(int cpu, ProcessHandle process, SimTime slice, SimTime start);
+
+    /**
+     * Charge
+     * Accounts CPU time used by the process on a CPU
+     *
+     * @param cpu - CPU the process ran on
+     * @param process - Process that ran
+     * @param elapsed - CPU time used
+     */
+    void charge(int cpu, ProcessHandle process, SimTime elapsed);
+
+    /**
+     * Release Grant
+     * Returns the unused part of a CPU's grant to the pools
+     *
+     * @param cpu - CPU whose process left it
+     */
+    void release(int cpu);
+
+    /**
+     * Refill
+     * Handles the refill event of a throttled group
+     *
+     * @param node - Group to refill
+     */
+    void refill(uint32_t node);
+
+    /**
+     * Record Completion
+     *
+     * @param process - Terminated process
+     * @param waiting - Its waiting time
+     * @param response - Its response time
+     * @param turnaround - Its turnaround time
+     */
+    void recordCompletion(ProcessHandle process, SimTime waiting, SimTime response, SimTime turnaround);
+
+    /**
+     * Get Statistics
+     *
+     * @param makespan - Length of the run
+     * @param cpuCount - Simulated CPUs
+     * @return Metrics of every group, in tree order
+     */
+    vector<GroupStatistics> getStatistics(SimTime makespan, int cpuCount) const;
+};
+
+// ========================================================================================
+// GROUP READY QUEUE
+// ========================================================================================
+
+/**
+ * Group Ready Queue
+ *
+ * Ready queue of a scheduler with process groups. Each group keeps its
+ * processes in a queue of the policy's own kind; each group also keeps an
+ * ordered set of its active entities (child groups, plus its own processes
+ * as one entity) keyed by weighted virtual runtime. top() walks from the
+ * root to the leftmost entity on every level.
+ *
+ * Throttled groups leave their parent's set, so size() only counts processes
+ * that can be selected; collect() still lists every queued process.
+ */
+class GroupReadyQueue : public ReadyQueue {
+public:
+    using QueueFactory = function<unique_ptr<ReadyQueue>()>;
+
+private:
+    static constexpr uint32_t SELF = UINT32_MAX;            // Entity of a group's own processes
+    static constexpr int64_t VRUNTIME_SCALE = int64_t(GroupHierarchy::DEFAULT_WEIGHT) << 10;
+
+    /**
+     * Group Entry
+     * State of one group in this queue
+     */
+    struct Entry {
+        unique_ptr<ReadyQueue> own;         // The group's own processes (created on demand)
+        set<pair<int64_t, uint32_t>> entities;  // Active entities by virtual runtime
+        int64_t vruntime = 0;               // Key of the group in its parent's set
+        int64_t ownVruntime = 0;            // Key of the own entity in this set
+        int64_t minVruntime = 0;            // Floor of entities (re)joining this set
+        size_t eligible = 0;                // Selectable processes in the subtree
+        bool linked = false;                // Whether the group is in its parent's set
+        bool ownLinked = false;             // Whether the own entity is in this set
+    };
+
+    ProcessGroups& groups;                  // Group tree of the scheduler
+    QueueFactory factory;                   // Creates the queue of a group
+    vector<Entry> entries;                  // Entry per group node
+
+    Entry& entry(uint32_t node);
+    ReadyQueue& ownQueue(uint32_t node);
+    void relink(uint32_t node);
+    void relinkOwn(uint32_t node);
+    void addEligible(uint32_t node, int64_t delta);
+    uint32_t selectedNode() const;
+
+public:
+    /**
+     * Group Ready Queue Constructor
+     *
+     * @param processGroups - Group tree of the scheduler
+     * @param order - Ordering of the policy's queues
+     * @param table - Table the queued handles refer to
+     * @param queueFactory - Creates the policy's queue of a group
+     */
+    GroupReadyQueue(ProcessGroups& processGroups, ReadyQueueOrder order, const ProcessTable& table,
+                    QueueFactory queueFactory);
+
+    ~GroupReadyQueue() override;
+
+    void push(ProcessHandle handle) override;
+    ProcessHandle top() const override;
+    ProcessHandle pop() override;
+    size_t size() const override;
+    void clear() override;
+    bool outranks(ProcessHandle a, ProcessHandle b) const override;
+    void collect(vector<ProcessHandle>& out) const override;
+
+    /**
+     * Charge
+     * Advances the virtual runtime of the process's group and its parents
+     *
+     * @param process - Process that ran
+     * @param elapsed - CPU time used
+     */
+    void charge(ProcessHandle process, SimTime elapsed);
+
+    /**
+     * Throttling Changed
+     * Called by ProcessGroups when a group is throttled or unthrottled
+     *
+     * @param node - Group whose flag changed
+     */
+    void throttlingChanged(uint32_t node);
+
+    /**
+     * Get Selected Queue
+     *
+     * @return Policy queue of the group top() and pop() take from
+     */
+    ReadyQueue& getSelectedQueue();
+
+    /**
+     * Get Group Queue
+     *
+     * @param process - Process handle
+     * @return Policy queue of the process's group
+     */
+    ReadyQueue& getGroupQueue(ProcessHandle process);
+
+    /**
+     * For Each Group Queue
+     *
+     * @param visit - Called with every policy queue created so far
+     */
+    void forEachGroupQueue(const function<void(ReadyQueue&)>& visit);
+};
+
+#endif // GROUP_SCHEDULING_H
@@ -0,0 +1,283 @@
+/**
+ * Instrumentation.h - Hot-Path Profiling Counters HEADER FILE
+ *
+ * This header file defines the instrumentation layer of the scheduling
+ * engine: where a run spends its time and how much work it does.
+ * - Per-phase tick counters (arrival admission, event handling, selection,
+ *   dispatch, preemption, statistics and output), read from the processor's
+ *   cycle counter and accounted exclusively, so a phase nested in another
+ *   is not counted twice
+ * - Event counters (steps, events, arrivals, dispatches, preemptions,
+ *   quantum expiries, idle steps) and queue length high-water marks
+ * Counters are reached through a thread-local pointer that a running
+ * scheduler binds to its own ProfileCounters, so the worker threads of a
+ * comparison never share a cache line.
+ *
+ * The engine is only instrumented when the program is built with
+ * SCHEDULER_PROFILING defined. Otherwise the PROFILE_* macros expand to
+ * nothing and the counters of every run stay zero.
+ *
+ */
+
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+#include <cstddef>      // For size_t
+#include <cstdint>      // For counters
+#include <ostream>      // For the JSON dump
+#include <string>       // For labels
+
+#if defined(SCHEDULER_PROFILING) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <x86intrin.h>  // For __rdtsc
+#elif defined(SCHEDULER_PROFILING) && !defined(__aarch64__)
+#include <chrono>       // For the portable fallback clock
+#endif
+
+using namespace std;
+
+// ========================================================================================
+// PHASES AND COUNTERS
+// ========================================================================================
+
+/**
+ * Profile Phase
+ * Part of the engine whose ticks are counted
+ */
+enum class ProfilePhase {
+    ARRIVALS,       // Admitting due processes into the run queues
+    EVENTS,         // Handling completions, expiries, wakeups and releases
+    SELECTION,      // Policy choice of the next process
+    DISPATCH,       // Switch accounting and slice start
+    PREEMPTION,     // Comparing ready processes with running ones
+    STATISTICS,     // Per-completion recording and the end-of-run sums
+    OUTPUT          // Execution trace text and trace records
+};
+
+constexpr size_t PROFILE_PHASE_COUNT = 7;
+
+/**
+ * Profile Counter
+ */
+enum class ProfileCounter {
+    STEPS,              // Event loop iterations (one per distinct time)
+    EVENTS,             // Events handled
+    STALE_EVENTS,       // Slice-end events skipped after a preemption
+    ARRIVALS,           // Processes and periodic jobs admitted
+    DISPATCHES,         // Processes put on a CPU
+    PREEMPTIONS,        // Running processes displaced by a better one
+    QUANTUM_EXPIRIES,   // Time slices used up
+    IDLE_STEPS          // Steps that ended with a CPU idle
+};
+
+constexpr size_t PROFILE_COUNTER_COUNT = 8;
+
+/**
+ * Get Profile Phase Name
+ *
+ * @param phase - Phase to name
+ * @return Lower-case name used in the JSON dump
+ */
+string profilePhaseToString(ProfilePhase phase);
+
+/**
+ * Get Profile Counter Name
+ *
+ * @param counter - Counter to name
+ * @return Lower-case name used in the JSON dump
+ */
+string profileCounterToString(ProfileCounter counter);
+
+// ========================================================================================
+// PROFILE COUNTERS
+// ========================================================================================
+
+/**
+ * Profile Counters
+ * Everything one run (or a merge of runs) measured
+ */
+struct ProfileCounters {
+    uint64_t phaseTicks[PROFILE_PHASE_COUNT] = {};  // Exclusive ticks per phase
+    uint64_t phaseCalls[PROFILE_PHASE_COUNT] = {};  // Scopes entered per phase
+    uint64_t counters[PROFILE_COUNTER_COUNT] = {};  // Event counters
+    uint64_t runTicks = 0;                  // Ticks of the whole event loop
+    uint64_t nestedTicks = 0;               // Ticks of the scopes inside the open one
+    size_t readyQueueHighWater = 0;         // Longest run queue
+    size_t eventQueueHighWater = 0;         // Most pending events
+
+    /**
+     * Get Counter
+     *
+     * @param counter - Counter to read
+     * @return Its value
+     */
+    uint64_t get(ProfileCounter counter) const { return counters[static_cast<size_t>(counter)]; }
+
+    /**
+     * Get Phase Ticks
+     *
+     * @param phase - Phase to read
+     * @return Exclusive ticks spent in it
+     */
+    uint64_t getTicks(ProfilePhase phase) const { return phaseTicks[static_cast<size_t>(phase)]; }
+
+    /**
+     * Clear
+     * Zeroes every counter and mark
+     */
+    void clear() { *this = ProfileCounters(); }
+
+    /**
+     * Merge
+     * Adds the counters of another run; high-water marks take the maximum
+     *
+     * @param other - Counters to add
+     */
+    void merge(const ProfileCounters& other);
+
+    /**
+     * Print JSON
+     * One object with the phases, counters and high-water marks
+     *
+     * @param output - Destination stream
+     * @param label - Value of the "algorithm" field
+     */
+    void printJson(ostream& output, const string& label) const;
+};
+
+/**
+ * Is Profiling Enabled
+ *
+ * @return Whether the engine was built with SCHEDULER_PROFILING
+ */
+constexpr bool isProfilingEnabled() {
+#ifdef SCHEDULER_PROFILING
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * Get Profile Clock Name
+ *
+ * @return Source of the ticks: "tsc", "cntvct" or "ns"
+ */
+const char* getProfileClockName();
+
+// ========================================================================================
+// SCOPED PROFILING API
+// ========================================================================================
+
+#ifdef SCHEDULER_PROFILING
+
+extern thread_local ProfileCounters* activeProfile;  // Counters of the run on this thread
+
+/**
+ * Read Profile Clock
+ *
+ * @return Current tick count (processor cycles where available)
+ */
+inline uint64_t readProfileClock() {
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t ticks;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    return static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(
+        chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+/**
+ * Profile Binding
+ * Points this thread's counters at a run's ProfileCounters for the
+ * lifetime of the binding, and counts the ticks of that lifetime
+ */
+class ProfileBinding {
+private:
+    ProfileCounters* previous;      // Binding this one replaced
+    uint64_t start;                 // Tick count at construction
+
+public:
+    explicit ProfileBinding(ProfileCounters* counters) : previous(activeProfile), start(readProfileClock()) {
+        activeProfile = counters;
+    }
+    ~ProfileBinding() {
+        if (activeProfile) activeProfile->runTicks += readProfileClock() - start;
+        activeProfile = previous;
+    }
+    ProfileBinding(const ProfileBinding&) = delete;
+    ProfileBinding& operator=(const ProfileBinding&) = delete;
+};
+
+/**
+ * Profile Scope
+ * Adds the ticks of its lifetime, minus those of the scopes nested in it,
+ * to a phase of the bound counters
+ */
+class ProfileScope {
+private:
+    ProfileCounters* target;        // Counters bound when the scope opened (nullptr: none)
+    ProfilePhase phase;             // Phase charged
+    uint64_t outerNested;           // Nested ticks of the enclosing scope so far
+    uint64_t start;                 // Tick count at construction
+
+public:
+    explicit ProfileScope(ProfilePhase scopePhase)
+        : target(activeProfile), phase(scopePhase), outerNested(0), start(0) {
+        if (!target) return;
+        outerNested = target->nestedTicks;
+        target->nestedTicks = 0;
+        start = readProfileClock();
+    }
+    ~ProfileScope() {
+        if (!target) return;
+        uint64_t elapsed = readProfileClock() - start;
+        size_t index = static_cast<size_t>(phase);
+        target->phaseTicks[index] += elapsed - target->nestedTicks;
+        target->phaseCalls[index]++;
+        target->nestedTicks = outerNested + elapsed;
+    }
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+};
+
+/**
+ * Count Profile Event
+ *
+ * @param counter - Counter to increment
+ * @param amount - Increment (default: 1)
+ */
+inline void profileCount(ProfileCounter counter, uint64_t amount = 1) {
+    if (activeProfile) activeProfile->counters[static_cast<size_t>(counter)] += amount;
+}
+
+/**
+ * Raise High-Water Mark
+ *
+ * @param mark - High-water field of ProfileCounters
+ * @param value - Current length
+ */
+inline void profileHighWater(size_t ProfileCounters::* mark, size_t value) {
+    if (activeProfile && value > activeProfile->*mark) activeProfile->*mark = value;
+}
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_BIND(counters) ProfileBinding PROFILE_CONCAT(profileBinding, __LINE__)(counters)
+#define PROFILE_SCOPE(phase) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(phase)
+#define PROFILE_COUNT(counter) profileCount(counter)
+#define PROFILE_HIGH_WATER(mark, value) profileHighWater(&ProfileCounters::mark, value)
+
+#else
+
+#define PROFILE_BIND(counters) ((void)0)
+#define PROFILE_SCOPE(phase) ((void)0)
+#define PROFILE_COUNT(counter) ((void)0)
+#define PROFILE_HIGH_WATER(mark, value) ((void)0)
+
+#endif // SCHEDULER_PROFILING
+
+#endif // INSTRUMENTATION_H
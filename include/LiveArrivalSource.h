@@ -0,0 +1,212 @@
+/**
+ * LiveArrivalSource.h - Live Process Submission Feed HEADER FILE
+ *
+ * This header file defines LiveArrivalSource, an ArrivalSource that producer
+ * threads keep feeding while the simulation runs. It turns the simulator into
+ * an online (shadow) scheduler driven by a real job-submission feed:
+ * - Producers submit processes through a lock-free multi-producer,
+ *   single-consumer queue; a submission is one atomic exchange and never
+ *   blocks, waits or fails
+ * - The simulation thread drains the queue into an arrival-ordered buffer and
+ *   advances in lockstep with the feed's clock: it only moves past time T
+ *   once the clock has passed T, so no later submission can arrive before it
+ * - The clock is either virtual (advanced explicitly by the feed) or the wall
+ *   clock (elapsed time since the source was created, scaled to time units)
+ *
+ */
+
+#ifndef LIVE_ARRIVAL_SOURCE_H
+#define LIVE_ARRIVAL_SOURCE_H
+
+#include <atomic>       // For the queue links and the clock
+#include <chrono>       // For the wall clock
+#include <cstdint>      // For counters
+#include <string>       // For clock names
+#include <vector>       // For the arrival buffer
+
+#include "ArrivalSource.h" // Include the arrival source interface
+
+using namespace std;
+
+// ========================================================================================
+// CLOCKS
+// ========================================================================================
+
+/**
+ * Live Clock
+ */
+enum class LiveClock {
+    VIRTUAL,        // Advanced by the feed with advanceClock()
+    WALL            // Host time since the source was created
+};
+
+/**
+ * Get Live Clock Name
+ *
+ * @param clock - Clock to name
+ * @return Command-line name of the clock
+ */
+string liveClockToString(LiveClock clock);
+
+// ========================================================================================
+// LIVE ARRIVAL SOURCE
+// ========================================================================================
+
+/**
+ * Live Arrival Source
+ *
+ * Producer side (any thread): submit(), advanceClock() and close(). The
+ * queue is an intrusive linked list in the style of Vyukov's MPSC queue:
+ * producers swap themselves in at the head, and the consumer follows the
+ * links from the tail, so neither side ever takes a lock.
+ *
+ * Consumer side (the simulation thread): the scheduler calls awaitArrivals()
+ * before every step, which drains the queue and waits until the clock has
+ * passed the step. A process submitted with an arrival time the simulation
+ * has already passed is late; it arrives at the first time still ahead of
+ * the simulation instead, and is counted.
+ *
+ * With the wall clock, submit() stamps the arrival time itself and the
+ * simulation can never run ahead of real time. With the virtual clock, the
+ * arrival times of the submissions are kept, and the feed promises with
+ * advanceClock(T) that nothing will be submitted to arrive before T. The
+ * source cannot be rewound: each run consumes a feed once, and the run
+ * completes after close() once every submitted process has terminated.
+ */
+class LiveArrivalSource : public ArrivalSource {
+private:
+    /**
+     * Queue Node
+     * One submission; the consumer reuses the last node it read as the stub
+     */
+    struct Node {
+        atomic<Node*> next;             // Node submitted after this one
+        ProcessSpec spec;               // Submitted process
+    };
+
+    /**
+     * Buffered Arrival
+     * Drained submission waiting for its arrival time
+     */
+    struct Buffered {
+        SimTime arrivalTime;            // Arrival time after clamping
+        uint64_t sequence;              // Drain order, keeps equal arrivals first-come first-served
+        ProcessSpec spec;               // Submitted process
+
+        bool operator>(const Buffered& other) const {
+            if (arrivalTime != other.arrivalTime) return arrivalTime > other.arrivalTime;
+            return sequence > other.sequence;
+        }
+    };
+
+    // Producer side: written by every producer, on its own cache line
+    alignas(64) atomic<Node*> head;     // Last submitted node
+    alignas(64) atomic<SimTime> virtualTime;  // VIRTUAL: nothing arrives before this
+    alignas(64) atomic<bool> closed;    // Whether the feed has ended
+
+    // Consumer side: only touched by the simulation thread
+    alignas(64) Node* tail;             // Stub node; its successor is the next submission
+    const LiveClock clock;              // Clock the simulation follows
+    const double unitsPerSecond;        // WALL: time units per second of host time
+    const chrono::steady_clock::time_point start;  // WALL: time 0
+    vector<Buffered> buffer;            // Min-heap of drained submissions by arrival time
+    uint64_t received;                  // Submissions drained so far
+    uint64_t late;                      // Submissions that arrived after their time was simulated
+    SimTime granted;                    // Latest time the simulation was allowed to reach
+    bool finished;                      // Whether the consumer has seen close() and drained the queue
+
+    /**
+     * Drain Queue
+     * Moves every linked submission into the arrival buffer
+     */
+    void drain();
+
+public:
+    /**
+     * Live Arrival Source Constructor
+     *
+     * @param liveClock - Clock the simulation follows (default: VIRTUAL)
+     * @param timeScale - WALL: time units per second of host time (default: 1000)
+     */
+    explicit LiveArrivalSource(LiveClock liveClock = LiveClock::VIRTUAL, double timeScale = 1000.0);
+
+    /**
+     * Live Arrival Source Destructor
+     * Frees the submissions that were never consumed
+     */
+    ~LiveArrivalSource() override;
+
+    LiveArrivalSource(const LiveArrivalSource&) = delete;
+    LiveArrivalSource& operator=(const LiveArrivalSource&) = delete;
+
+    /**
+     * Submit Process
+     * Safe to call from any number of threads at once; never blocks
+     *
+     * @param spec - Process to submit (WALL: its arrival time is replaced by the current time)
+     */
+    void submit(ProcessSpec spec);
+
+    /**
+     * Advance Clock
+     * Promises that no later submission arrives before the given time. The
+     * clock never moves backwards; ignored with the wall clock.
+     *
+     * @param time - New virtual time
+     */
+    void advanceClock(SimTime time);
+
+    /**
+     * Close Feed
+     * Ends the feed; call it once every producer has finished submitting
+     */
+    void close();
+
+    /**
+     * Get Clock
+     *
+     * @return Current time of the clock the simulation follows
+     */
+    SimTime getClock() const;
+
+    /**
+     * Get Clock Type
+     *
+     * @return Clock the simulation follows
+     */
+    LiveClock getClockType() const { return clock; }
+
+    /**
+     * Has Next Process
+     *
+     * @return True until the feed is closed and every submission was consumed
+     */
+    bool hasNext() const override;
+
+    /**
+     * Peek Arrival Time
+     *
+     * @return Arrival time of the earliest drained submission (INT64_MAX if none is buffered)
+     */
+    SimTime peekArrivalTime() const override;
+
+    bool next(ProcessSpec& spec) override;
+    bool isLive() const override { return true; }
+    bool awaitArrivals(SimTime time) override;
+
+    /**
+     * Get Received Count
+     *
+     * @return Submissions the simulation thread has drained
+     */
+    uint64_t getReceivedCount() const { return received; }
+
+    /**
+     * Get Late Count
+     *
+     * @return Submissions whose arrival time had already been simulated
+     */
+    uint64_t getLateCount() const { return late; }
+};
+
+#endif // LIVE_ARRIVAL_SOURCE_H
@@ -0,0 +1,315 @@
+#ifndef MLFQ_SCHEDULER_H
+#define MLFQ_SCHEDULER_H
+
+#include "RoundRobinScheduler.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * ========================================================================================
+ * FEEDBACK LEVELS
+ * ========================================================================================
+ *
+ * Feedback Levels
+ *
+ * Per-process MLFQ state: the current level and the remaining time the process
+ * had when it entered that level, so the time used at a level survives being
+ * preempted. Entries are stamped with an epoch; a priority boost or a new run
+ * only bumps the epoch, and stale entries read as level 0 with nothing used.
+ */
+class FeedbackLevels {
+private:
+    vector<uint8_t> level;          // Level per process
+    vector<int> levelStart;         // Remaining time when the process entered its level
+    vector<uint32_t> epoch;         // Epoch the entry was written in
+    uint32_t currentEpoch = 1;      // Entries of older epochs are stale
+
+public:
+    /**
+     * Get Level
+     *
+     * @param handle - Process
+     * @return Current level (0 = highest)
+     */
+    int get(ProcessHandle handle) const {
+        return handle < epoch.size() && epoch[handle] == currentEpoch ? level[handle] : 0;
+    }
+
+    /**
+     * Get Time Used at Level
+     *
+     * @param handle - Process
+     * @param remaining - Process's remaining time now
+     * @return CPU time used since the process entered its level
+     */
+    int used(ProcessHandle handle, int remaining) const {
+        return handle < epoch.size() && epoch[handle] == currentEpoch ? levelStart[handle] - remaining : 0;
+    }
+
+    /**
+     * Is Current
+     *
+     * @param handle - Process
+     * @return True if the process has an entry of the current epoch
+     */
+    bool isCurrent(ProcessHandle handle) const {
+        return handle < epoch.size() && epoch[handle] == currentEpoch;
+    }
+
+    /**
+     * Get Level Start
+     *
+     * @param handle - Process with a current entry
+     * @return Remaining time when the process entered its level
+     */
+    int getLevelStart(ProcessHandle handle) const { return levelStart[handle]; }
+
+    /**
+     * Set Level
+     * Moves a process to a level with a fresh allotment
+     *
+     * @param handle - Process
+     * @param newLevel - Level to enter
+     * @param remaining - Process's remaining time now
+     */
+    void set(ProcessHandle handle, int newLevel, int remaining);
+
+    /**
+     * Touch
+     * Makes a stale entry current (level 0, fresh allotment); current entries are kept
+     *
+     * @param handle - Process
+     * @param remaining - Process's remaining time now
+     */
+    void touch(ProcessHandle handle, int remaining) {
+        if (handle >= epoch.size() || epoch[handle] != currentEpoch) {
+            set(handle, 0, remaining);
+        }
+    }
+
+    /**
+     * Reset All
+     * Every process back to level 0 in O(1)
+     */
+    void resetAll() { ++currentEpoch; }
+};
+
+/**
+ * ========================================================================================
+ * MULTILEVEL READY QUEUE
+ * ========================================================================================
+ *
+ * Multilevel Ready Queue
+ *
+ * One FIFO list per level, linked intrusively through per-process next
+ * pointers, plus a 64-bit bitmap of the non-empty levels. The best process is
+ * the head of the lowest set bit, so top(), push() and pop() are O(1), and a
+ * priority boost splices every list onto level 0 in O(levels).
+ *
+ * Each list is ordered by the time its entries joined the level, so aging
+ * only has to look at list heads.
+ */
+class MultilevelReadyQueue : public ReadyQueue {
+private:
+    FeedbackLevels& levels;                 // Level of each process (owned by the scheduler)
+    const ProcessTable& processes;          // Source of ready-queue entry times
+    vector<ProcessHandle> head;             // First process per level (INVALID_PROCESS if empty)
+    vector<ProcessHandle> tail;             // Last process per level
+    vector<ProcessHandle> next;             // Per process: next process in its level list
+    vector<SimTime> joined;                 // Per process: time it joined its level list
+    uint64_t nonEmpty;                      // Bit l set when level l has processes
+    size_t count;                           // Number of queued processes
+
+    void append(int level, ProcessHandle handle, SimTime time);
+    ProcessHandle popLevel(int level);
+
+public:
+    static constexpr int MAX_LEVELS = 64;
+
+    /**
+     * Multilevel Ready Queue Constructor
+     *
+     * @param levelCount - Number of levels (1 to MAX_LEVELS)
+     * @param feedback - Level of each process
+     * @param table - Table the queued handles refer to
+     */
+    MultilevelReadyQueue(int levelCount, FeedbackLevels& feedback, const ProcessTable& table);
+
+    void push(ProcessHandle handle) override;
+    ProcessHandle top() const override;
+    ProcessHandle pop() override;
+    size_t size() const override;
+    void clear() override;
+
+    /**
+     * Collect Processes
+     * Every level list in turn, from level 0 down
+     */
+    void collect(vector<ProcessHandle>& out) const override;
+
+    /**
+     * Get Join Time
+     *
+     * @param handle - Queued process
+     * @return Time the process joined its level list
+     */
+    SimTime getJoinTime(ProcessHandle handle) const { return joined[handle]; }
+
+    /**
+     * Set Join Time
+     * Used when a snapshot is restored, to keep aging where it was
+     *
+     * @param handle - Queued process
+     * @param time - Time the process joined its level list
+     */
+    void setJoinTime(ProcessHandle handle, SimTime time) { joined[handle] = time; }
+
+    /**
+     * Outranks
+     * A process outranks another if it sits on a higher (lower-numbered) level
+     */
+    bool outranks(ProcessHandle a, ProcessHandle b) const override;
+
+    /**
+     * Boost
+     * Moves every queued process to level 0, keeping level order
+     * (the caller resets the levels themselves)
+     */
+    void boost();
+
+    /**
+     * Age
+     * Promotes by one level every process that has waited at least the
+     * threshold at its level; promoted processes start waiting afresh
+     *
+     * @param now - Current time
+     * @param threshold - Waiting time that earns a promotion
+     * @return Number of promoted processes
+     */
+    int age(SimTime now, SimTime threshold);
+};
+
+/**
+ * ========================================================================================
+ * MULTILEVEL FEEDBACK QUEUE (MLFQ) SCHEDULER
+ * ========================================================================================
+ *
+ * MLFQ Scheduler
+ *
+ * Round Robin on several priority levels. New processes start on level 0;
+ * a process that uses up its level's quantum moves down one level, so
+ * interactive jobs stay on top while CPU-bound jobs sink. Time used at a level
+ * is remembered across preemptions, so a job cannot stay on top by yielding
+ * just before its quantum ends.
+ *
+ * Starvation is prevented twice over:
+ * - Priority boost: every boost interval all processes return to level 0.
+ * - Aging: a process that waited the aging threshold at its level is promoted.
+ *
+ * Characteristics:
+ * - Preemptive (quantum expiry, and arrivals on a higher level)
+ * - Approximates SJF without knowing burst times
+ * - Per-level quantum (default: base quantum doubled on every level)
+ */
+class MLFQScheduler : public RoundRobinScheduler {
+private:
+    vector<int> quanta;             // Time quantum per level
+    SimTime boostInterval;          // Time between priority boosts (0 = never)
+    SimTime agingThreshold;         // Waiting time that earns a promotion (0 = no aging)
+    FeedbackLevels levels;          // Per-process level state
+    int demotions;                  // Demotions of the last run
+    int promotions;                 // Aging promotions of the last run
+    int boosts;                     // Priority boosts of the last run
+
+    MultilevelReadyQueue& levelQueue(int cpu);
+
+public:
+    /**
+     * MLFQ Constructor
+     *
+     * @param levelCount - Number of levels (default: 3, at most 64)
+     * @param baseQuantum - Quantum of level 0; doubled on every lower level (default: 4)
+     * @param boost - Priority boost interval, 0 disables boosting (default: 100)
+     * @param aging - Aging threshold, 0 disables aging (default: 50)
+     */
+    MLFQScheduler(int levelCount = 3, int baseQuantum = 4, SimTime boost = 100, SimTime aging = 50);
+
+    /**
+     * MLFQ Scheduling Algorithm Implementation
+     */
+    bool schedule() override;
+
+    /**
+     * Set Level Quanta
+     * Replaces the per-level quanta; the number of levels follows the list
+     *
+     * @param levelQuanta - Quantum per level, highest level first
+     * @return False if the list is empty, too long or has a non-positive quantum
+     */
+    bool setQuanta(const vector<int>& levelQuanta);
+
+    /**
+     * Get Level Quanta
+     *
+     * @return Quantum per level, highest level first
+     */
+    const vector<int>& getQuanta() const { return quanta; }
+
+    /**
+     * Get Level Count
+     *
+     * @return Number of levels
+     */
+    int getLevelCount() const { return static_cast<int>(quanta.size()); }
+
+    /**
+     * Set Boost Interval
+     *
+     * @param interval - Time between priority boosts (0 = never)
+     */
+    void setBoostInterval(SimTime interval);
+
+    /**
+     * Set Aging Threshold
+     *
+     * @param threshold - Waiting time that earns a promotion (0 = no aging)
+     */
+    void setAgingThreshold(SimTime threshold);
+
+    /**
+     * Get Demotion Count
+     *
+     * @return Demotions in the last run
+     */
+    int getDemotionCount() const { return demotions; }
+
+    /**
+     * Get Promotion Count
+     *
+     * @return Aging promotions in the last run
+     */
+    int getPromotionCount() const { return promotions; }
+
+    /**
+     * Get Boost Count
+     *
+     * @return Priority boosts in the last run
+     */
+    int getBoostCount() const { return boosts; }
+
+protected:
+    friend class Scheduler;     // Its kernel calls the hooks below statically
+    unique_ptr<ReadyQueue> createRunQueue(ReadyQueueOrder order) override;
+    ProcessHandle selectNextProcess(int cpu) override;
+    int getTimeSlice(ProcessHandle process) const override;
+    string getDispatchMessage(ProcessHandle process) const override;
+    void onQuantumExpired(ProcessHandle process, int cpu) override;
+    void onProcessRecycled(ProcessHandle process) override;
+    void savePolicyState(vector<int64_t>& state) const override;
+    void restorePolicyState(const SchedulerSnapshot& source, bool samePolicy) override;
+    SimTime getTimerInterval() const override;
+    void onTimer() override;
+};
+
+#endif // MLFQ_SCHEDULER_H
@@ -13,9 +13,10 @@ using namespace std;
  * 
  * Non-preemptive scheduling algorithm that selects processes based on
  * their priority level. Higher priority processes are executed first.
+ * In preemptive mode a higher priority arrival takes the CPU at once.
  * 
  * Characteristics:
- * - Non-preemptive
+ * - Non-preemptive, or preemptive on arrival
  * - Supports system and user priority levels
  * - Can cause starvation of low-priority processes
  * - Often used in real-time systems
@@ -24,14 +25,26 @@ class PriorityScheduler : public Scheduler {
 public:
     /**
      * Priority Scheduler Constructor
+     * Ready queue is ordered by priority (ties: arrival, then PID)
+     * 
+     * @param preemptive - Preempt for higher priority arrivals (default: false)
      */
-    PriorityScheduler();
+    explicit PriorityScheduler(bool preemptive = false);
 
     /**
      * Priority Scheduling Algorithm Implementation
      * Always selects highest priority process from ready queue
      */
-    void schedule() override;
+    bool schedule() override;
+
+protected:
+    friend class Scheduler;     // Its kernel calls the hooks below statically
+
+    /**
+     * Get Dispatch Message
+     * Includes the priority level in the trace line
+     */
+    string getDispatchMessage(ProcessHandle process) const override;
 };
 
 #endif
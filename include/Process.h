@@ -12,6 +12,8 @@
 #include <iostream>     // For input/output operations
 #include <iomanip>      // For formatted output
 #include <string>       // For string operations
+#include <cstdint>      // For compact enum storage
+#include <vector>       // For the I/O burst sequence
 
 using namespace std;
 
@@ -23,11 +25,11 @@ using namespace std;
  * Process States - Represents the current state of a process in the system
  * Based on the standard 5-state process model used in operating systems
  */
-enum class ProcessState {
+enum class ProcessState : uint8_t {
     NEW,        // Process is being created
     READY,      // Process is waiting to be assigned to a processor
     RUNNING,    // Instructions are being executed
-    WAITING,    // Process is waiting for some event to occur (I/O, etc.)
+    WAITING,    // Process is blocked on an I/O device
     TERMINATED  // Process has finished execution
 };
 
@@ -36,12 +38,24 @@ enum class ProcessState {
  * Lower numeric values represent higher priority
  * Used in priority-based scheduling algorithms
  */
-enum class Priority {
+enum class Priority : uint8_t {
     HIGH = 1,    // Critical system processes
     MEDIUM = 2,  // Normal user processes
     LOW = 3      // Background/batch processes
 };
 
+/**
+ * I/O Burst
+ * One I/O request in a process's burst sequence: after running cpuBefore
+ * units of CPU time since its previous I/O (or since it started), the
+ * process blocks on the device for the given duration
+ */
+struct IoBurst {
+    int cpuBefore;              // CPU time run before the request
+    int duration;               // Time the device needs to serve the request
+    uint16_t device;            // Index of the device serving the request
+};
+
 // ========================================================================================
 // PROCESS CLASS DECLARATION
 // ========================================================================================
@@ -55,7 +69,8 @@ enum class Priority {
  * - Process state and priority
  * - CPU scheduling information
  * - Memory management information (simplified here)
- * - I/O status information (not implemented in this simulation)
+ * - I/O status information (the I/O bursts between CPU bursts)
+ * - Real-time attributes (period and relative deadline of each job)
  */
 class Process {
 private:
@@ -78,6 +93,11 @@ public:
     int arrivalTime;           // Time when process arrives in the system
     int burstTime;            // Total CPU time required by the process
     int remainingTime;        // Remaining CPU time (for preemptive algorithms)
+    vector<IoBurst> ioBursts; // I/O requests between CPU bursts (empty: CPU-bound)
+    
+    // Real-Time Attributes
+    int period;               // Time between releases of a periodic task (0: released once)
+    int relativeDeadline;     // Time after each release the job is due (0: the period, or none)
     
     // Performance Metrics
     int waitingTime;          // Total time spent in ready queue
@@ -85,6 +105,7 @@ public:
     int responseTime;         // Time from arrival to first CPU allocation
     int startTime;            // Time when process first gets CPU
     bool hasStarted;          // Flag to track if process has started execution
+    int readyTime;            // Time the process last entered the ready queue (-1 if not ready)
     
     // ==================================================================================
     // PUBLIC MEMBER FUNCTIONS
@@ -109,7 +130,8 @@ public:
     
     /**
      * Copy Constructor
-     * Creates a copy of an existing process with new PID
+     * Creates a copy of an existing process, PID included, so copying a
+     * process set for another run leaves the PID counter untouched
      * 
      * @param other - Process to copy from
      */
@@ -131,6 +153,18 @@ public:
      */
     void reset();
     
+    /**
+     * Add I/O Burst
+     * Appends an I/O request to the burst sequence. The CPU bursts are what
+     * the I/O requests leave of burstTime: cpuBefore before each request,
+     * and the rest after the last one.
+     * 
+     * @param cpuBefore - CPU time run since the previous request (positive)
+     * @param duration - Time the device needs (positive)
+     * @param device - Device serving the request (default: 0)
+     */
+    void addIoBurst(int cpuBefore, int duration, uint16_t device = 0);
+    
     /**
      * Print Current Process Status
      * Displays current state of the process for debugging
@@ -163,12 +197,40 @@ public:
     
     /**
      * Update Process Statistics
-     * Updates waiting time, turnaround time, and response time
-     * Called when process completes execution
+     * Updates turnaround time and response time
+     * Called when process completes execution. Waiting time is accumulated
+     * by the scheduler from ready-enter/ready-exit timestamps and kept as is.
      * 
      * @param completionTime - Time when process completed
      */
     void updateStatistics(int completionTime);
+    
+    /**
+     * Convert Process State to String
+     * Shared by Process and ProcessView for consistent output
+     * 
+     * @param processState - State to convert
+     * @return String representation of the state
+     */
+    static string stateToString(ProcessState processState);
+    
+    /**
+     * Convert Priority to String
+     * Shared by Process and ProcessView for consistent output
+     * 
+     * @param processPriority - Priority to convert
+     * @return String representation of the priority
+     */
+    static string priorityToString(Priority processPriority);
+    
+    /**
+     * Reset PID Counter
+     * Restarts automatic PID assignment, so a process set built again for
+     * another run gets the same PIDs
+     * 
+     * @param firstPID - PID given to the next constructed process (default: 1)
+     */
+    static void resetPIDCounter(int firstPID = 1);
 
 private:
     // ==================================================================================
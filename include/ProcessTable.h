@@ -0,0 +1,629 @@
+/**
+ * ProcessTable.h - Structure-of-Arrays Process Table HEADER FILE
+ *
+ * This header file defines the contiguous process storage used by the
+ * scheduling engine. Instead of one heap-allocated Process object per job,
+ * every attribute lives in its own array and processes are referred to by
+ * 32-bit handles (their row index):
+ * - Workload: static input attributes (name, PID, arrival, burst, priority,
+ *   I/O bursts, period, deadline and process group)
+ * - ProcessTable: per-run state and metrics over a workload
+ * - ProcessView: thin read-only view of one row with the familiar
+ *   printStatus()/getProcessInfo() API of the Process class
+ *
+ */
+
+#ifndef PROCESS_TABLE_H
+#define PROCESS_TABLE_H
+
+#include <cstdint>          // For fixed-width handle types
+#include <vector>           // For column storage
+#include <memory>           // For smart pointers
+#include <string>           // For string operations
+#include <string_view>      // For non-owning name access
+#include <unordered_map>    // For string interning
+#include <unordered_set>    // For duplicate PID detection
+
+#include "Process.h"        // Include ProcessState and Priority definitions
+
+using namespace std;
+
+// ========================================================================================
+// TYPE DEFINITIONS
+// ========================================================================================
+
+using SimTime = int64_t;                                // Simulated time (time units)
+using ProcessHandle = uint32_t;                         // Row index into the process table
+constexpr ProcessHandle INVALID_PROCESS = UINT32_MAX;   // Handle meaning "no process"
+constexpr SimTime NO_DEADLINE = INT64_MAX;              // Absolute deadline of a process without one
+
+/**
+ * Process Specification
+ * Plain description of a process to be added to a workload
+ */
+struct ProcessSpec {
+    string name;                            // Human-readable process name
+    SimTime arrivalTime = 0;                // Time when process arrives in the system
+    int burstTime = 1;                      // Total CPU time required by the process
+    Priority priority = Priority::MEDIUM;   // Process priority level
+    int pid = -1;                           // Explicit PID (-1 assigns the next free PID)
+    vector<IoBurst> ioBursts;               // I/O requests between CPU bursts (empty: CPU-bound)
+    int period = 0;                         // Time between releases of a periodic task (0: released once)
+    int relativeDeadline = 0;               // Time after each release the job is due (0: the period, or none)
+    string group;                           // Process group path such as "tenantA/batch" (empty: root group)
+};
+
+// ========================================================================================
+// STRING POOL
+// ========================================================================================
+
+/**
+ * String Pool
+ *
+ * Interns process names into large shared character blocks so each process
+ * only stores a 32-bit name id. Identical names share storage. Bulk loaders
+ * can append strings without hashing them; the lookup index then catches up
+ * on the next intern() call.
+ */
+class StringPool {
+private:
+    static constexpr size_t BLOCK_SIZE = 64 * 1024;     // Bytes per storage block
+
+    vector<unique_ptr<char[]>> blocks;      // Stable character storage
+    size_t blockUsed;                       // Bytes used in the last block
+    vector<string_view> strings;            // Interned strings by id
+    unordered_map<string_view, uint32_t> index;  // Reverse lookup for interning
+    size_t indexedCount;                    // Strings already entered in the index
+
+    /**
+     * Store String
+     * Copies the characters into block storage
+     *
+     * @param text - String to copy
+     * @return View of the stored copy
+     */
+    string_view store(string_view text);
+
+public:
+    StringPool();
+    StringPool(const StringPool& other);
+    StringPool& operator=(const StringPool& other);
+
+    /**
+     * Intern String
+     * Returns the id of the string, storing it if not seen before
+     *
+     * @param text - String to intern
+     * @return Id of the interned string
+     */
+    uint32_t intern(string_view text);
+
+    /**
+     * Append String
+     * Stores the string under a new id without looking for an existing copy
+     *
+     * @param text - String to store
+     * @return Id of the stored string
+     */
+    uint32_t append(string_view text);
+
+    /**
+     * Reserve Capacity
+     *
+     * @param count - Expected number of strings
+     */
+    void reserve(size_t count);
+
+    /**
+     * Get String
+     *
+     * @param id - Id returned by intern()
+     * @return View of the interned string (valid for the pool's lifetime)
+     */
+    string_view get(uint32_t id) const;
+
+    /**
+     * Get Pool Size
+     *
+     * @return Number of distinct strings
+     */
+    size_t size() const;
+};
+
+// ========================================================================================
+// WORKLOAD (STATIC PROCESS ATTRIBUTES)
+// ========================================================================================
+
+/**
+ * Workload
+ *
+ * Append-only column store of the static process attributes. A workload can
+ * be shared read-only between several schedulers; each scheduler keeps its
+ * own ProcessTable with the per-run state.
+ */
+class Workload {
+    friend class WorkloadLoader;            // Bulk loads fill the columns directly
+
+private:
+    StringPool names;                       // Interned process names
+    StringPool groupPaths;                  // Interned process group paths (id 0 is the root group "")
+    unordered_set<int> usedPids;            // PID set, built only once PIDs stop increasing
+    int nextPid;                            // Next automatically assigned PID
+    int maxPid;                             // Largest PID in the workload
+    bool sortedByArrival;                   // Whether rows are in arrival order
+
+    /**
+     * Add Row
+     * Shared implementation of add(); loaders skip name interning for speed
+     *
+     * @param internName - Share storage with an identical existing name
+     * @return Handle of the new process (INVALID_PROCESS on duplicate PID)
+     */
+    ProcessHandle addRow(string_view name, SimTime arrival, int burst,
+                         Priority prio, int explicitPid, bool internName);
+
+    /**
+     * Check I/O Bursts
+     * A sequence is valid if every request has positive times and the CPU
+     * time before the requests leaves a positive final CPU burst
+     *
+     * @param bursts - First request
+     * @param count - Number of requests
+     * @param burst - Total CPU time of the process
+     * @return True if the sequence is valid
+     */
+    static bool checkIoBursts(const IoBurst* bursts, size_t count, int burst);
+
+public:
+    // ==================================================================================
+    // COLUMNS (indexed by ProcessHandle)
+    // ==================================================================================
+
+    vector<int> pid;                        // Process IDs
+    vector<uint32_t> nameId;                // Interned name ids
+    vector<SimTime> arrivalTime;            // Arrival times
+    vector<int> burstTime;                  // Total CPU time required
+    vector<Priority> priority;              // Priority levels
+
+    // I/O bursts in compressed rows: process h owns ioBursts[ioOffset[h] .. ioOffset[h + 1]).
+    // ioOffset only covers rows up to the last process with I/O and stays empty
+    // for CPU-bound workloads.
+    vector<IoBurst> ioBursts;               // I/O requests of all processes
+    vector<uint32_t> ioOffset;              // Start of each process's requests
+
+    // Real-time attributes, kept sparse the same way: both columns only cover
+    // rows up to the last process with a period or deadline.
+    vector<int> period;                     // Release period (0: released once)
+    vector<int> relativeDeadline;           // Deadline after each release (0: none)
+
+    // Process groups, sparse as well: the column only covers rows up to the
+    // last process outside the root group.
+    vector<uint32_t> group;                 // Interned group path ids (0: root group)
+
+    /**
+     * Workload Constructor
+     * Creates an empty workload
+     */
+    Workload();
+
+    /**
+     * Add Process
+     * Validates and appends a process. Negative arrivals are clamped to 0 and
+     * non-positive bursts to 1, as in the Process constructor.
+     *
+     * @param spec - Process description
+     * @return Handle of the new process (INVALID_PROCESS on duplicate PID)
+     */
+    ProcessHandle add(const ProcessSpec& spec);
+
+    /**
+     * Add Process
+     * Convenience overload taking individual fields
+     */
+    ProcessHandle add(string_view name, SimTime arrival, int burst,
+                      Priority prio = Priority::MEDIUM, int explicitPid = -1);
+
+    /**
+     * Set I/O Bursts
+     * Gives the newest process its I/O burst sequence
+     *
+     * @param handle - Process handle (must be the last row, without I/O yet)
+     * @param bursts - Requests in order
+     * @return False if the handle or the sequence is invalid
+     */
+    bool setIoBursts(ProcessHandle handle, const vector<IoBurst>& bursts);
+
+    /**
+     * Set Timing
+     * Gives a process its period and relative deadline. A periodic process
+     * without an explicit deadline is due at its next release.
+     *
+     * @param handle - Process handle
+     * @param taskPeriod - Time between releases (0: released once)
+     * @param deadline - Time after each release the job is due (0: the period, or none)
+     * @return False if the handle is invalid or a value is negative
+     */
+    bool setTiming(ProcessHandle handle, int taskPeriod, int deadline);
+
+    /**
+     * Set Group
+     * Places a process in a process group. Paths name the groups from the
+     * root down, separated by '/', e.g. "tenantA/batch".
+     *
+     * @param handle - Process handle
+     * @param path - Group path (empty: the root group)
+     * @return False if the handle is invalid or the path has an empty component
+     */
+    bool setGroup(ProcessHandle handle, string_view path);
+
+    /**
+     * Reuse Row
+     * Overwrites a CPU-bound row with another CPU-bound process, e.g. to give
+     * the row of a terminated streamed process to the next arrival. The PID is
+     * not checked against the other rows.
+     *
+     * @param handle - Row to overwrite (without I/O bursts)
+     * @param spec - Process description (without I/O bursts)
+     * @return False if the row or the process has I/O bursts
+     */
+    bool assign(ProcessHandle handle, const ProcessSpec& spec);
+
+    /**
+     * Truncate
+     * Drops every row from count on; automatic PIDs continue after the
+     * largest remaining PID
+     *
+     * @param count - Rows to keep
+     */
+    void truncate(size_t count);
+
+    /**
+     * Get I/O Burst Count
+     *
+     * @param handle - Process handle
+     * @return Number of I/O requests of the process
+     */
+    size_t ioCount(ProcessHandle handle) const {
+        return handle + 1 < ioOffset.size() ? ioOffset[handle + 1] - ioOffset[handle] : 0;
+    }
+
+    /**
+     * Get I/O Burst
+     *
+     * @param handle - Process handle
+     * @param index - Request index (below ioCount())
+     * @return The request
+     */
+    const IoBurst& ioBurst(ProcessHandle handle, size_t index) const {
+        return ioBursts[ioOffset[handle] + index];
+    }
+
+    /**
+     * Has I/O
+     *
+     * @return True if any process has I/O bursts
+     */
+    bool hasIo() const { return !ioBursts.empty(); }
+
+    /**
+     * Get Period
+     *
+     * @param handle - Process handle
+     * @return Release period of the process (0 if it is released once)
+     */
+    int periodOf(ProcessHandle handle) const {
+        return handle < period.size() ? period[handle] : 0;
+    }
+
+    /**
+     * Get Relative Deadline
+     *
+     * @param handle - Process handle
+     * @return Deadline after the release (0 if the process has none)
+     */
+    int deadlineOf(ProcessHandle handle) const {
+        return handle < relativeDeadline.size() ? relativeDeadline[handle] : 0;
+    }
+
+    /**
+     * Has Deadlines
+     *
+     * @return True if any process has a period or a deadline
+     */
+    bool hasDeadlines() const { return !relativeDeadline.empty(); }
+
+    /**
+     * Get Group
+     *
+     * @param handle - Process handle
+     * @return Group path id of the process (0 for the root group)
+     */
+    uint32_t groupOf(ProcessHandle handle) const {
+        return handle < group.size() ? group[handle] : 0;
+    }
+
+    /**
+     * Get Group Path
+     *
+     * @param id - Group path id returned by groupOf()
+     * @return Path of the group ("" for the root group)
+     */
+    string_view groupPath(uint32_t id) const {
+        return id == 0 ? string_view() : groupPaths.get(id);
+    }
+
+    /**
+     * Get Group Path Count
+     *
+     * @return Number of group path ids, including the root group
+     */
+    size_t groupPathCount() const { return groupPaths.size() > 0 ? groupPaths.size() : 1; }
+
+    /**
+     * Has Groups
+     *
+     * @return True if any process is outside the root group
+     */
+    bool hasGroups() const { return !group.empty(); }
+
+    /**
+     * Is Valid Group Path
+     *
+     * @param path - Group path
+     * @return True if the path is empty or has no empty component
+     */
+    static bool isValidGroupPath(string_view path);
+
+    /**
+     * Parse I/O Burst
+     * Reads a request written as "cpuBefore:duration" or "cpuBefore:duration@device"
+     *
+     * @param token - Request text
+     * @param burst - Receives the request
+     * @return True if the whole token is a valid request
+     */
+    static bool parseIoBurst(string_view token, IoBurst& burst);
+
+    /**
+     * Reserve Capacity
+     * Pre-allocates all columns for the given number of processes
+     *
+     * @param capacity - Expected number of processes
+     */
+    void reserve(size_t capacity);
+
+    /**
+     * Get Process Count
+     *
+     * @return Number of processes in the workload
+     */
+    size_t size() const;
+
+    /**
+     * Get Process Name
+     *
+     * @param handle - Process handle
+     * @return Name of the process
+     */
+    string_view name(ProcessHandle handle) const;
+
+    /**
+     * Is Sorted By Arrival
+     *
+     * @return True if rows were appended in non-decreasing arrival order
+     */
+    bool isSortedByArrival() const;
+
+    /**
+     * Get Arrival Order
+     * Returns all handles ordered by arrival time (stable for equal arrivals)
+     *
+     * @return Handles in arrival order
+     */
+    vector<ProcessHandle> getArrivalOrder() const;
+};
+
+// ========================================================================================
+// PROCESS TABLE (PER-RUN STATE AND METRICS)
+// ========================================================================================
+
+/**
+ * Process Table
+ *
+ * Per-run columns for every process of a workload. Rows are addressed by the
+ * same handles as the workload, so kernels can walk both with plain indices.
+ */
+class ProcessTable {
+private:
+    shared_ptr<const Workload> workload;    // Static attributes of the processes
+
+public:
+    // ==================================================================================
+    // COLUMNS (indexed by ProcessHandle)
+    // ==================================================================================
+
+    vector<int> remainingTime;              // Remaining CPU time
+    vector<ProcessState> state;             // Current process state
+    vector<SimTime> startTime;              // First dispatch time (-1 if not started)
+    vector<SimTime> completionTime;         // Completion time (-1 if not completed)
+    vector<SimTime> waitingTime;            // Accumulated time spent in the ready queue
+    vector<SimTime> readyTime;              // Last ready-queue entry time (-1 if not ready)
+    vector<int16_t> lastCpu;                // CPU the process last ran on (-1 if not started)
+
+    // I/O progress (only sized when the workload has I/O bursts)
+    vector<int> blockAt;                    // Remaining time at which the process blocks next (0: never)
+    vector<uint32_t> ioCursor;              // Next I/O request of the process
+
+    /**
+     * Bind Workload
+     * Attaches the table to a workload and sizes the columns to match it
+     *
+     * @param source - Workload providing the static attributes
+     * @param keepState - Keep existing rows (source is a copy of the current workload)
+     */
+    void bind(shared_ptr<const Workload> source, bool keepState = false);
+
+    /**
+     * Sync Size
+     * Grows the per-run columns after processes were appended to the bound
+     * workload, or shrinks them after it was truncated
+     */
+    void syncSize();
+
+    /**
+     * Reset Row
+     * Returns one process to its initial NEW state, e.g. after its workload
+     * row was reused
+     *
+     * @param handle - Process handle
+     */
+    void resetRow(ProcessHandle handle);
+
+    /**
+     * Reset Rows
+     * Returns every process to its initial NEW state
+     */
+    void reset();
+
+    /**
+     * Get Process Count
+     *
+     * @return Number of rows
+     */
+    size_t size() const;
+
+    /**
+     * Get Bound Workload
+     *
+     * @return Workload providing the static attributes
+     */
+    const Workload& getWorkload() const;
+
+    // ==================================================================================
+    // ROW ACCESSORS
+    // ==================================================================================
+
+    int pid(ProcessHandle handle) const { return workload->pid[handle]; }
+    string_view name(ProcessHandle handle) const { return workload->name(handle); }
+    SimTime arrivalTime(ProcessHandle handle) const { return workload->arrivalTime[handle]; }
+    int burstTime(ProcessHandle handle) const { return workload->burstTime[handle]; }
+    Priority priority(ProcessHandle handle) const { return workload->priority[handle]; }
+    int period(ProcessHandle handle) const { return workload->periodOf(handle); }
+    int relativeDeadline(ProcessHandle handle) const { return workload->deadlineOf(handle); }
+    uint32_t group(ProcessHandle handle) const { return workload->groupOf(handle); }
+    bool hasStarted(ProcessHandle handle) const { return startTime[handle] >= 0; }
+
+    /**
+     * Get Burst Remaining Time
+     *
+     * @param handle - Process handle
+     * @return CPU time left until the process blocks for I/O or terminates
+     */
+    int burstRemaining(ProcessHandle handle) const {
+        return blockAt.empty() ? remainingTime[handle] : remainingTime[handle] - blockAt[handle];
+    }
+
+    /**
+     * Advance I/O
+     * Moves a process past its current I/O request to the next CPU burst
+     *
+     * @param handle - Process handle
+     */
+    void advanceIo(ProcessHandle handle);
+
+    /**
+     * Get Turnaround Time
+     *
+     * @param handle - Process handle
+     * @return Completion minus arrival (0 if not completed)
+     */
+    SimTime turnaroundTime(ProcessHandle handle) const {
+        return completionTime[handle] >= 0 ? completionTime[handle] - arrivalTime(handle) : 0;
+    }
+
+    /**
+     * Get Response Time
+     *
+     * @param handle - Process handle
+     * @return First dispatch minus arrival (-1 if not started)
+     */
+    SimTime responseTime(ProcessHandle handle) const {
+        return startTime[handle] >= 0 ? startTime[handle] - arrivalTime(handle) : -1;
+    }
+
+    /**
+     * Get Absolute Deadline
+     *
+     * @param handle - Process handle
+     * @return Arrival plus relative deadline (NO_DEADLINE if the process has none)
+     */
+    SimTime absoluteDeadline(ProcessHandle handle) const {
+        int deadline = relativeDeadline(handle);
+        return deadline > 0 ? arrivalTime(handle) + deadline : NO_DEADLINE;
+    }
+};
+
+// ========================================================================================
+// PROCESS VIEW
+// ========================================================================================
+
+/**
+ * Process View
+ *
+ * Thin read-only view of one process table row. Provides the same reporting
+ * API as the Process class without materialising a Process object.
+ */
+class ProcessView {
+private:
+    const ProcessTable* table;              // Table the row belongs to
+    ProcessHandle handle;                   // Row index
+
+public:
+    /**
+     * Process View Constructor
+     *
+     * @param processTable - Table holding the process
+     * @param processHandle - Row of the process
+     */
+    ProcessView(const ProcessTable& processTable, ProcessHandle processHandle);
+
+    ProcessHandle getHandle() const { return handle; }
+    int pid() const { return table->pid(handle); }
+    string name() const { return string(table->name(handle)); }
+    ProcessState state() const { return table->state[handle]; }
+    Priority priority() const { return table->priority(handle); }
+    SimTime arrivalTime() const { return table->arrivalTime(handle); }
+    int burstTime() const { return table->burstTime(handle); }
+    int period() const { return table->period(handle); }
+    int relativeDeadline() const { return table->relativeDeadline(handle); }
+    SimTime absoluteDeadline() const { return table->absoluteDeadline(handle); }
+    int remainingTime() const { return table->remainingTime[handle]; }
+    SimTime startTime() const { return table->startTime[handle]; }
+    SimTime waitingTime() const { return table->waitingTime[handle]; }
+    SimTime turnaroundTime() const { return table->turnaroundTime(handle); }
+    SimTime responseTime() const { return table->responseTime(handle); }
+    bool hasStarted() const { return table->hasStarted(handle); }
+
+    /**
+     * Check if Process is Complete
+     *
+     * @return Boolean indicating completion status
+     */
+    bool isComplete() const;
+
+    /**
+     * Print Current Process Status
+     * Same layout as Process::printStatus()
+     */
+    void printStatus() const;
+
+    /**
+     * Get Process Information Summary
+     * Same layout as Process::getProcessInfo()
+     *
+     * @return String containing process summary
+     */
+    string getProcessInfo() const;
+};
+
+#endif // PROCESS_TABLE_H
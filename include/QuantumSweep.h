@@ -0,0 +1,174 @@
+/**
+ * QuantumSweep.h - Round Robin Quantum Sweep HEADER FILE
+ *
+ * This header file defines QuantumSweep, a parameter search mode that runs
+ * Round Robin with a list or range of time quanta over one shared workload,
+ * reports the metrics of every quantum and picks the best one for a chosen
+ * objective.
+ *
+ */
+
+#ifndef QUANTUM_SWEEP_H
+#define QUANTUM_SWEEP_H
+
+#include <memory>       // For smart pointers
+#include <vector>       // For quantum and result storage
+
+#include "Scheduler.h"  // Include SchedulingMetric definition
+#include "ProcessTable.h" // Include shared workload definition
+
+using namespace std;
+
+// ========================================================================================
+// QUANTUM SWEEP RESULT
+// ========================================================================================
+
+/**
+ * Quantum Sweep Result
+ * Metrics of the Round Robin run for one quantum
+ */
+struct QuantumSweepResult {
+    int quantum = 0;                        // Time quantum of the run
+    bool completed = false;                 // Whether the run finished
+    bool pruned = false;                    // Whether the run was stopped early (cannot be the best)
+    double averageWaitingTime = 0.0;        // Mean time spent in the ready queue
+    double averageTurnaroundTime = 0.0;     // Mean completion minus arrival
+    double averageResponseTime = 0.0;       // Mean first dispatch minus arrival
+    long long contextSwitches = 0;          // CPU handed to a different process
+    SimTime totalExecutionTime = 0;         // Time the last process completed
+    SimTime overheadTime = 0;               // CPU time spent on dispatch overhead
+};
+
+// ========================================================================================
+// QUANTUM SWEEP
+// ========================================================================================
+
+/**
+ * Quantum Sweep
+ *
+ * Evaluates Round Robin for every configured quantum in parallel. With early
+ * stopping enabled, each run is given the best objective total found so far
+ * as a cutoff: metric totals only grow during a run, so once a partial total
+ * exceeds it the run cannot win and is abandoned. The best quantum never
+ * exceeds its own final total, so pruning does not change which quantum wins.
+ * Ties are broken in favour of the smaller quantum.
+ */
+class QuantumSweep {
+private:
+    shared_ptr<const Workload> workload;    // Workload shared by every run
+    vector<int> quanta;                     // Quanta to evaluate, in report order
+    SchedulingMetric objective;             // Metric to minimise
+    bool earlyStop;                         // Whether hopeless runs are abandoned
+    size_t threadCount;                     // Worker threads (0 = one per hardware thread)
+    int cpuCount;                           // Simulated CPUs of every run
+    LoadBalancing loadBalancing;            // Load balancing of every run
+    SimTime balanceInterval;                // Interval for LoadBalancing::PERIODIC
+    DispatchCosts dispatchCosts;            // Overhead charged on every dispatch
+    vector<QuantumSweepResult> results;     // Results of the last run()
+    int bestIndex;                          // Index of the best result (-1 if none)
+
+public:
+    /**
+     * Quantum Sweep Constructor
+     *
+     * @param sharedWorkload - Workload every run simulates
+     * @param target - Metric to minimise (default: waiting time)
+     * @param threads - Worker threads (0 = one per hardware thread)
+     */
+    explicit QuantumSweep(shared_ptr<const Workload> sharedWorkload,
+                          SchedulingMetric target = SchedulingMetric::WAITING_TIME,
+                          size_t threads = 0);
+
+    /**
+     * Add Quantum
+     *
+     * @param quantum - Time quantum to evaluate (must be positive)
+     */
+    void addQuantum(int quantum);
+
+    /**
+     * Add Quantum Range
+     * Adds first, first + step, ... up to and including last
+     *
+     * @param first - Smallest quantum
+     * @param last - Largest quantum
+     * @param step - Increment between quanta (default: 1)
+     */
+    void addQuantumRange(int first, int last, int step = 1);
+
+    /**
+     * Set Objective
+     *
+     * @param target - Metric to minimise
+     */
+    void setObjective(SchedulingMetric target);
+
+    /**
+     * Set Early Stop
+     *
+     * @param enabled - Whether runs that cannot beat the best are abandoned (default: on)
+     */
+    void setEarlyStop(bool enabled);
+
+    /**
+     * Set Thread Count
+     *
+     * @param threads - Worker threads (0 = one per hardware thread)
+     */
+    void setThreadCount(size_t threads);
+
+    /**
+     * Set Machine
+     * Simulates every quantum on a multiprocessor (see Scheduler::setCpuCount)
+     *
+     * @param cpus - Number of CPUs
+     * @param strategy - Load balancing strategy (default: global queue)
+     * @param interval - Time between balancing passes for PERIODIC (default: 10)
+     */
+    void setMachine(int cpus, LoadBalancing strategy = LoadBalancing::GLOBAL_QUEUE, SimTime interval = 10);
+
+    /**
+     * Set Dispatch Costs
+     * Charges every run with dispatch overhead (see Scheduler::setDispatchCosts),
+     * so small quanta pay for the extra switches they cause
+     *
+     * @param costs - Context switch, cache warmup and migration costs
+     */
+    void setDispatchCosts(const DispatchCosts& costs);
+
+    /**
+     * Run Sweep
+     * Simulates Round Robin for every quantum
+     *
+     * @return Results in the order the quanta were added
+     */
+    const vector<QuantumSweepResult>& run();
+
+    /**
+     * Get Results
+     *
+     * @return Results of the last run()
+     */
+    const vector<QuantumSweepResult>& getResults() const;
+
+    /**
+     * Get Best Result
+     *
+     * @return Best result of the last run() (nullptr if no run completed)
+     */
+    const QuantumSweepResult* getBest() const;
+
+    /**
+     * Print Sweep Results
+     * Displays one row per quantum and the best quantum for the objective
+     */
+    void printResults() const;
+
+    /**
+     * Print Sweep CSV
+     * Writes a header and one comma-separated row per quantum
+     */
+    void printCsv() const;
+};
+
+#endif // QUANTUM_SWEEP_H
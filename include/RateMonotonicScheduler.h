@@ -0,0 +1,48 @@
+#ifndef RATEMONOTONICSCHEDULER_H
+#define RATEMONOTONICSCHEDULER_H
+
+#include "Scheduler.h"
+#include <iostream>
+#include <memory>
+#include <vector>
+using namespace std;
+
+/**
+ * Rate Monotonic Scheduler
+ * 
+ * Preemptive fixed-priority real-time scheduling algorithm: the shorter a
+ * process's period, the higher its priority. Periodic processes release a
+ * new job every period from the event queue.
+ * 
+ * Characteristics:
+ * - Preemptive: a job of a shorter-period process takes the CPU at once
+ * - Static priorities: every job of a process shares its period's priority
+ * - Optimal among fixed-priority policies for deadlines equal to periods
+ * - Guaranteed below the Liu & Layland bound n(2^(1/n) - 1)
+ * - Aperiodic processes only run when no periodic job is ready
+ */
+class RateMonotonicScheduler : public Scheduler {
+public:
+    /**
+     * Rate Monotonic Scheduler Constructor
+     * Ready queue is ordered by period (ties: arrival, then PID)
+     */
+    RateMonotonicScheduler();
+
+    /**
+     * Rate Monotonic Scheduling Algorithm Implementation
+     * Always selects the ready process with the shortest period
+     */
+    bool schedule() override;
+
+protected:
+    friend class Scheduler;     // Its kernel calls the hooks below statically
+
+    /**
+     * Get Dispatch Message
+     * Includes the period in the trace line
+     */
+    string getDispatchMessage(ProcessHandle process) const override;
+};
+
+#endif
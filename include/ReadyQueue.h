@@ -0,0 +1,405 @@
+/**
+ * ReadyQueue.h - Pluggable Ready Queue HEADER FILE
+ *
+ * This header file defines the ready queue abstraction used by the Scheduler
+ * engine. Policies declare which ordering they need (arrival order, burst time,
+ * priority, remaining time, deadline or period) and the engine stores ready processes in a
+ * container that can return the best candidate without rescanning the queue.
+ *
+ */
+
+#ifndef READY_QUEUE_H
+#define READY_QUEUE_H
+
+#include <vector>       // For heap storage
+#include <memory>       // For smart pointers
+#include <string>       // For string operations
+
+#include "ProcessTable.h" // Include process table and handle definitions
+
+using namespace std;
+
+// ========================================================================================
+// ENUMERATIONS
+// ========================================================================================
+
+/**
+ * Ready Queue Ordering - Key used to pick the next process to dispatch
+ * Ties always break by arrival time and then by PID
+ */
+enum class ReadyQueueOrder {
+    FIFO,            // Order of insertion into the ready queue
+    BURST_TIME,      // Shortest total burst first (SJF)
+    PRIORITY,        // Highest priority (lowest numeric value) first
+    REMAINING_TIME,  // Shortest remaining time first (SRTF)
+    DEADLINE,        // Earliest absolute deadline first (EDF); processes without one go last
+    PERIOD           // Shortest period first (rate monotonic); aperiodic processes go last
+};
+
+/**
+ * Ready Queue Implementation - Container backing the ready queue
+ */
+enum class ReadyQueueKind {
+    FIFO,            // Ring buffer, O(1) push/pop, insertion order only
+    BINARY_HEAP,     // Array-backed binary heap, O(log n) push/pop
+    PAIRING_HEAP,    // Pairing heap, O(1) push, amortised O(log n) pop
+    LINEAR_SCAN      // Unsorted array with a vectorised scan, O(1) push, O(n) pop (small ready sets)
+};
+
+// ========================================================================================
+// PROCESS ORDERING
+// ========================================================================================
+
+/**
+ * Ready Queue Entry
+ * A process handle plus the insertion counter used for FIFO ordering
+ */
+struct ReadyQueueEntry {
+    ProcessHandle handle;           // Ready process
+    long long sequence;             // Insertion counter
+};
+
+/**
+ * Process Ordering Comparator
+ * Returns true when the first entry should be dispatched before the second
+ */
+class ProcessOrdering {
+private:
+    ReadyQueueOrder order;          // Primary key used for comparison
+    const ProcessTable* table;      // Table holding the keyed columns
+
+    int periodKey(ProcessHandle handle) const {
+        int period = table->period(handle);
+        return period > 0 ? period : INT32_MAX;
+    }
+
+public:
+    /**
+     * Comparator Constructor
+     *
+     * @param queueOrder - Primary ordering key
+     * @param processTable - Table the compared handles refer to
+     */
+    ProcessOrdering(ReadyQueueOrder queueOrder, const ProcessTable& processTable);
+
+    /**
+     * Compare Two Entries
+     *
+     * @param a - First entry
+     * @param b - Second entry
+     * @return True if a is dispatched before b
+     */
+    bool operator()(const ReadyQueueEntry& a, const ReadyQueueEntry& b) const;
+
+    /**
+     * Outranks
+     * Compares the primary key only, without tie-breaks. Used to decide
+     * preemption: equal keys never preempt. FIFO ordering never outranks.
+     *
+     * @param a - First process
+     * @param b - Second process
+     * @return True if a's key is strictly better than b's
+     */
+    bool outranks(ProcessHandle a, ProcessHandle b) const;
+
+    /**
+     * Get Ordering Key
+     *
+     * @return Primary ordering key
+     */
+    ReadyQueueOrder getOrder() const;
+
+    /**
+     * Get Process Table
+     *
+     * @return Table the compared handles refer to
+     */
+    const ProcessTable& getTable() const;
+};
+
+// ========================================================================================
+// ABSTRACT READY QUEUE INTERFACE
+// ========================================================================================
+
+/**
+ * Abstract Ready Queue
+ *
+ * Common interface for every ready queue container. top()/pop() always return
+ * the best process according to the queue's ordering.
+ */
+class ReadyQueue {
+protected:
+    ProcessOrdering ordering;       // Ordering used by the container
+    long long nextSequence;         // Counter assigned to pushed entries
+
+public:
+    /**
+     * Ready Queue Constructor
+     *
+     * @param order - Ordering of the queue
+     * @param table - Table the queued handles refer to
+     */
+    ReadyQueue(ReadyQueueOrder order, const ProcessTable& table);
+
+    /**
+     * Virtual Destructor
+     */
+    virtual ~ReadyQueue() = default;
+
+    /**
+     * Push Process
+     * Inserts a process into the ready queue
+     *
+     * @param handle - Process to insert
+     */
+    virtual void push(ProcessHandle handle) = 0;
+
+    /**
+     * Peek Best Process
+     *
+     * @return Best process in the queue (INVALID_PROCESS if empty)
+     */
+    virtual ProcessHandle top() const = 0;
+
+    /**
+     * Pop Best Process
+     * Removes and returns the best process in the queue
+     *
+     * @return Removed process (INVALID_PROCESS if empty)
+     */
+    virtual ProcessHandle pop() = 0;
+
+    /**
+     * Get Queue Size
+     *
+     * @return Number of processes in the queue
+     */
+    virtual size_t size() const = 0;
+
+    /**
+     * Clear Queue
+     * Removes all processes from the queue
+     */
+    virtual void clear() = 0;
+
+    /**
+     * Is Queue Empty
+     *
+     * @return True if no process is ready
+     */
+    bool empty() const;
+
+    /**
+     * Outranks
+     * See ProcessOrdering::outranks(); containers with their own notion of
+     * rank (e.g. feedback levels) override it
+     *
+     * @param a - First process
+     * @param b - Second process
+     * @return True if a's key is strictly better than b's
+     */
+    virtual bool outranks(ProcessHandle a, ProcessHandle b) const;
+
+    /**
+     * Collect Processes
+     * Appends the queued processes in the order they would be dispatched,
+     * leaving the queue unchanged (used to snapshot a run)
+     *
+     * @param out - Receives the processes
+     */
+    virtual void collect(vector<ProcessHandle>& out) const = 0;
+
+    /**
+     * Get Ordering Key
+     *
+     * @return Ordering used by this queue
+     */
+    ReadyQueueOrder getOrder() const;
+};
+
+// ========================================================================================
+// RING BUFFER
+// ========================================================================================
+
+/**
+ * Ring Buffer
+ *
+ * FIFO over a power-of-two array that only ever grows. Unlike a deque it
+ * keeps its storage when cleared, so a queue reused across runs stops
+ * allocating once it has reached its peak size.
+ */
+template <typename T>
+class RingBuffer {
+private:
+    vector<T> slots;                        // Storage (size is zero or a power of two)
+    size_t head = 0;                        // Index of the oldest element
+    size_t count = 0;                       // Stored elements
+
+    void grow() {
+        vector<T> larger(slots.empty() ? 16 : slots.size() * 2);
+        for (size_t i = 0; i < count; ++i) {
+            larger[i] = slots[(head + i) & (slots.size() - 1)];
+        }
+        slots.swap(larger);
+        head = 0;
+    }
+
+public:
+    void push_back(const T& value) {
+        if (count == slots.size()) grow();
+        slots[(head + count) & (slots.size() - 1)] = value;
+        count++;
+    }
+
+    const T& front() const { return slots[head]; }
+    const T& operator[](size_t index) const { return slots[(head + index) & (slots.size() - 1)]; }
+
+    void pop_front() {
+        head = (head + 1) & (slots.size() - 1);
+        count--;
+    }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    void clear() {
+        head = 0;
+        count = 0;
+    }
+};
+
+// ========================================================================================
+// CONCRETE READY QUEUES
+// ========================================================================================
+
+/**
+ * FIFO Ready Queue
+ * Plain insertion-order queue; ignores any ordering key other than FIFO
+ */
+class FifoReadyQueue : public ReadyQueue {
+private:
+    RingBuffer<ProcessHandle> entries;      // Processes in insertion order
+
+public:
+    explicit FifoReadyQueue(const ProcessTable& table);
+
+    void push(ProcessHandle handle) override;
+    ProcessHandle top() const override;
+    ProcessHandle pop() override;
+    size_t size() const override;
+    void clear() override;
+    void collect(vector<ProcessHandle>& out) const override;
+};
+
+/**
+ * Binary Heap Ready Queue
+ * Array-backed implicit binary heap
+ */
+class BinaryHeapReadyQueue : public ReadyQueue {
+private:
+    vector<ReadyQueueEntry> heap;           // Implicit binary heap, best entry at index 0
+
+    void siftUp(size_t index);
+    void siftDown(size_t index);
+
+public:
+    BinaryHeapReadyQueue(ReadyQueueOrder order, const ProcessTable& table);
+
+    void push(ProcessHandle handle) override;
+    ProcessHandle top() const override;
+    ProcessHandle pop() override;
+    size_t size() const override;
+    void clear() override;
+    void collect(vector<ProcessHandle>& out) const override;
+};
+
+/**
+ * Pairing Heap Ready Queue
+ * Multi-way heap with O(1) insertion and amortised O(log n) removal.
+ * Nodes live in a pooled vector and are recycled through a free list.
+ */
+class PairingHeapReadyQueue : public ReadyQueue {
+private:
+    struct Node {
+        ReadyQueueEntry entry;      // Stored process
+        int child;                  // Index of first child (-1 if none)
+        int sibling;                // Index of next sibling (-1 if none)
+    };
+
+    vector<Node> nodes;             // Node pool
+    vector<int> freeNodes;          // Recycled node indices
+    vector<int> mergeBuffer;        // Scratch space for two-pass merging
+    int root;                       // Index of root node (-1 if empty)
+    size_t count;                   // Number of stored processes
+
+    int meld(int a, int b);
+    int mergePairs(int firstSibling);
+
+public:
+    PairingHeapReadyQueue(ReadyQueueOrder order, const ProcessTable& table);
+
+    void push(ProcessHandle handle) override;
+    ProcessHandle top() const override;
+    ProcessHandle pop() override;
+    size_t size() const override;
+    void clear() override;
+    void collect(vector<ProcessHandle>& out) const override;
+};
+
+/**
+ * Linear Scan Ready Queue
+ * Keeps the ready processes unsorted, with the full ordering of each one
+ * packed into two contiguous key columns, and finds the best one with a
+ * vectorised argmin over the keys. Pushes are O(1) and a pop scans every
+ * entry, so it only beats the default binary heap while a few dozen
+ * processes are ready (the pairing heap is faster at any queue length);
+ * the result is cached between pops, so top() is O(1) after the
+ * first call. Absolute deadlines need the whole key word, so createReadyQueue()
+ * backs DEADLINE ordering with a binary heap instead.
+ */
+class LinearScanReadyQueue : public ReadyQueue {
+private:
+    vector<int64_t> highKeys;               // Primary key and arrival high bits (the sequence for FIFO)
+    vector<int64_t> lowKeys;                // Arrival low bits and PID (0 for FIFO)
+    vector<ReadyQueueEntry> entries;        // Queued processes, in no particular order
+    mutable size_t best;                    // Index of the best entry (valid if bestKnown)
+    mutable bool bestKnown;                 // Whether best is up to date
+
+    void appendKeys(const ReadyQueueEntry& entry);
+
+public:
+    LinearScanReadyQueue(ReadyQueueOrder order, const ProcessTable& table);
+
+    void push(ProcessHandle handle) override;
+    ProcessHandle top() const override;
+    ProcessHandle pop() override;
+    size_t size() const override;
+    void clear() override;
+    void collect(vector<ProcessHandle>& out) const override;
+};
+
+// ========================================================================================
+// FACTORY
+// ========================================================================================
+
+/**
+ * Create Ready Queue
+ * Builds a ready queue of the requested kind and ordering
+ *
+ * @param kind - Container implementation
+ * @param order - Ordering key
+ * @param table - Table the queued handles refer to
+ * @return Newly created ready queue
+ */
+unique_ptr<ReadyQueue> createReadyQueue(ReadyQueueKind kind, ReadyQueueOrder order,
+                                        const ProcessTable& table);
+
+/**
+ * Get Ready Queue Kind Name
+ *
+ * @param kind - Container implementation
+ * @return Human-readable name
+ */
+string readyQueueKindToString(ReadyQueueKind kind);
+
+#endif // READY_QUEUE_H
@@ -0,0 +1,218 @@
+/**
+ * ReplicationRunner.h - Monte Carlo Replication Runner HEADER FILE
+ *
+ * This header file defines ReplicationRunner, which runs independent seeded
+ * replications of one policy over synthetic workloads on the worker pool and
+ * reports every metric as a mean with a Student-t confidence interval. The
+ * percentile sketches of the replications are merged into one pooled
+ * distribution. With a target width the runner stops adding replications as
+ * soon as the intervals of the average waiting, turnaround and response
+ * times are narrow enough.
+ *
+ */
+
+#ifndef REPLICATION_RUNNER_H
+#define REPLICATION_RUNNER_H
+
+#include <cstdint>      // For seeds
+#include <functional>   // For the scheduler factory
+#include <memory>       // For smart pointers
+#include <string>       // For labels
+#include <vector>       // For sample storage
+
+#include "ComparisonRunner.h"   // Include ComparisonResult definition
+#include "RunStatistics.h"      // Include pooled sketch definition
+#include "WorkloadGenerator.h"  // Include workload shape definition
+
+using namespace std;
+
+// ========================================================================================
+// CONFIDENCE INTERVALS
+// ========================================================================================
+
+/**
+ * Confidence Interval
+ * Mean of a metric over the replications and the half-width of its interval
+ */
+struct ConfidenceInterval {
+    string metric;                  // Metric name
+    double mean = 0.0;              // Mean over the replications
+    double halfWidth = 0.0;         // Interval half-width (infinite with one replication)
+    double standardDeviation = 0.0; // Sample standard deviation over the replications
+
+    double getLow() const { return mean - halfWidth; }
+    double getHigh() const { return mean + halfWidth; }
+
+    /**
+     * Get Relative Half-Width
+     *
+     * @return Half-width over the magnitude of the mean (0 if both are 0)
+     */
+    double getRelativeHalfWidth() const;
+};
+
+/**
+ * Student t Quantile
+ * Two-sided critical value of the t distribution
+ *
+ * @param confidence - Confidence level between 0 and 1, e.g. 0.95
+ * @param degreesOfFreedom - Degrees of freedom (positive)
+ * @return t such that P(|T| <= t) = confidence
+ */
+double studentTQuantile(double confidence, size_t degreesOfFreedom);
+
+// ========================================================================================
+// REPLICATION RUNNER
+// ========================================================================================
+
+/**
+ * Replication Runner
+ *
+ * Replication i simulates the workload shape with its own seed (replication 0
+ * keeps the configured seed), streamed into the run in constant memory.
+ * Workers claim replications from the pool's shared counter and reuse one
+ * pooled scheduler each. The result only depends on the configuration, not on
+ * the thread count or on which worker finished first:
+ * - Replications are folded in index order as soon as all earlier ones are done
+ * - The stopping rule is checked on that prefix, so the runner stops at the
+ *   same replication count a sequential run would
+ * Replications claimed past the stopping point are discarded.
+ *
+ * Runs with different policies but the same shape and seed see identical
+ * arrival and burst streams (common random numbers), so their intervals can
+ * be compared directly.
+ */
+class ReplicationRunner {
+public:
+    static constexpr size_t DEFAULT_MIN_REPLICATIONS = 5;   // Replications before the first stop check
+
+private:
+    function<unique_ptr<Scheduler>()> createScheduler;  // Makes a configured scheduler per worker
+    WorkloadGeneratorOptions shape;             // Workload of replication 0
+    string label;                               // Name in the report
+    size_t minReplications;                     // Replications before stopping is considered
+    size_t maxReplications;                     // Most replications run
+    double targetWidth;                         // Relative half-width to reach (0 = run them all)
+    double confidence;                          // Confidence level of the intervals
+    size_t threadCount;                         // Worker threads (0 = one per hardware thread)
+    vector<vector<double>> samples;             // Per metric: value of each folded replication
+    RunStatistics pooled;                       // Merged sketches of the folded replications
+    long long processCount;                     // Processes completed over the folded replications
+    bool converged;                             // Whether the target width was reached
+    bool failed;                                // Whether a folded replication failed
+
+    /**
+     * Fold Replication
+     * Adds the metrics of the next replication in index order
+     *
+     * @param result - Result of the replication
+     */
+    void fold(const ComparisonResult& result);
+
+    /**
+     * Is Precise
+     *
+     * @return Whether the stopping metrics of the folded replications are within the target width
+     */
+    bool isPrecise() const;
+
+public:
+    /**
+     * Replication Runner Constructor
+     *
+     * @param factory - Creates a configured scheduler (called once per worker)
+     * @param workloadShape - Workload of every replication; only the seed changes
+     * @param threads - Worker threads (0 = one per hardware thread)
+     */
+    ReplicationRunner(function<unique_ptr<Scheduler>()> factory,
+                      const WorkloadGeneratorOptions& workloadShape, size_t threads = 0);
+
+    /**
+     * Set Replications
+     *
+     * @param minimum - Replications before the target width is checked (at least 2)
+     * @param maximum - Most replications run
+     */
+    void setReplications(size_t minimum, size_t maximum);
+
+    /**
+     * Set Target Width
+     *
+     * @param relativeHalfWidth - Stop once every stopping interval's half-width
+     *                            is at most this fraction of its mean (0 = run the maximum)
+     */
+    void setTargetWidth(double relativeHalfWidth);
+
+    /**
+     * Set Confidence
+     *
+     * @param level - Confidence level between 0 and 1 (default: 0.95)
+     */
+    void setConfidence(double level);
+
+    /**
+     * Set Label
+     *
+     * @param name - Name in the report (default: the algorithm name)
+     */
+    void setLabel(const string& name);
+
+    /**
+     * Get Replication Seed
+     *
+     * @param seed - Seed of replication 0
+     * @param index - Replication index
+     * @return Seed of the replication
+     */
+    static uint64_t getReplicationSeed(uint64_t seed, size_t index);
+
+    /**
+     * Run Replications
+     *
+     * @return True if every folded replication completed
+     */
+    bool run();
+
+    /**
+     * Get Replication Count
+     *
+     * @return Replications folded by the last run()
+     */
+    size_t getReplicationCount() const;
+
+    /**
+     * Has Converged
+     *
+     * @return Whether the last run() reached the target width
+     */
+    bool hasConverged() const;
+
+    /**
+     * Get Intervals
+     *
+     * @return One interval per reported metric, in report order
+     */
+    vector<ConfidenceInterval> getIntervals() const;
+
+    /**
+     * Get Pooled Statistics
+     *
+     * @return Sketches of every process of every folded replication
+     */
+    const RunStatistics& getPooledStatistics() const;
+
+    /**
+     * Print Replication Results
+     * Displays the interval of every metric and the pooled percentiles
+     */
+    void printResults() const;
+
+    /**
+     * Print Replication CSV
+     *
+     * @param header - Whether to write the header row first
+     */
+    void printCsv(bool header = true) const;
+};
+
+#endif // REPLICATION_RUNNER_H
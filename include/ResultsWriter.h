@@ -0,0 +1,252 @@
+/**
+ * ResultsWriter.h - Per-Process Results Export HEADER FILE
+ *
+ * This header file defines the streaming writer of per-process results (pid,
+ * arrival, start, completion, waiting, turnaround and response time) and the
+ * reader of its binary format. It replaces the printed per-process tables for
+ * runs too large to print: a scheduler hands every completion to the writer,
+ * which collects the rows into large chunks and encodes and writes the full
+ * chunks on a background thread while the simulation goes on.
+ * - CSV: one text row per process
+ * - Columnar binary: row groups of one array per column, optionally
+ *   compressed by storing every column as zigzag varint deltas
+ *
+ */
+
+#ifndef RESULTS_WRITER_H
+#define RESULTS_WRITER_H
+
+#include <condition_variable>  // For the chunk handoff
+#include <cstdint>      // For fixed-width columns
+#include <deque>        // For the chunks waiting to be written
+#include <fstream>      // For the results file
+#include <memory>       // For chunk ownership
+#include <mutex>        // For the chunk handoff
+#include <string>       // For file paths
+#include <thread>       // For the background writer
+#include <vector>       // For chunks
+
+using namespace std;
+
+// ========================================================================================
+// RESULT ROWS
+// ========================================================================================
+
+/**
+ * Results Format
+ */
+enum class ResultsFormat {
+    CSV,            // Text, one row per process
+    COLUMNAR        // Binary row groups of column arrays
+};
+
+/**
+ * Get Results Format Name
+ *
+ * @param format - Format to name
+ * @return Lower-case format name
+ */
+string resultsFormatToString(ResultsFormat format);
+
+/**
+ * Process Result
+ * Metrics of one terminated process
+ */
+struct ProcessResult {
+    int32_t pid = 0;                // Process ID
+    int64_t arrival = 0;            // Arrival time
+    int64_t start = 0;              // First dispatch time
+    int64_t completion = 0;         // Completion time
+    int64_t waiting = 0;            // Time spent in the ready queue
+    int64_t turnaround = 0;         // Completion minus arrival
+    int64_t response = 0;           // First dispatch minus arrival
+};
+
+// ========================================================================================
+// RESULTS WRITER
+// ========================================================================================
+
+/**
+ * Results Writer
+ *
+ * record() only stores into the chunk being filled. A full chunk is handed
+ * to the background thread and replaced by an empty one from a small pool;
+ * when every chunk of the pool is waiting to be written, record() waits for
+ * the writer, so memory stays bounded however fast the simulation runs.
+ *
+ * Columnar file layout (native byte order, version 1):
+ *   header      magic "OSSRSLTS", version, flags (bit 0: delta compressed),
+ *               column count, then one length-prefixed name per column
+ *   row groups  row count (uint32), then per column its byte length
+ *               (uint64) and data, until end of file
+ * Uncompressed columns are raw arrays (pid int32, the others int64).
+ * Compressed columns hold the first value and then every difference to the
+ * previous row as zigzag LEB128 varints; completion times rise and the other
+ * columns stay small, so most values take one or two bytes.
+ *
+ * A writer is not thread-safe: give every concurrently running scheduler
+ * its own writer.
+ */
+class ResultsWriter {
+private:
+    /**
+     * Chunk
+     * Preallocated block of rows, filled by record() and written as a whole
+     */
+    struct Chunk {
+        vector<ProcessResult> rows;     // Row storage (capacity rows)
+        size_t count = 0;               // Rows used when handed over
+    };
+
+    // Simulation side
+    unique_ptr<Chunk> filling;      // Chunk record() fills
+    size_t used;                    // Rows in the chunk being filled
+    uint64_t submitted;             // Rows handed to the background thread
+
+    // Shared with the background thread
+    mutex lock;                     // Guards the two chunk lists and the flags
+    condition_variable changed;     // Signals a chunk handoff or shutdown
+    deque<unique_ptr<Chunk>> full;  // Chunks waiting to be written, oldest first
+    vector<unique_ptr<Chunk>> spare;    // Written chunks ready for reuse
+    bool stopping;                  // Whether close() asked the thread to finish
+    bool failed;                    // Whether a write failed
+
+    // Background thread
+    thread writer;                  // Encodes and writes full chunks
+    ofstream output;                // Results file
+    string path;                    // Results file path
+    ResultsFormat format;           // Encoding of the file
+    bool compressed;                // COLUMNAR: delta varint columns
+    size_t capacity;                // Rows per chunk
+    string encoded;                 // Encoding buffer of the background thread
+
+    /**
+     * Submit Chunk
+     * Hands the chunk being filled to the background thread
+     */
+    void submitChunk();
+
+    /**
+     * Write Chunks
+     * Body of the background thread
+     */
+    void writeChunks();
+
+    /**
+     * Encode Chunk
+     * Appends the rows of one chunk to the encoding buffer
+     *
+     * @param chunk - Chunk to encode
+     */
+    void encodeChunk(const Chunk& chunk);
+
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 16 * 1024;   // Rows per chunk (896 KiB)
+    static constexpr size_t POOL_SIZE = 4;                  // Chunks in flight at most
+
+    /**
+     * Results Writer Constructor
+     *
+     * @param chunkRows - Rows collected before a chunk is written (default: 16 Ki)
+     */
+    explicit ResultsWriter(size_t chunkRows = DEFAULT_CAPACITY);
+
+    /**
+     * Destructor
+     * Closes the file, writing any pending rows
+     */
+    ~ResultsWriter();
+
+    ResultsWriter(const ResultsWriter&) = delete;
+    ResultsWriter& operator=(const ResultsWriter&) = delete;
+
+    /**
+     * Open Results File
+     * Creates (or truncates) the file, writes its header and starts the
+     * background thread
+     *
+     * @param filePath - Destination file
+     * @param fileFormat - Encoding of the file
+     * @param compress - COLUMNAR: store the columns delta compressed (default: false)
+     * @return True if the file was created
+     */
+    bool open(const string& filePath, ResultsFormat fileFormat, bool compress = false);
+
+    /**
+     * Close Results File
+     * Writes pending rows, stops the background thread and closes the file
+     *
+     * @return True if every row was written
+     */
+    bool close();
+
+    /**
+     * Is Open
+     *
+     * @return Whether a results file is open
+     */
+    bool isOpen() const { return writer.joinable(); }
+
+    /**
+     * Record Result
+     * Hot path: one row store, plus a chunk handoff every capacity rows.
+     * Rows recorded while no file is open are counted but not kept.
+     *
+     * @param result - Metrics of a terminated process
+     */
+    void record(const ProcessResult& result) {
+        filling->rows[used++] = result;
+        if (used == capacity) {
+            submitChunk();
+        }
+    }
+
+    /**
+     * Get Record Count
+     *
+     * @return Rows recorded since open()
+     */
+    uint64_t getRecordCount() const { return submitted + used; }
+
+    /**
+     * Get Format From Path
+     *
+     * @param filePath - Destination file
+     * @return CSV if the path ends in ".csv", COLUMNAR otherwise
+     */
+    static ResultsFormat formatFromPath(const string& filePath);
+};
+
+// ========================================================================================
+// RESULTS READER
+// ========================================================================================
+
+/**
+ * Results Reader
+ *
+ * Offline access to columnar results files. Static helpers in the style of
+ * TraceExporter; errors are reported on cerr.
+ */
+class ResultsReader {
+public:
+    /**
+     * Read Columnar Results
+     *
+     * @param path - Columnar file written by ResultsWriter
+     * @param rows - Receives the rows in file order
+     * @return True if the file was valid
+     */
+    static bool readColumnar(const string& path, vector<ProcessResult>& rows);
+
+    /**
+     * Convert to CSV
+     * Reads a columnar results file and writes it as CSV
+     *
+     * @param inputPath - Columnar file to read
+     * @param outputPath - Destination CSV file
+     * @return True if the conversion succeeded
+     */
+    static bool convertToCsv(const string& inputPath, const string& outputPath);
+};
+
+#endif // RESULTS_WRITER_H
@@ -27,7 +27,6 @@
 class RoundRobinScheduler : public Scheduler {
 private:
     int timeQuantum;        ///< Time slice allocated to each process
-    int quantumRemaining;   ///< Remaining time in current quantum
 
 public:
     /**
@@ -41,7 +40,48 @@ public:
      * Round Robin Scheduling Algorithm Implementation
      * Implements time-sliced preemptive scheduling
      */
-    void schedule() override;
+    bool schedule() override;
+
+    /**
+     * Get Time Quantum
+     * 
+     * @return Time slice allocated to each process
+     */
+    int getTimeQuantum() const;
+
+    /**
+     * Set Time Quantum
+     * Lets one scheduler, and its process table, be reused for several quanta
+     * (MLFQ level quanta are set with setQuanta() instead)
+     * 
+     * @param quantum - Time slice allocated to each process (positive)
+     */
+    void setTimeQuantum(int quantum);
+
+protected:
+    friend class Scheduler;     // Its kernel calls the hooks below statically
+
+    /**
+     * Named Round Robin Constructor
+     * For policies built on the Round Robin quantum (e.g. MLFQ)
+     * 
+     * @param name - Algorithm name
+     * @param quantum - Base time quantum
+     * @param preemptive - Whether better arrivals preempt the running process
+     */
+    RoundRobinScheduler(const string& name, int quantum, bool preemptive);
+
+    /**
+     * Get Time Slice
+     * Every dispatch is limited to one quantum
+     */
+    int getTimeSlice(ProcessHandle process) const override;
+
+    /**
+     * Get Dispatch Message
+     * Dispatches may resume a previously preempted process
+     */
+    string getDispatchMessage(ProcessHandle process) const override;
 };
 
 #endif // ROUND_ROBIN_SCHEDULER_H
@@ -0,0 +1,428 @@
+/**
+ * RunStatistics.h - Streaming Run Statistics HEADER FILE
+ *
+ * This header file defines the online statistics a scheduler keeps while it
+ * runs. Every completion is folded into fixed-size sketches instead of being
+ * stored, so percentiles stay available for runs of hundreds of millions of
+ * processes:
+ * - LogHistogram: log-linear (HDR-style) histogram with bounded relative error
+ * - ThroughputSeries: completions per time window, coarsened as the run grows
+ * - RunStatistics: the histograms of every metric, overall and per priority
+ *   class, plus the throughput series and the deadline lateness of
+ *   real-time jobs
+ * Sketches of independent runs can be merged, e.g. to pool replications that
+ * ran on different threads, and serialized to pool runs of other processes.
+ *
+ */
+
+#ifndef RUN_STATISTICS_H
+#define RUN_STATISTICS_H
+
+#include <cstdint>      // For fixed-width counters
+#include <string>       // For metric names
+#include <vector>       // For bucket storage
+
+#include "ProcessTable.h" // Include SimTime and Priority definitions
+
+using namespace std;
+
+// ========================================================================================
+// SCHEDULING METRICS
+// ========================================================================================
+
+/**
+ * Scheduling Metric
+ * Per-process metrics that can be summed over a run, e.g. for cutoffs or sweeps
+ */
+enum class SchedulingMetric {
+    WAITING_TIME,       // Time spent in the ready queue
+    TURNAROUND_TIME,    // Completion minus arrival
+    RESPONSE_TIME,      // First dispatch minus arrival
+    CONTEXT_SWITCHES    // CPU handed to a different process
+};
+
+/**
+ * Get Scheduling Metric Name
+ *
+ * @param metric - Metric to name
+ * @return Human-readable metric name
+ */
+string schedulingMetricToString(SchedulingMetric metric);
+
+// ========================================================================================
+// LOG-LINEAR HISTOGRAM
+// ========================================================================================
+
+/**
+ * Log-Linear Histogram
+ *
+ * Counts non-negative values in buckets that are exact below 2^SUB_BUCKET_BITS
+ * and then split every power of two into 2^(SUB_BUCKET_BITS - 1) equal
+ * sub-buckets, as in an HDR histogram. A percentile is therefore within
+ * 1 / 2^(SUB_BUCKET_BITS - 1) (under 0.8%) of the exact value, recording is
+ * O(1), and the bucket array only grows up to the largest value recorded
+ * (a few thousand buckets for any 64-bit time). Count, sum, minimum and
+ * maximum are tracked exactly.
+ */
+class LogHistogram {
+public:
+    static constexpr int SUB_BUCKET_BITS = 8;                       // Linear range and precision
+    static constexpr int64_t LINEAR_LIMIT = int64_t(1) << SUB_BUCKET_BITS;
+
+private:
+    vector<uint64_t> counts;    // Samples per bucket
+    uint64_t total;             // Number of samples
+    double sum;                 // Sum of the samples
+    int64_t minValue;           // Smallest sample (0 if empty)
+    int64_t maxValue;           // Largest sample (0 if empty)
+
+    static size_t bucketOf(int64_t value);
+    static int64_t bucketHigh(size_t bucket);
+
+public:
+    LogHistogram();
+
+    /**
+     * Record Value
+     *
+     * @param value - Sample (negative values count as 0)
+     */
+    void record(int64_t value) {
+        if (value < 0) value = 0;
+        size_t bucket = bucketOf(value);
+        if (bucket >= counts.size()) {
+            counts.resize(bucket + 1, 0);
+        }
+        counts[bucket]++;
+        if (total == 0 || value < minValue) minValue = value;
+        if (value > maxValue) maxValue = value;
+        total++;
+        sum += static_cast<double>(value);
+    }
+
+    /**
+     * Merge
+     * Adds the samples of another histogram
+     *
+     * @param other - Histogram to add
+     */
+    void merge(const LogHistogram& other);
+
+    /**
+     * Serialize
+     * Appends the histogram to a byte buffer (native byte order), e.g. to
+     * send it to another process
+     *
+     * @param buffer - Destination buffer
+     */
+    void serialize(string& buffer) const;
+
+    /**
+     * Deserialize
+     * Replaces the contents with those written by serialize()
+     *
+     * @param cursor - Read position, advanced past the data
+     * @param end - End of the buffer
+     * @return False if the data is truncated or malformed
+     */
+    bool deserialize(const char*& cursor, const char* end);
+
+    /**
+     * Clear
+     * Removes every sample
+     */
+    void clear();
+
+    /**
+     * Get Percentile
+     *
+     * @param percentile - Percentile between 0 and 100
+     * @return Largest value equivalent to the sample at that rank, clamped
+     *         to the recorded range (0 if empty)
+     */
+    int64_t getPercentile(double percentile) const;
+
+    uint64_t getCount() const { return total; }
+    double getMean() const { return total > 0 ? sum / static_cast<double>(total) : 0.0; }
+    int64_t getMin() const { return minValue; }
+    int64_t getMax() const { return maxValue; }
+};
+
+// ========================================================================================
+// THROUGHPUT SERIES
+// ========================================================================================
+
+/**
+ * Throughput Series
+ *
+ * Completions per fixed-width time window. The series holds at most a fixed
+ * number of windows: when a completion falls beyond the last one, the window
+ * width doubles and neighbouring windows are added together, so memory stays
+ * bounded however long the run is.
+ */
+class ThroughputSeries {
+private:
+    SimTime initialWidth;       // Width the series starts with
+    SimTime width;              // Current window width
+    size_t windowLimit;         // Most windows kept
+    vector<uint64_t> windows;   // Completions per window
+
+    /**
+     * Coarsen
+     * Doubles the window width, adding neighbouring windows together
+     */
+    void coarsen();
+
+public:
+    static constexpr size_t DEFAULT_WINDOW_LIMIT = 1024;
+
+    /**
+     * Throughput Series Constructor
+     *
+     * @param windowWidth - Initial window width (default: 1)
+     * @param limit - Most windows kept (default: DEFAULT_WINDOW_LIMIT)
+     */
+    explicit ThroughputSeries(SimTime windowWidth = 1, size_t limit = DEFAULT_WINDOW_LIMIT);
+
+    /**
+     * Record Completion
+     *
+     * @param time - Completion time
+     */
+    void record(SimTime time) {
+        size_t window = static_cast<size_t>(time / width);
+        while (window >= windowLimit) {
+            coarsen();
+            window = static_cast<size_t>(time / width);
+        }
+        if (window >= windows.size()) {
+            windows.resize(window + 1, 0);
+        }
+        windows[window]++;
+    }
+
+    /**
+     * Merge
+     * Adds the completions of another series, coarsening to the wider window
+     *
+     * @param other - Series to add
+     */
+    void merge(const ThroughputSeries& other);
+
+    /**
+     * Serialize
+     * Appends the series to a byte buffer (native byte order), e.g. to
+     * send it to another process
+     *
+     * @param buffer - Destination buffer
+     */
+    void serialize(string& buffer) const;
+
+    /**
+     * Deserialize
+     * Replaces the contents with those written by serialize()
+     *
+     * @param cursor - Read position, advanced past the data
+     * @param end - End of the buffer
+     * @return False if the data is truncated or malformed
+     */
+    bool deserialize(const char*& cursor, const char* end);
+
+    /**
+     * Clear
+     * Removes every completion and returns to the initial window width
+     */
+    void clear();
+
+    /**
+     * Set Window Width
+     * Clears the series and starts it over with a new initial width
+     *
+     * @param windowWidth - Initial window width (positive)
+     */
+    void setWindowWidth(SimTime windowWidth);
+
+    SimTime getWindowWidth() const { return width; }
+    const vector<uint64_t>& getWindows() const { return windows; }
+
+    /**
+     * Get Rate
+     *
+     * @param window - Window index
+     * @return Completions per time unit in the window
+     */
+    double getRate(size_t window) const {
+        return static_cast<double>(windows[window]) / static_cast<double>(width);
+    }
+};
+
+// ========================================================================================
+// RUN STATISTICS
+// ========================================================================================
+
+/**
+ * Run Statistics
+ *
+ * Online distribution of the per-process metrics of a run. Each completion
+ * is recorded once, with its final waiting, turnaround and response time,
+ * into the histograms of its priority class; the overall distribution is
+ * the merge of the classes, built when it is asked for.
+ */
+class RunStatistics {
+public:
+    static constexpr int PRIORITY_CLASSES = 3;      // HIGH, MEDIUM, LOW
+    static constexpr int METRICS = 3;               // Waiting, turnaround, response
+
+private:
+    LogHistogram histograms[PRIORITY_CLASSES][METRICS];     // Row = Priority value - 1
+    ThroughputSeries throughput;                            // Completions over time
+    LogHistogram tardiness;                                 // How late the jobs that missed their deadline were
+    LogHistogram slack;                                     // Time to spare of the jobs that met it
+    LogHistogram empty;                                     // Returned for metrics without samples
+
+    static int metricIndex(SchedulingMetric metric);
+
+public:
+    /**
+     * Record Completion
+     *
+     * @param priority - Priority class of the process
+     * @param completionTime - Time the process terminated
+     * @param waiting - Total time spent in the ready queue
+     * @param turnaround - Completion minus arrival
+     * @param response - First dispatch minus arrival
+     */
+    void recordCompletion(Priority priority, SimTime completionTime,
+                          SimTime waiting, SimTime turnaround, SimTime response) {
+        LogHistogram* byClass = histograms[static_cast<int>(priority) - 1];
+        byClass[0].record(waiting);
+        byClass[1].record(turnaround);
+        byClass[2].record(response);
+        throughput.record(completionTime);
+    }
+
+    /**
+     * Record Deadline
+     * Called for every completed job that has a deadline
+     *
+     * @param lateness - Completion minus absolute deadline (positive: missed)
+     */
+    void recordDeadline(SimTime lateness) {
+        if (lateness > 0) {
+            tardiness.record(lateness);
+        } else {
+            slack.record(-lateness);
+        }
+    }
+
+    /**
+     * Merge
+     * Adds the samples of another run
+     *
+     * @param other - Statistics to add
+     */
+    void merge(const RunStatistics& other);
+
+    /**
+     * Serialize
+     * Appends the statistics (every histogram and the throughput series) to a byte buffer (native byte order), e.g. to
+     * send it to another process
+     *
+     * @param buffer - Destination buffer
+     */
+    void serialize(string& buffer) const;
+
+    /**
+     * Deserialize
+     * Replaces the contents with those written by serialize()
+     *
+     * @param cursor - Read position, advanced past the data
+     * @param end - End of the buffer
+     * @return False if the data is truncated or malformed
+     */
+    bool deserialize(const char*& cursor, const char* end);
+
+    /**
+     * Clear
+     * Removes every sample (the throughput window width is kept)
+     */
+    void clear();
+
+    /**
+     * Get Histogram
+     *
+     * @param metric - WAITING_TIME, TURNAROUND_TIME or RESPONSE_TIME
+     * @return Distribution over all processes, merged from the classes
+     *         (empty for CONTEXT_SWITCHES)
+     */
+    LogHistogram get(SchedulingMetric metric) const;
+
+    /**
+     * Get Histogram of a Priority Class
+     *
+     * @param metric - WAITING_TIME, TURNAROUND_TIME or RESPONSE_TIME
+     * @param priority - Priority class
+     * @return Distribution over the processes of that class
+     */
+    const LogHistogram& get(SchedulingMetric metric, Priority priority) const;
+
+    /**
+     * Get Throughput Series
+     *
+     * @return Completions per time window
+     */
+    const ThroughputSeries& getThroughput() const { return throughput; }
+
+    /**
+     * Set Throughput Window
+     *
+     * @param width - Initial window width of the throughput series
+     */
+    void setThroughputWindow(SimTime width) { throughput.setWindowWidth(width); }
+
+    /**
+     * Get Tardiness
+     *
+     * @return Lateness distribution of the jobs that missed their deadline
+     */
+    const LogHistogram& getTardiness() const { return tardiness; }
+
+    /**
+     * Get Slack
+     *
+     * @return Distribution of how early the other deadline jobs completed
+     */
+    const LogHistogram& getSlack() const { return slack; }
+
+    uint64_t getDeadlineCount() const { return tardiness.getCount() + slack.getCount(); }
+    uint64_t getDeadlineMisses() const { return tardiness.getCount(); }
+
+    /**
+     * Get Mean Lateness
+     *
+     * @return Mean of completion minus deadline over the deadline jobs (negative: early)
+     */
+    double getMeanLateness() const;
+
+    /**
+     * Get Maximum Lateness
+     *
+     * @return Largest completion minus deadline (0 without deadline jobs)
+     */
+    SimTime getMaxLateness() const {
+        return tardiness.getCount() > 0 ? tardiness.getMax() : -slack.getMin();
+    }
+
+    /**
+     * Get Completion Count
+     *
+     * @return Number of recorded completions
+     */
+    uint64_t getCount() const {
+        uint64_t count = 0;
+        for (const auto& row : histograms) count += row[0].getCount();
+        return count;
+    }
+};
+
+#endif // RUN_STATISTICS_H
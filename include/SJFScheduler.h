@@ -18,8 +18,12 @@
  * Non-preemptive scheduling algorithm that selects the process with
  * the smallest burst time from the ready queue.
  * 
+ * In preemptive mode it becomes Shortest Remaining Time First (SRTF): the
+ * ready queue is ordered by remaining time and an arrival with less remaining
+ * time than the running process takes the CPU.
+ * 
  * Characteristics:
- * - Non-preemptive
+ * - Non-preemptive (SJF) or preemptive on arrival (SRTF)
  * - Optimal for minimizing average waiting time
  * - Can cause starvation of longer processes
  * - Requires knowledge of burst times (unrealistic in practice)
@@ -28,14 +32,18 @@ class SJFScheduler : public Scheduler {
 public:
     /**
      * SJF Constructor
+     * Ready queue is ordered by burst time, or by remaining time for SRTF
+     * (ties: arrival, then PID)
+     * 
+     * @param preemptive - Run as SRTF (default: false)
      */
-    SJFScheduler();
+    explicit SJFScheduler(bool preemptive = false);
 
     /**
      * SJF Scheduling Algorithm Implementation
      * Always selects the process with the shortest burst time from the ready queue
      */
-    void schedule() override;
+    bool schedule() override;
 };
 
 #endif // SJF_SCHEDULER_H
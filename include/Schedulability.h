@@ -0,0 +1,111 @@
+/**
+ * Schedulability.h - Real-Time Schedulability Analysis HEADER FILE
+ *
+ * This header file defines the offline tests that decide, before anything is
+ * simulated, whether the periodic processes of a workload can always meet
+ * their deadlines under EDF and under rate monotonic scheduling:
+ * - Utilisation and density tests for EDF (exact on one CPU unless a
+ *   deadline is shorter than its period), and the Goossens-Funk-Baruah
+ *   bound for global EDF
+ * - The Liu & Layland utilisation bound and exact response-time analysis for
+ *   rate monotonic on one CPU, and the Andersson-Baruah-Jonsson bound for
+ *   global rate monotonic
+ * The burst time of a periodic process is its worst-case execution time;
+ * I/O and dispatch overhead are not part of the analysis.
+ *
+ */
+
+#ifndef SCHEDULABILITY_H
+#define SCHEDULABILITY_H
+
+#include <string>       // For verdict names
+#include <vector>       // For per-task results
+
+#include "ProcessTable.h" // Include workload definition
+
+using namespace std;
+
+// ========================================================================================
+// ANALYSIS RESULT
+// ========================================================================================
+
+/**
+ * Schedulability Verdict
+ */
+enum class SchedulabilityVerdict {
+    SCHEDULABLE,        // Every deadline is met in the worst case
+    NOT_SCHEDULABLE,    // Some deadline can be missed
+    UNKNOWN             // Only sufficient tests apply, and they fail
+};
+
+/**
+ * Get Schedulability Verdict Name
+ *
+ * @param verdict - Verdict to name
+ * @return Human-readable verdict
+ */
+string schedulabilityVerdictToString(SchedulabilityVerdict verdict);
+
+/**
+ * Task Analysis
+ * Rate monotonic result of one periodic process
+ */
+struct TaskAnalysis {
+    ProcessHandle process = INVALID_PROCESS;    // Periodic process
+    SimTime worstResponse = -1;                 // Worst-case response time (-1 if not analysed or unbounded)
+    bool meetsDeadline = false;                 // Whether worstResponse is within the deadline
+};
+
+/**
+ * Schedulability Report
+ * Results of every test over the periodic processes of a workload
+ */
+struct SchedulabilityReport {
+    int cpuCount = 1;                           // CPUs the tests assume
+    size_t aperiodicDeadlines = 0;              // One-shot processes with a deadline (not analysed)
+    double utilisation = 0.0;                   // Sum of burst / period
+    double density = 0.0;                       // Sum of burst / min(deadline, period)
+    double maxUtilisation = 0.0;                // Largest burst / period of one process
+    bool constrainedDeadlines = false;          // Whether some deadline is shorter than its period
+    SimTime hyperperiod = 0;                    // Least common multiple of the periods (0 if too large)
+    double rateMonotonicBound = 0.0;            // Utilisation bound: Liu & Layland (one CPU) or ABJ
+    SchedulabilityVerdict edf = SchedulabilityVerdict::SCHEDULABLE;
+    string edfTest = "no periodic processes";   // Test that decided the EDF verdict
+    SchedulabilityVerdict rateMonotonic = SchedulabilityVerdict::SCHEDULABLE;
+    string rateMonotonicTest = "no periodic processes";  // Test that decided the rate monotonic verdict
+    bool responseTimesAnalysed = false;         // Whether the tasks carry worst-case response times
+    vector<TaskAnalysis> tasks;                 // Periodic processes, highest rate monotonic priority first
+};
+
+// ========================================================================================
+// ANALYSIS
+// ========================================================================================
+
+/**
+ * Get Hyperperiod
+ * Least common multiple of the periods of the periodic processes
+ *
+ * @param workload - Workload to scan
+ * @param limit - Largest hyperperiod worth computing
+ * @return The hyperperiod (0 without periodic processes or above the limit)
+ */
+SimTime getHyperperiod(const Workload& workload, SimTime limit);
+
+/**
+ * Analyse Schedulability
+ *
+ * @param workload - Workload whose periodic processes are analysed
+ * @param cpus - CPUs sharing one global ready queue (default: 1)
+ * @return Results of every test
+ */
+SchedulabilityReport analyseSchedulability(const Workload& workload, int cpus = 1);
+
+/**
+ * Print Schedulability Report
+ *
+ * @param report - Result of analyseSchedulability()
+ * @param workload - Workload that was analysed (supplies process names)
+ */
+void printSchedulability(const SchedulabilityReport& report, const Workload& workload);
+
+#endif // SCHEDULABILITY_H
@@ -20,9 +20,182 @@
 #include <algorithm>    // For sorting and searching
 
 #include "Process.h"    // Include Process class definition
+#include "ProcessTable.h" // Include structure-of-arrays process storage
+#include "ReadyQueue.h" // Include pluggable ready queue containers
+#include "ArrivalSource.h" // Include streaming arrival sources
+#include "TraceSink.h"  // Include verbosity levels and buffered trace output
+#include "TraceRecorder.h" // Include binary execution trace recording
+#include "ResultsWriter.h" // Include per-process results export
+#include "RunStatistics.h" // Include streaming percentile statistics
+#include "Instrumentation.h" // Include hot-path profiling counters
+#include "GroupScheduling.h" // Include hierarchical process groups
 
 using namespace std;
 
+// ========================================================================================
+// SIMULATION EVENTS
+// ========================================================================================
+
+/**
+ * Simulation Event Types
+ * The discrete-event engine only wakes up when one of these happens
+ */
+enum class EventType {
+    RELEASE,         // Periodic process releases its next job (cpu holds the task index)
+    IO_COMPLETION,   // I/O device finished a request (cpu holds the device index)
+    REFILL,          // Throttled process group starts a new quota period (cpu holds the group node)
+    COMPLETION,      // Running process finished its CPU burst (terminates or blocks for I/O)
+    QUANTUM_EXPIRY,  // Running process used up its time slice
+    BALANCE,         // Periodic load balancing between CPU run queues
+    TIMER            // Periodic policy timer (see getTimerInterval())
+};
+
+/**
+ * Simulation Event
+ * Entry of the engine's event queue, ordered by time, then type, then insertion order.
+ * Arrivals are not events: they are admitted from the sorted arrival cursor. Only
+ * the later jobs of a periodic process are released by RELEASE events.
+ */
+struct SimulationEvent {
+    SimTime time;                   // Simulated time at which the event fires
+    EventType type;                 // What happens at that time
+    ProcessHandle process;          // Process the event refers to
+    int cpu;                        // CPU the event refers to
+    long long sequence;             // Insertion counter (keeps equal events FIFO)
+
+    /**
+     * Event Ordering
+     * Earlier events first; simultaneous events keep insertion order
+     */
+    bool operator>(const SimulationEvent& other) const {
+        if (time != other.time) return time > other.time;
+        if (type != other.type) return type > other.type;
+        return sequence > other.sequence;
+    }
+};
+
+/**
+ * Load Balancing Strategy
+ * How ready processes are shared between the simulated CPUs
+ */
+enum class LoadBalancing {
+    GLOBAL_QUEUE,       // One shared ready queue; any idle CPU takes the next process
+    PERIODIC,           // Per-CPU run queues, evened out at a fixed interval
+    WORK_STEALING       // Per-CPU run queues; an idle CPU steals from the longest queue
+};
+
+/**
+ * Get Load Balancing Name
+ * 
+ * @param strategy - Strategy to name
+ * @return Human-readable strategy name
+ */
+string loadBalancingToString(LoadBalancing strategy);
+
+/**
+ * CPU Statistics
+ * Per-CPU counters of the last run
+ */
+struct CpuStatistics {
+    SimTime busyTime = 0;           // Time spent running processes, dispatch overhead included
+    SimTime overheadTime = 0;       // Part of the busy time spent on dispatch overhead
+    long long dispatches = 0;       // Times a process was given this CPU
+    long long contextSwitches = 0;  // Dispatches of a different process than the last one here
+    long long migrations = 0;       // Dispatches of a process that last ran on another CPU
+    double utilisation = 0.0;       // Busy time over the makespan
+};
+
+/**
+ * Dispatch Costs
+ * Simulated time a CPU spends on a dispatch before the process makes progress.
+ * The costs add up: a process migrating in from another CPU pays all three.
+ */
+struct DispatchCosts {
+    SimTime contextSwitch = 0;      // The CPU changes process (see CpuStatistics::contextSwitches)
+    SimTime cacheWarmup = 0;        // The process was not the last to run on this CPU
+    SimTime migration = 0;          // The process last ran on another CPU
+};
+
+/**
+ * I/O Device Statistics
+ * Per-device counters of the last run
+ */
+struct IoDeviceStatistics {
+    SimTime busyTime = 0;           // Time spent serving requests
+    SimTime queueingTime = 0;       // Time requests waited behind others
+    long long requests = 0;         // Requests served
+    size_t maxQueueLength = 0;      // Longest device queue
+    double utilisation = 0.0;       // Busy time over the makespan
+};
+
+// ========================================================================================
+// SCHEDULER SNAPSHOT
+// ========================================================================================
+
+/**
+ * Scheduler Snapshot
+ *
+ * Complete state of a run at one instant, taken with Scheduler::snapshot().
+ * Ready processes are kept in the order they would have been dispatched, so
+ * a scheduler of any policy can take over from it; the policy's own state
+ * (e.g. CFS virtual runtimes) travels as an opaque block that only the same
+ * algorithm reads back. A snapshot is immutable once taken: one shared_ptr
+ * can seed any number of branches, from any number of threads, and the
+ * workload is shared with them rather than copied.
+ */
+struct SchedulerSnapshot {
+    /**
+     * CPU Snapshot
+     */
+    struct Cpu {
+        ProcessHandle current = INVALID_PROCESS;        // Running process
+        ProcessHandle lastDispatched = INVALID_PROCESS; // Process that last held the CPU
+        SimTime sliceStart = 0;                         // Time accounted up to
+        SimTime overheadEnd = 0;                        // End of the dispatch overhead
+        long long sliceEvent = -1;                      // Sequence of the pending slice-end event
+        CpuStatistics stats;                            // Counters so far
+    };
+    
+    /**
+     * I/O Device Snapshot
+     */
+    struct Device {
+        ProcessHandle current = INVALID_PROCESS;        // Process being served
+        vector<pair<ProcessHandle, SimTime>> queue;     // Waiting requests, oldest first
+        IoDeviceStatistics stats;                       // Counters so far
+    };
+    
+    string algorithm;                         // Algorithm that took the snapshot
+    SimTime time = 0;                         // Everything up to this time has been simulated
+    shared_ptr<const Workload> workload;      // Shared static process attributes
+    ProcessTable table;                       // Per-process remaining time and metrics
+    LoadBalancing loadBalancing = LoadBalancing::GLOBAL_QUEUE;  // Strategy of the run
+    vector<Cpu> cpus;                         // CPU states
+    vector<vector<ProcessHandle>> queues;     // Ready queues in dispatch order (one, or one per CPU)
+    vector<Device> devices;                   // States of the devices used so far
+    vector<SimulationEvent> events;           // Pending events in firing order
+    long long eventSequence = 0;              // Next event sequence number
+    bool balancePending = false;              // Whether a BALANCE event is queued
+    bool timerPending = false;                // Whether a TIMER event is queued
+    int busyCpus = 0;                         // CPUs running a process
+    int nextPlacementCpu = 0;                 // CPU that receives the next arrival
+    size_t arrivalCursor = 0;                 // Arrivals admitted so far
+    size_t transientRows = 0;                 // Trailing workload rows of released jobs
+    vector<ProcessHandle> freeRows;           // Rows of released jobs that terminated
+    vector<ProcessSpec> periodicTasks;        // Job templates of the periodic processes admitted so far
+    SimTime releaseHorizon = 0;               // Jobs are released before this time
+    long long totalProcesses = 0;             // Processes admitted or still to arrive
+    long long completedProcesses = 0;         // Processes terminated so far
+    double totalWaitingTime = 0.0;            // Running metric totals
+    double totalTurnaroundTime = 0.0;
+    double totalResponseTime = 0.0;
+    long long contextSwitches = 0;            // Run counters
+    long long migrations = 0;
+    SimTime overheadTime = 0;
+    RunStatistics statistics;                 // Distributions of the completed processes
+    vector<int64_t> policyState;              // Written by Scheduler::savePolicyState()
+};
+
 // ========================================================================================
 // ABSTRACT SCHEDULER BASE CLASS
 // ========================================================================================
@@ -46,21 +219,107 @@ protected:
     // PROTECTED MEMBER VARIABLES
     // ==================================================================================
     
-    vector<shared_ptr<Process>> processes;      // All processes in the system
-    queue<shared_ptr<Process>> readyQueue;      // Queue of processes ready to run
-    shared_ptr<Process> currentProcess;         // Currently executing process
-    int currentTime;                           // System clock/timer (time units)
+    shared_ptr<const Workload> workload;        // Static attributes of all processes in the system
+    shared_ptr<Workload> localWorkload;         // Same workload when owned (and appendable) by this scheduler
+    ProcessTable table;                         // Per-run process state and metrics
+    unique_ptr<ProcessGroups> processGroups;    // Group tree (nullptr without groups; outlives the queues)
+    unique_ptr<ReadyQueue> readyQueue;          // Queue of processes ready to run (global strategy)
+    ReadyQueueKind readyQueueKind;             // Container backing the ready queue
+    SimTime currentTime;                       // System clock/timer (time units)
     string algorithmName;                      // Name of the scheduling algorithm
-    bool isPreemptive;                        // Whether algorithm supports preemption
+    bool isPreemptive;                        // Whether a better arrival preempts the running process
+    Verbosity verbosity;                      // How much the scheduler reports
+    shared_ptr<TraceSink> traceSink;          // Buffered execution trace output (created on demand)
+    shared_ptr<TraceRecorder> traceRecorder;  // Binary event log (nullptr if not recording)
+    shared_ptr<ResultsWriter> resultsWriter;  // Per-process results export (nullptr if not exporting)
+    
+    // Discrete-event engine state
+    priority_queue<SimulationEvent, vector<SimulationEvent>,
+                   greater<SimulationEvent>> eventQueue;  // Pending events (min-heap on time)
+    long long eventSequence;                  // Counter used to order simultaneous events
+    
+    /**
+     * CPU State
+     * One simulated CPU: the process it runs and its local run queue
+     */
+    struct CpuState {
+        ProcessHandle current = INVALID_PROCESS;        // Running process (INVALID_PROCESS if idle)
+        ProcessHandle lastDispatched = INVALID_PROCESS; // Process that last held this CPU
+        SimTime sliceStart = 0;                         // Time the current slice started
+        SimTime overheadEnd = 0;                        // Time the dispatch overhead of the slice ends
+        long long sliceEvent = -1;                      // Sequence of the pending slice-end event
+        unique_ptr<ReadyQueue> runQueue;                // Local queue (per-CPU strategies only)
+        ReadyQueue* queue = nullptr;                    // Queue served: runQueue or the shared readyQueue
+        CpuStatistics stats;                            // Counters of the current run
+    };
+    
+    /**
+     * I/O Device State
+     * One simulated device: the request in service and the FIFO of blocked
+     * processes waiting for it, with the time each one joined
+     */
+    struct IoDevice {
+        ProcessHandle current = INVALID_PROCESS;        // Process being served (INVALID_PROCESS if idle)
+        RingBuffer<pair<ProcessHandle, SimTime>> queue; // Waiting requests
+        IoDeviceStatistics stats;                       // Counters of the current run
+    };
+    
+    // I/O state
+    vector<IoDevice> devices;                 // Device states, kept across runs (grown on demand)
+    size_t deviceCount;                       // Devices used so far in the run
+    
+    // Multiprocessor state
+    vector<CpuState> cpus;                    // Simulated CPUs (at least one)
+    LoadBalancing loadBalancing;              // How ready processes are shared between CPUs
+    SimTime balanceInterval;                  // Time between PERIODIC balancing passes
+    bool balancePending;                      // Whether a BALANCE event is queued
+    bool timerPending;                        // Whether a TIMER event is queued
+    int busyCpus;                             // CPUs currently running a process
+    int nextPlacementCpu;                     // CPU that receives the next arrival (per-CPU strategies)
+    
+    // Arrival admission state
+    vector<ProcessHandle> arrivalOrder;       // Process handles sorted by arrival time
+    bool arrivalOrderValid;                   // Whether arrivalOrder matches the workload
+    size_t arrivalCursor;                     // Index into arrivalOrder of the next arrival
+    unique_ptr<ArrivalSource> arrivalSource;  // Optional lazily streamed arrivals
+    bool liveArrivals;                        // Whether the source is fed while the run goes on
+    bool retainStreamed;                      // Whether streamed processes join the workload for good
+    size_t transientRows;                     // Trailing workload rows of non-retained streamed processes
+    vector<ProcessHandle> freeRows;           // Transient CPU-bound rows whose process terminated
+    long long transientArrivals;              // Arrivals admitted into transient rows this run
+    
+    // Periodic releases
+    vector<ProcessSpec> periodicTasks;        // Job templates of the periodic processes admitted this run
+    SimTime releaseHorizon;                   // Configured end of the releases (0 = automatic)
+    SimTime activeHorizon;                    // Jobs are released before this time in the current run
+    long long pendingReleases;                // RELEASE events in the event queue
     
     // Statistics tracking
-    int totalProcesses;                       // Total number of processes
-    int completedProcesses;                   // Number of completed processes
+    long long totalProcesses;                 // Total number of processes
+    long long completedProcesses;             // Number of completed processes
     double totalWaitingTime;                  // Sum of all waiting times
     double totalTurnaroundTime;               // Sum of all turnaround times
     double totalResponseTime;                 // Sum of all response times
+    long long contextSwitches;                // Dispatches of a different process than the last one
+    long long migrations;                     // Dispatches on another CPU than the process last ran on
+    SimTime overheadTime;                     // CPU time spent on dispatch overhead
+    DispatchCosts dispatchCosts;              // Overhead charged on every dispatch
+    RunStatistics runStatistics;              // Metric distributions, updated on every completion
+    ProfileCounters profile;                  // Engine phase ticks and event counters (SCHEDULER_PROFILING)
+    
+    // Pausing
+    SimTime pauseTime;                        // Time runUntil() stops at (-1 = run to the end)
+    bool paused;                              // Whether the run stopped before completing and can resume
+    
+    // Early termination
+    bool cutoffEnabled;                       // Whether the run may be abandoned early
+    SchedulingMetric cutoffMetric;            // Metric watched by the cutoff
+    double cutoffLimit;                       // Running total that abandons the run when exceeded
+    bool cutOff;                              // Whether the last run was abandoned
     
 public:
+    static constexpr SimTime AUTOMATIC_HORIZON_PERIODS = 1000;  // Longest automatic horizon, in longest periods
+    
     // ==================================================================================
     // PUBLIC CONSTRUCTORS AND DESTRUCTOR
     // ==================================================================================
@@ -71,8 +330,10 @@ public:
      * 
      * @param name - Name of the scheduling algorithm
      * @param preemptive - Whether the algorithm supports preemption (default: false)
+     * @param order - Ready queue ordering required by the policy (default: FIFO)
      */
-    Scheduler(const string& name, bool preemptive = false);
+    Scheduler(const string& name, bool preemptive = false,
+              ReadyQueueOrder order = ReadyQueueOrder::FIFO);
     
     /**
      * Virtual Destructor
@@ -93,6 +354,15 @@ public:
      */
     bool addProcess(shared_ptr<Process> process);
     
+    /**
+     * Add Process from Specification
+     * Appends a process directly to the process table without creating a Process object
+     * 
+     * @param spec - Process description
+     * @return Handle of the new process (INVALID_PROCESS on failure)
+     */
+    ProcessHandle addProcess(const ProcessSpec& spec);
+    
     /**
      * Add Multiple Processes
      * Convenience method to add multiple processes at once
@@ -102,6 +372,62 @@ public:
      */
     int addProcesses(const vector<shared_ptr<Process>>& processList);
     
+    /**
+     * Set Arrival Source
+     * Streams additional processes into the simulation as their arrival time
+     * is reached, so inputs too large to preload never have to be materialised
+     * up front.
+     * 
+     * Retained streamed processes stay in the workload once admitted, and later
+     * runs replay them like preloaded ones. Without retention a process only
+     * holds a row while it is in the system: the row of a terminated CPU-bound
+     * process is reused by the next arrival, so memory follows the number of
+     * live processes instead of the length of the stream (suited to soak runs
+     * of billions of processes). Averages and percentiles still cover every
+     * process, but the process table only shows the live and last terminated
+     * ones; each run rewinds the source (see ArrivalSource::rewind()).
+     * 
+     * A live source (see LiveArrivalSource) holds the clock back: the run only
+     * advances once the source has produced everything that arrives up to the
+     * next step, and it completes when the source is closed.
+     * 
+     * @param source - Source producing processes in arrival order (nullptr to detach)
+     * @param retain - Keep streamed processes in the workload (default: true)
+     */
+    void setArrivalSource(unique_ptr<ArrivalSource> source, bool retain = true);
+    
+    /**
+     * Set Workload
+     * Replaces the process set with a (possibly shared) read-only workload.
+     * Adding processes afterwards makes a private copy first.
+     * 
+     * @param source - Workload to simulate
+     */
+    void setWorkload(shared_ptr<const Workload> source);
+    
+    /**
+     * Get Workload
+     * 
+     * @return Workload currently simulated (nullptr if no processes)
+     */
+    shared_ptr<const Workload> getWorkload() const;
+    
+    /**
+     * Get Process Table
+     * Gives read-only access to per-process state and metrics of the last run
+     * 
+     * @return Process table
+     */
+    const ProcessTable& getProcessTable() const;
+    
+    /**
+     * Get Process View
+     * 
+     * @param handle - Process handle
+     * @return Read-only view of the process
+     */
+    ProcessView getProcess(ProcessHandle handle) const;
+    
     /**
      * Pure Virtual Schedule Function
      * Each scheduling algorithm must implement this function
@@ -147,7 +473,7 @@ public:
      * 
      * @return Total execution time in time units
      */
-    int getTotalExecutionTime() const;
+    SimTime getTotalExecutionTime() const;
     
     /**
      * Get Average Waiting Time
@@ -173,6 +499,188 @@ public:
      */
     double getAverageResponseTime() const;
     
+    /**
+     * Get Context Switch Count
+     * Number of times the CPU was handed to a different process than the one
+     * that last ran (a process keeping the CPU for a fresh quantum is not a switch)
+     * 
+     * @return Context switches of the last run
+     */
+    long long getContextSwitchCount() const;
+    
+    /**
+     * Get Migration Count
+     * Number of dispatches on a different CPU than the one the process last ran on
+     * 
+     * @return Migrations of the last run
+     */
+    long long getMigrationCount() const;
+    
+    /**
+     * Get Overhead Time
+     * CPU time spent on dispatch overhead, summed over all CPUs
+     * 
+     * @return Overhead time of the last run
+     */
+    SimTime getOverheadTime() const;
+    
+    /**
+     * Get Event Count
+     * Simulated events of the last run: admitted arrivals plus every event the
+     * engine queued (slice ends, I/O completions, balancing and timer events,
+     * stale slice ends included)
+     * 
+     * @return Events processed by the last run
+     */
+    long long getEventCount() const;
+    
+    /**
+     * Get Run Statistics
+     * Percentile sketches of waiting, turnaround and response time (overall
+     * and per priority class) and the throughput series of the last run.
+     * Updated on every completion, so a run that was cut off reports the
+     * processes completed so far.
+     * 
+     * @return Streaming statistics of the last run
+     */
+    const RunStatistics& getRunStatistics() const;
+    
+    /**
+     * Get Profile
+     * Phase ticks, event counters and queue high-water marks of the engine
+     * since the last run started (a resumed run keeps adding to them). Only
+     * collected when built with SCHEDULER_PROFILING; otherwise all zero.
+     * 
+     * @return Profile counters of the last run
+     */
+    const ProfileCounters& getProfile() const;
+    
+    /**
+     * Set Throughput Window
+     * Initial window width of the throughput series; the width doubles
+     * whenever the series would exceed its window limit
+     * 
+     * @param width - Window width in time units (positive)
+     */
+    void setThroughputWindow(SimTime width);
+    
+    /**
+     * Print Percentile Statistics
+     * Displays count, mean, p50, p90, p99, p99.9 and maximum of every
+     * metric, with a row per priority class when several classes ran, and
+     * the peak of the throughput series
+     */
+    void printPercentileStatistics() const;
+    
+    /**
+     * Set Release Horizon
+     * A periodic process (one with a period) arrives like any other process and
+     * then releases a copy of itself every period until the horizon; each copy
+     * is a job due its relative deadline after its release. By default the run
+     * covers one hyperperiod after the last first release of the preloaded
+     * periodic processes (at most AUTOMATIC_HORIZON_PERIODS of the longest
+     * period), so streamed periodic processes need an explicit horizon.
+     * 
+     * @param horizon - Time before which jobs are released (0 = automatic)
+     */
+    void setReleaseHorizon(SimTime horizon);
+    
+    /**
+     * Get Release Horizon
+     * 
+     * @return Configured release horizon (0 = automatic)
+     */
+    SimTime getReleaseHorizon() const;
+    
+    /**
+     * Print Deadline Statistics
+     * Displays the deadline misses of the jobs with a deadline, with the
+     * percentiles of how late the missed ones and how early the others were
+     */
+    void printDeadlineStatistics() const;
+    
+    /**
+     * Get Metric Total
+     * Running total of a metric. Totals only ever grow during a run, so a
+     * partial total is a lower bound on the final one.
+     * 
+     * @param metric - Metric to sum
+     * @return Sum over all processes charged so far
+     */
+    double getMetricTotal(SchedulingMetric metric) const;
+    
+    /**
+     * Set Cutoff
+     * Abandons the next runs as soon as the running total of a metric exceeds
+     * the limit, i.e. once the run can no longer beat a known result.
+     * schedule() then returns false and wasCutOff() reports true.
+     * 
+     * @param metric - Metric to watch
+     * @param limit - Largest total the run may reach
+     */
+    void setCutoff(SchedulingMetric metric, double limit);
+    
+    /**
+     * Clear Cutoff
+     * Lets runs complete regardless of their metrics
+     */
+    void clearCutoff();
+    
+    /**
+     * Was Cut Off
+     * 
+     * @return True if the last run was abandoned by the cutoff
+     */
+    bool wasCutOff() const;
+    
+    /**
+     * Run Until
+     * Starts a fresh run like schedule(), but pauses it once everything up to
+     * the given time has been simulated, e.g. to take a snapshot()
+     * 
+     * @param time - Time to pause at (non-negative)
+     * @return True if the run paused or completed
+     */
+    bool runUntil(SimTime time);
+    
+    /**
+     * Is Paused
+     * 
+     * @return True if a paused or restored run is waiting for resume()
+     */
+    bool isPaused() const;
+    
+    /**
+     * Resume
+     * Continues a run stopped by runUntil() or set up by restore() to the end
+     * 
+     * @return True if every process completed
+     */
+    bool resume();
+    
+    /**
+     * Take Snapshot
+     * Captures the state of the current run. The workload is shared with the
+     * snapshot; if this scheduler owns it, later additions copy it first.
+     * Runs fed by an ArrivalSource cannot be captured.
+     * 
+     * @return Snapshot (nullptr if the run cannot be captured)
+     */
+    shared_ptr<const SchedulerSnapshot> snapshot();
+    
+    /**
+     * Restore Snapshot
+     * Replaces the workload and the run state with a snapshot's; resume()
+     * then simulates the rest of the run under this scheduler's policy.
+     * Slices in progress finish as they were granted, and policy state is
+     * only carried over from a snapshot of the same algorithm. The CPU count
+     * and load balancing strategy must match the snapshot's.
+     * 
+     * @param source - Snapshot to continue from
+     * @return True if the snapshot was restored
+     */
+    bool restore(const SchedulerSnapshot& source);
+    
     /**
      * Reset Scheduler State
      * Resets the scheduler for a fresh simulation run
@@ -201,66 +709,341 @@ public:
      * @return Boolean indicating preemptive capability
      */
     bool isPreemptiveAlgorithm() const;
+    
+    /**
+     * Set Ready Queue Kind
+     * Replaces the container backing the ready queue, keeping the policy's ordering.
+     * Must be called between simulations (the ready queue is emptied).
+     * 
+     * @param kind - Container implementation to use
+     */
+    void setReadyQueueKind(ReadyQueueKind kind);
+    
+    /**
+     * Get Ready Queue Kind
+     * 
+     * @return Container implementation backing the ready queue
+     */
+    ReadyQueueKind getReadyQueueKind() const;
+    
+    /**
+     * Set CPU Count
+     * Simulates a multiprocessor with the given number of identical CPUs.
+     * Every CPU runs the scheduler's own policy on the processes it is given.
+     * Must be called between simulations.
+     * 
+     * @param count - Number of CPUs (1 to 256)
+     */
+    void setCpuCount(int count);
+    
+    /**
+     * Get CPU Count
+     * 
+     * @return Number of simulated CPUs
+     */
+    int getCpuCount() const;
+    
+    /**
+     * Set Load Balancing
+     * Chooses how ready processes are shared between the CPUs. With per-CPU
+     * strategies arrivals are placed on the CPUs in turn, and a preempted
+     * process goes back to the run queue of the CPU it ran on.
+     * Must be called between simulations.
+     * 
+     * @param strategy - Load balancing strategy
+     * @param interval - Time between balancing passes for PERIODIC (default: 10)
+     */
+    void setLoadBalancing(LoadBalancing strategy, SimTime interval = 10);
+    
+    /**
+     * Get Load Balancing
+     * 
+     * @return Load balancing strategy
+     */
+    LoadBalancing getLoadBalancing() const;
+    
+    /**
+     * Set Dispatch Costs
+     * Charges every dispatch with simulated overhead: the CPU is busy but the
+     * process makes no progress until the overhead has passed. All costs are
+     * zero by default, so dispatches are free.
+     * 
+     * @param costs - Context switch, cache warmup and migration costs (negative values are replaced by 0)
+     */
+    void setDispatchCosts(const DispatchCosts& costs);
+    
+    /**
+     * Get Dispatch Costs
+     * 
+     * @return Overhead charged on every dispatch
+     */
+    const DispatchCosts& getDispatchCosts() const;
+    
+    /**
+     * Get CPU Statistics
+     * 
+     * @return Counters and utilisation of every CPU for the last run
+     */
+    vector<CpuStatistics> getCpuStatistics() const;
+    
+    /**
+     * Print CPU Statistics
+     * Displays one row per CPU with utilisation, switches and migrations
+     */
+    void printCpuStatistics() const;
+    
+    /**
+     * Get I/O Device Statistics
+     * 
+     * @return Counters and utilisation of every device used in the last run
+     */
+    vector<IoDeviceStatistics> getDeviceStatistics() const;
+    
+    /**
+     * Print I/O Device Statistics
+     * Displays one row per device with utilisation, requests and queueing
+     */
+    void printDeviceStatistics() const;
+    
+    /**
+     * Set Verbosity
+     * Below Verbosity::TRACE the event loop does no output formatting at all.
+     * Schedulers run in parallel (see ComparisonRunner) are set to QUIET so
+     * threads never share cout.
+     * 
+     * @param level - Reporting level
+     */
+    void setVerbosity(Verbosity level);
+    
+    /**
+     * Get Verbosity
+     * 
+     * @return Reporting level
+     */
+    Verbosity getVerbosity() const;
+    
+    /**
+     * Set Default Verbosity
+     * Level given to schedulers constructed afterwards (initially TRACE)
+     * 
+     * @param level - Reporting level
+     */
+    static void setDefaultVerbosity(Verbosity level);
+    
+    /**
+     * Set Trace Sink
+     * Redirects the execution trace, e.g. to share one buffer between schedulers
+     * 
+     * @param sink - Trace destination (nullptr for a private sink on cout)
+     */
+    void setTraceSink(shared_ptr<TraceSink> sink);
+    
+    /**
+     * Is Trace Enabled
+     * 
+     * @return Whether the per-event execution trace is printed
+     */
+    bool isTraceEnabled() const { return verbosity >= Verbosity::TRACE; }
+    
+    /**
+     * Set Trace Recorder
+     * Logs every arrival, dispatch, preemption, completion, I/O block and
+     * wakeup of the following runs as binary records. Independent of the verbosity level.
+     * 
+     * @param recorder - Open recorder (nullptr to stop recording)
+     */
+    void setTraceRecorder(shared_ptr<TraceRecorder> recorder);
+    
+    /**
+     * Get Trace Recorder
+     * 
+     * @return Attached recorder (nullptr if not recording)
+     */
+    shared_ptr<TraceRecorder> getTraceRecorder() const;
+    
+    /**
+     * Set Results Writer
+     * Hands the pid, arrival, start, completion, waiting, turnaround and
+     * response time of every process that terminates in the following runs
+     * to the writer, streamed processes and periodic jobs included. A resumed
+     * run only exports the processes that terminate after the resume.
+     * 
+     * @param writer - Open writer (nullptr to stop exporting)
+     */
+    void setResultsWriter(shared_ptr<ResultsWriter> writer);
+    
+    /**
+     * Get Results Writer
+     * 
+     * @return Attached writer (nullptr if not exporting)
+     */
+    shared_ptr<ResultsWriter> getResultsWriter() const;
+    
+    /**
+     * Set Process Groups
+     * Schedules the following runs hierarchically: CPUs are shared between
+     * the groups of the hierarchy by weight and quota, and the policy orders
+     * the processes inside each group. Processes join the group named by
+     * their workload row. Snapshots are not available with groups.
+     * 
+     * @param hierarchy - Declared groups (nullptr to schedule one flat pool again)
+     */
+    void setProcessGroups(shared_ptr<const GroupHierarchy> hierarchy);
+    
+    /**
+     * Get Process Groups
+     * 
+     * @return Declared groups (nullptr without groups)
+     */
+    shared_ptr<const GroupHierarchy> getProcessGroups() const;
+    
+    /**
+     * Get Group Statistics
+     * 
+     * @return Metrics of every group of the last run, parents before their children
+     *         (empty without groups)
+     */
+    vector<GroupStatistics> getGroupStatistics() const;
+    
+    /**
+     * Print Group Statistics
+     * Prints CPU share, throttling and latency of every group
+     */
+    void printGroupStatistics() const;
 
 protected:
     // ==================================================================================
     // PROTECTED HELPER METHODS FOR DERIVED CLASSES
     // ==================================================================================
     
-    /**
-     * Update Waiting Times
-     * Increments waiting time for all processes in READY state
-     * Should be called once per time unit during simulation
-     */
-    void updateWaitingTimes();
-    
     /**
      * Check for Process Arrivals
      * Moves processes from NEW to READY state when they arrive
-     * Adds newly arrived processes to the ready queue
+     * Adds newly arrived processes to the ready queue. Only processes that
+     * became due since the last call are touched (amortised O(1) per arrival).
      */
     void checkArrivals();
     
+    /**
+     * Has Pending Arrivals
+     * Determines whether any process has yet to arrive
+     * 
+     * @return True if the arrival cursor or arrival source is not exhausted
+     */
+    bool hasPendingArrivals() const;
+    
+    /**
+     * Get Next Arrival Time
+     * Returns the arrival time of the next process still to arrive
+     * 
+     * @return Next arrival time (only meaningful if hasPendingArrivals())
+     */
+    SimTime getNextArrivalTime() const;
+    
     /**
      * Check All Processes Completed
      * Determines if all processes have finished execution
+     * O(1): compares the completion counter against the process total
      * 
      * @return Boolean indicating if all processes are completed
      */
     bool allProcessesCompleted() const;
     
+    /**
+     * Admit Periodic Task
+     * Remembers the arrived process as the template of its later jobs and
+     * schedules the RELEASE of the first one
+     * 
+     * @param process - Arrived process with a period
+     */
+    void admitPeriodicTask(ProcessHandle process);
+    
+    /**
+     * Release Job
+     * Admits the next job of a periodic process into a transient row and
+     * schedules the release after it while it is before the horizon
+     * 
+     * @param task - Index into periodicTasks
+     */
+    void releaseJob(int task);
+    
+    /**
+     * Get Run Queue
+     * Returns the queue a CPU takes its processes from: the shared ready
+     * queue for GLOBAL_QUEUE, the CPU's own run queue otherwise
+     * 
+     * @param cpu - CPU index
+     * @return Ready queue serving the CPU
+     */
+    ReadyQueue& getRunQueue(int cpu);
+    const ReadyQueue& getRunQueue(int cpu) const;
+    
+    /**
+     * Get Policy Queue
+     * Returns the queue of the policy's own kind that the next selection on
+     * a CPU takes from: the run queue itself, or with process groups the
+     * queue of the group chosen by the hierarchy
+     * 
+     * @param cpu - CPU index
+     * @return Policy queue of the next selection
+     */
+    ReadyQueue& getPolicyQueue(int cpu);
+    
+    /**
+     * Get Policy Queue of a Process
+     * 
+     * @param cpu - CPU whose run queue holds (or will hold) the process
+     * @param process - Process handle
+     * @return Policy queue the process is (or would be) queued in
+     */
+    ReadyQueue& getPolicyQueue(int cpu, ProcessHandle process) const;
+    
+    /**
+     * For Each Policy Queue
+     * 
+     * @param cpu - CPU index
+     * @param visit - Called with every policy queue of the CPU's run queue
+     */
+    void forEachPolicyQueue(int cpu, const function<void(ReadyQueue&)>& visit);
+    
     /**
      * Get Next Ready Process
      * Returns the next process from the ready queue without removing it
      * 
-     * @return Shared pointer to next ready process (nullptr if queue empty)
+     * @param cpu - CPU whose queue to inspect (default: 0)
+     * @return Handle of next ready process (INVALID_PROCESS if queue empty)
      */
-    shared_ptr<Process> getNextReadyProcess() const;
+    ProcessHandle getNextReadyProcess(int cpu = 0) const;
     
     /**
      * Remove Process from Ready Queue
      * Removes and returns the next process from the ready queue
      * 
-     * @return Shared pointer to the removed process (nullptr if queue empty)
+     * @param cpu - CPU whose queue to take from (default: 0)
+     * @return Handle of the removed process (INVALID_PROCESS if queue empty)
      */
-    shared_ptr<Process> removeFromReadyQueue();
+    ProcessHandle removeFromReadyQueue(int cpu = 0);
     
     /**
      * Add Process to Ready Queue
      * Adds a process to the ready queue and updates its state
+     * Stamps the ready-enter time used for lazy waiting time accounting
      * 
      * @param process - Process to add to ready queue
+     * @param cpu - CPU whose run queue receives it (-1: next CPU in turn)
      */
-    void addToReadyQueue(shared_ptr<Process> process);
+    void addToReadyQueue(ProcessHandle process, int cpu = -1);
     
     /**
      * Start Process Execution
      * Handles the transition of a process to running state
-     * Updates timing information and process state
+     * Updates timing information and process state, charging the time
+     * spent in the ready queue since the ready-enter stamp as waiting time
      * 
      * @param process - Process to start executing
+     * @param cpu - CPU it runs on (default: 0)
      */
-    void startProcessExecution(shared_ptr<Process> process);
+    void startProcessExecution(ProcessHandle process, int cpu = 0);
     
     /**
      * Complete Process Execution
@@ -269,33 +1052,50 @@ protected:
      * 
      * @param process - Process that has completed
      */
-    void completeProcessExecution(shared_ptr<Process> process);
+    void completeProcessExecution(ProcessHandle process);
     
     /**
      * Preempt Current Process
-     * Handles preemption of the currently running process
+     * Handles preemption of the process running on a CPU
      * Returns process to ready queue if not completed
      * 
-     * @param reason - Reason for preemption (for logging)
+     * @param cpu - CPU to take the process off (default: 0)
      */
-    void preemptCurrentProcess(const string& reason = "");
+    void preemptCurrentProcess(int cpu = 0);
     
     /**
      * Execute Time Slice
-     * Executes the current process for one time unit
+     * Executes the process on CPU 0 for one time unit
      * Handles process completion and timing updates
      * 
      * @return Boolean indicating if process completed during this slice
      */
     bool executeTimeSlice();
     
+    /**
+     * Get Trace Sink
+     * Returns the execution trace output, creating a buffered sink on cout if needed
+     * 
+     * @return Trace sink
+     */
+    TraceSink& trace();
+    
+    /**
+     * Trace Event Prefix
+     * Starts an execution trace line: "Time X: ", plus "[CPU n] " on multiprocessors
+     * 
+     * @param cpu - CPU the event happened on
+     * @return Trace sink
+     */
+    TraceSink& traceEvent(int cpu);
+    
     /**
      * Print Execution Step
      * Displays current execution state for verbose output
      * 
      * @param action - Description of current action
      */
-    void printExecutionStep(const string& action) const;
+    void printExecutionStep(const string& action);
     
     /**
      * Validate Process Set
@@ -319,10 +1119,296 @@ protected:
      */
     void resetProcessStates();
     
+    // ==================================================================================
+    // DISCRETE-EVENT ENGINE
+    // ==================================================================================
+    
+    /**
+     * Run Event Loop
+     * Shared discrete-event simulation core used by every schedule() implementation.
+     * Instead of advancing the clock one unit at a time, the engine jumps straight
+     * to the next arrival, completion or quantum expiry, so runtime scales with the
+     * number of events rather than with simulated time.
+     * 
+     * A concrete policy passes its own type, e.g. runEventLoop<FCFSScheduler>(),
+     * to run a kernel compiled for it: its hooks are bound statically and
+     * inlined, and the trace and cutoff code is compiled out of runs that do
+     * not use it (see SchedulingKernel.h). Objects of a further derived type,
+     * which may override the hooks again, fall back to the type-erased kernel.
+     * 
+     * @return Boolean indicating successful completion of the simulation
+     */
+    template <class Policy = Scheduler>
+    bool runEventLoop();
+    
+    /**
+     * Advance Event Loop
+     * Runs the event loop from the current state until every process has
+     * completed, the cutoff is exceeded or the pause time is reached.
+     * Traced = false drops the trace output and recording, Cutoff = false the
+     * cutoff check; the defaults test both at run time.
+     * 
+     * @return True if every process completed
+     */
+    template <class Policy = Scheduler, bool Traced = true, bool Cutoff = true>
+    bool advanceEventLoop();
+    
+    /**
+     * Run Kernel
+     * Picks the advanceEventLoop() instantiation matching the trace and
+     * cutoff settings of this run
+     * 
+     * @return True if every process completed
+     */
+    template <class Policy>
+    bool runKernel();
+    
+    /**
+     * Policy Hook Calls
+     * The hooks as the kernel calls them: bound statically (and so open to
+     * inlining) for a concrete Policy, through the vtable for Scheduler
+     */
+    template <class Policy> ProcessHandle callSelectNextProcess(int cpu);
+    template <class Policy> int callGetTimeSlice(ProcessHandle process) const;
+    template <class Policy> string callGetDispatchMessage(ProcessHandle process) const;
+    template <class Policy> bool callShouldPreempt(ProcessHandle running, ProcessHandle candidate, int cpu) const;
+    template <class Policy> void callOnQuantumExpired(ProcessHandle process, int cpu);
+    template <class Policy> void callOnProcessBlocked(ProcessHandle process, int cpu);
+    template <class Policy> void callOnTimer();
+    
+    /**
+     * Select Next Process
+     * Removes and returns the process to dispatch next from the CPU's run queue.
+     * Default implementation takes the best process of the queue ordering;
+     * policies override it.
+     * 
+     * @param cpu - CPU about to dispatch
+     * @return Process to dispatch (run queue is guaranteed non-empty)
+     */
+    virtual ProcessHandle selectNextProcess(int cpu);
+    
+    /**
+     * Get Time Slice
+     * Returns how long a dispatched process may run before being preempted.
+     * Default is the full remaining burst (non-preemptive run to completion).
+     * 
+     * @param process - Process about to be dispatched
+     * @return Maximum number of time units to run
+     */
+    virtual int getTimeSlice(ProcessHandle process) const;
+    
+    /**
+     * Get Dispatch Message
+     * Returns the trace line printed when a process is given the CPU
+     * 
+     * @param process - Process being dispatched
+     * @return Message printed after the "Time X: " prefix
+     */
+    virtual string getDispatchMessage(ProcessHandle process) const;
+    
+    /**
+     * Should Preempt
+     * Decides whether a ready process takes the CPU from a running one.
+     * Default for preemptive schedulers: the candidate's ready queue key is
+     * strictly better (e.g. shorter remaining time, higher priority), as
+     * ordered by the policy queue of the running process on that CPU.
+     * 
+     * @param running - Process on the CPU (remaining time is up to date)
+     * @param candidate - Best process of the run queue
+     * @param cpu - CPU the running process holds
+     * @return True if the running process should be preempted
+     */
+    virtual bool shouldPreempt(ProcessHandle running, ProcessHandle candidate, int cpu) const;
+    
+    /**
+     * On Quantum Expired
+     * Called when a process used up its time slice without finishing, after
+     * the slice was charged and before it is requeued or given another slice.
+     * Default does nothing.
+     * 
+     * @param process - Process whose slice expired
+     * @param cpu - CPU it ran on
+     */
+    virtual void onQuantumExpired(ProcessHandle process, int cpu);
+    
+    /**
+     * On Process Blocked
+     * Called when a process leaves the CPU to wait for I/O, after its burst
+     * was charged and before the CPU is freed. Default does nothing.
+     * 
+     * @param process - Process that blocks
+     * @param cpu - CPU it ran on
+     */
+    virtual void onProcessBlocked(ProcessHandle process, int cpu);
+    
+    /**
+     * On Process Recycled
+     * Called when a non-retained streamed process is admitted into the row of
+     * a terminated one, before it joins a run queue. Policies that keep
+     * per-process state indexed by handle forget the old process here.
+     * Default does nothing.
+     * 
+     * @param process - Reused row, now holding the arriving process
+     */
+    virtual void onProcessRecycled(ProcessHandle process);
+    
+    /**
+     * Get Timer Interval
+     * Period of the policy timer. The timer is re-armed after it fires while
+     * processes are running. Default 0: no timer.
+     * 
+     * @return Time between TIMER events (0 disables the timer)
+     */
+    virtual SimTime getTimerInterval() const;
+    
+    /**
+     * On Timer
+     * Called when the policy timer fires, before idle CPUs dispatch.
+     * Default does nothing.
+     */
+    virtual void onTimer();
+    
+    /**
+     * Create Run Queue
+     * Builds an empty ready queue for the shared queue or a CPU. Policies with
+     * their own container override it and call rebuildReadyQueues() from
+     * their constructor.
+     * 
+     * @param order - Ordering requested by the policy
+     * @return New ready queue
+     */
+    virtual unique_ptr<ReadyQueue> createRunQueue(ReadyQueueOrder order);
+    
+    /**
+     * Save Policy State
+     * Hook called by snapshot(): appends the policy's per-run state (beyond
+     * the process table and queue contents) as opaque words. Default: none.
+     * 
+     * @param state - Receives the words
+     */
+    virtual void savePolicyState(vector<int64_t>& state) const;
+    
+    /**
+     * Restore Policy State
+     * Hook called by restore() once the ready queues hold the snapshot's
+     * processes in dispatch order. Policies whose queue order depends on
+     * their own state clear and refill the queues from source.queues.
+     * 
+     * @param source - Snapshot being restored
+     * @param samePolicy - Whether source.policyState was saved by this
+     *                     algorithm (otherwise the policy starts afresh)
+     */
+    virtual void restorePolicyState(const SchedulerSnapshot& source, bool samePolicy);
+    
+    /**
+     * Rebuild Ready Queues
+     * Recreates the shared ready queue and the per-CPU run queues through
+     * createRunQueue(), keeping the current ordering
+     */
+    void rebuildReadyQueues();
+    
+    /**
+     * Schedule Event
+     * Pushes a new event onto the engine's event queue
+     * 
+     * @param time - Simulated time at which the event fires
+     * @param type - Type of the event
+     * @param process - Process the event refers to
+     * @param cpu - CPU the event refers to (default: 0)
+     */
+    void scheduleEvent(SimTime time, EventType type, ProcessHandle process, int cpu = 0);
+    
+    /**
+     * Dispatch Process
+     * Starts the given process on a CPU and schedules the end of its time slice
+     * 
+     * @param process - Process to run
+     * @param cpu - CPU to run it on (default: 0)
+     */
+    template <class Policy = Scheduler, bool Traced = true>
+    void dispatchProcess(ProcessHandle process, int cpu = 0);
+    
+    /**
+     * Begin Time Slice
+     * Schedules the completion or quantum expiry event for the process running
+     * on a CPU, starting at the current time or once its dispatch overhead ends
+     * 
+     * @param cpu - CPU whose process starts a slice (default: 0)
+     */
+    template <class Policy = Scheduler>
+    void beginTimeSlice(int cpu = 0);
+    
+    /**
+     * Account Running Time
+     * Charges the time elapsed since the slice started to the process on a CPU,
+     * except the dispatch overhead, which keeps the CPU busy without progress
+     * 
+     * @param cpu - CPU whose process ran (default: 0)
+     */
+    void accountRunningTime(int cpu = 0);
+    
+    /**
+     * Block Process
+     * Takes the process on a CPU off it at the end of a CPU burst and hands
+     * its next I/O request to the device, queueing it if the device is busy
+     * 
+     * @param cpu - CPU whose process blocks
+     */
+    template <class Policy = Scheduler, bool Traced = true>
+    void blockProcess(int cpu);
+    
+    /**
+     * Complete I/O
+     * Finishes the request in service on a device: the process moves on to
+     * its next CPU burst and rejoins a run queue, and the device starts on
+     * the next waiting request
+     * 
+     * @param device - Device index
+     */
+    void completeIo(int device);
+    
+    /**
+     * Start I/O
+     * Starts serving a request and schedules its IO_COMPLETION event
+     * 
+     * @param device - Idle device index
+     * @param process - Process whose current request is served
+     */
+    void startIo(int device, ProcessHandle process);
+    
+    /**
+     * Check Preemption
+     * Preemptive schedulers: compares the top of each run queue with the
+     * process it would displace and swaps them while shouldPreempt() agrees.
+     * Only the queue top is inspected, so a check costs O(log n) per
+     * preemption and O(1) otherwise. On a shared queue the displaced process
+     * is the worst one running on any CPU.
+     */
+    template <class Policy = Scheduler, bool Traced = true>
+    void checkPreemption();
+    
+    /**
+     * Balance Run Queues
+     * PERIODIC strategy: moves ready processes from the most to the least
+     * loaded CPU until no two CPUs differ by more than one process
+     */
+    void balanceRunQueues();
+    
+    /**
+     * Steal Work
+     * WORK_STEALING strategy: moves the next process of the longest run queue
+     * to an idle CPU's empty queue
+     * 
+     * @param cpu - Idle CPU
+     * @return True if a process was stolen
+     */
+    bool stealWork(int cpu);
+    
     /**
      * Sort Processes by Arrival Time
-     * Utility method to sort processes by arrival time
-     * Useful for FCFS and other arrival-based algorithms
+     * Rebuilds the arrival order of the process handles (stable, so processes
+     * arriving together keep insertion order). Called by the engine whenever
+     * processes were added since the last run.
      */
     void sortProcessesByArrivalTime();
     
@@ -343,6 +1429,8 @@ protected:
     bool isSystemIdle() const;
 
 private:
+    static Verbosity defaultVerbosity;        // Level given to new schedulers
+    
     // ==================================================================================
     // PRIVATE UTILITY METHODS
     // ==================================================================================
@@ -353,6 +1441,47 @@ private:
      */
     void initializeStatistics();
     
+    /**
+     * Rebuild CPUs
+     * Recreates the CPU states and their run queues after the CPU count,
+     * load balancing strategy or ready queue kind changed
+     */
+    void rebuildCpus();
+    
+    /**
+     * Make Run Queue
+     * Builds a queue through createRunQueue(), wrapped in a group queue when
+     * the scheduler has process groups
+     * 
+     * @param order - Ordering requested by the policy
+     * @return New ready queue
+     */
+    unique_ptr<ReadyQueue> makeRunQueue(ReadyQueueOrder order);
+    
+    /**
+     * Get Mutable Workload
+     * Returns the scheduler's own workload, copying a shared one on first write
+     * 
+     * @return Appendable workload
+     */
+    Workload& getMutableWorkload();
+    
+    /**
+     * Admit Transient Process
+     * Gives a non-retained streamed process a free row, or appends one
+     * 
+     * @param spec - Arriving process
+     * @return Handle of its row (INVALID_PROCESS if the process is invalid)
+     */
+    ProcessHandle admitTransientProcess(const ProcessSpec& spec);
+    
+    /**
+     * Release Transient Rows
+     * Truncates the rows of non-retained streamed processes, leaving the
+     * preloaded and retained ones
+     */
+    void releaseTransientRows();
+    
     /**
      * Print Statistics Header
      * Prints the header for statistics table
@@ -0,0 +1,488 @@
+/**
+ * SchedulingKernel.h - Compile-Time Specialised Event Loop HEADER FILE
+ *
+ * This header file holds the discrete-event engine of the Scheduler as
+ * member templates parameterised on the policy type. A concrete scheduler
+ * runs runEventLoop<ItsOwnType>() from its schedule(), which instantiates the
+ * engine for that policy in the policy's own source file:
+ * - Policy hooks (selection, time slice, preemption, quantum expiry, blocking
+ *   and timer) are called qualified, so they bind statically and can be
+ *   inlined instead of going through the vtable on every event
+ * - Traced = false removes the trace output and trace recording, and
+ *   Cutoff = false the early-termination check, with if constexpr
+ * Policy = Scheduler is the type-erased kernel: hooks are virtual calls, as
+ * needed by subclasses that override them again and by resume().
+ *
+ * Only the sources that run or instantiate the engine include this header.
+ *
+ */
+
+#ifndef SCHEDULING_KERNEL_H
+#define SCHEDULING_KERNEL_H
+
+#include <type_traits>  // For is_same_v
+#include <typeinfo>     // For the exact-type check
+
+#include "Scheduler.h"  // Include Scheduler base class
+
+using namespace std;
+
+// ========================================================================================
+// POLICY HOOK CALLS
+// ========================================================================================
+
+template <class Policy>
+ProcessHandle Scheduler::callSelectNextProcess(int cpu) {
+    PROFILE_SCOPE(ProfilePhase::SELECTION);
+    if constexpr (is_same_v<Policy, Scheduler>) {
+        return selectNextProcess(cpu);
+    } else {
+        return static_cast<Policy*>(this)->Policy::selectNextProcess(cpu);
+    }
+}
+
+template <class Policy>
+int Scheduler::callGetTimeSlice(ProcessHandle process) const {
+    if constexpr (is_same_v<Policy, Scheduler>) {
+        return getTimeSlice(process);
+    } else {
+        return static_cast<const Policy*>(this)->Policy::getTimeSlice(process);
+    }
+}
+
+template <class Policy>
+string Scheduler::callGetDispatchMessage(ProcessHandle process) const {
+    if constexpr (is_same_v<Policy, Scheduler>) {
+        return getDispatchMessage(process);
+    } else {
+        return static_cast<const Policy*>(this)->Policy::getDispatchMessage(process);
+    }
+}
+
+template <class Policy>
+bool Scheduler::callShouldPreempt(ProcessHandle running, ProcessHandle candidate, int cpu) const {
+    if constexpr (is_same_v<Policy, Scheduler>) {
+        return shouldPreempt(running, candidate, cpu);
+    } else {
+        return static_cast<const Policy*>(this)->Policy::shouldPreempt(running, candidate, cpu);
+    }
+}
+
+template <class Policy>
+void Scheduler::callOnQuantumExpired(ProcessHandle process, int cpu) {
+    if constexpr (is_same_v<Policy, Scheduler>) {
+        onQuantumExpired(process, cpu);
+    } else {
+        static_cast<Policy*>(this)->Policy::onQuantumExpired(process, cpu);
+    }
+}
+
+template <class Policy>
+void Scheduler::callOnProcessBlocked(ProcessHandle process, int cpu) {
+    if constexpr (is_same_v<Policy, Scheduler>) {
+        onProcessBlocked(process, cpu);
+    } else {
+        static_cast<Policy*>(this)->Policy::onProcessBlocked(process, cpu);
+    }
+}
+
+template <class Policy>
+void Scheduler::callOnTimer() {
+    if constexpr (is_same_v<Policy, Scheduler>) {
+        onTimer();
+    } else {
+        static_cast<Policy*>(this)->Policy::onTimer();
+    }
+}
+
+// ========================================================================================
+// DISCRETE-EVENT ENGINE IMPLEMENTATION
+// ========================================================================================
+
+/**
+ * Run Event Loop Implementation
+ *
+ * Algorithm flow:
+ * 1. Reset the scheduler; the arrival order of the process handles is rebuilt
+ *    if processes were added since the last run.
+ * 2. Jump the clock to the earlier of the next pending event and the next arrival
+ *    (once a live source has caught up with it), admit the newly due processes
+ *    from the arrival cursor, then drain every event at that instant:
+ *    - RELEASE: a periodic process releases its next job, which joins a run
+ *      queue ahead of everything else of the same instant.
+ *    - IO_COMPLETION: the device's process rejoins a run queue for its next CPU
+ *      burst (ahead of quantum expiries of the same instant, like arrivals), and
+ *      the device serves its next waiting request.
+ *    - REFILL: a throttled process group starts a new quota period and its
+ *      processes can be selected again.
+ *    - COMPLETION: charge the slice to the running process; it terminates, or
+ *      blocks on the device of its next I/O request if CPU time is left.
+ *    - QUANTUM_EXPIRY: charge the slice; the process goes back to its run queue
+ *      behind the arrivals of the same instant, or simply keeps the CPU for another
+ *      slice if nobody else is waiting there and its process group has quota left.
+ *    - BALANCE: even out the per-CPU run queues (PERIODIC strategy).
+ *    - TIMER: run the policy's periodic onTimer() work.
+ *    Slice-end events of a process that was preempted early are stale and skipped.
+ * 3. Every idle CPU dispatches the process chosen by selectNextProcess(), stealing
+ *    from the longest run queue first if its own is empty (WORK_STEALING).
+ * 4. Preemptive schedulers then let a better ready process displace a running one.
+ * 5. Stop when all processes are terminated and no source can produce more.
+ * With SCHEDULER_PROFILING, the phases of every step are timed into the
+ * scheduler's profile counters (see Instrumentation.h).
+ */
+template <class Policy>
+bool Scheduler::runEventLoop() {
+    reset();
+
+    // A subclass of the policy may override its hooks again: only objects of
+    // exactly the policy type run the statically bound kernel
+    if constexpr (!is_same_v<Policy, Scheduler>) {
+        if (typeid(*this) != typeid(Policy)) {
+            return runKernel<Scheduler>();
+        }
+    }
+    return runKernel<Policy>();
+}
+
+/**
+ * Run Kernel Implementation
+ */
+template <class Policy>
+bool Scheduler::runKernel() {
+    if (isTraceEnabled() || traceRecorder) {
+        return cutoffEnabled ? advanceEventLoop<Policy, true, true>() : advanceEventLoop<Policy, true, false>();
+    }
+    return cutoffEnabled ? advanceEventLoop<Policy, false, true>() : advanceEventLoop<Policy, false, false>();
+}
+
+/**
+ * Advance Event Loop Implementation
+ */
+template <class Policy, bool Traced, bool Cutoff>
+bool Scheduler::advanceEventLoop() {
+    const int cpuCount = static_cast<int>(cpus.size());
+    const bool periodic = loadBalancing == LoadBalancing::PERIODIC && cpuCount > 1;
+    const bool stealing = loadBalancing == LoadBalancing::WORK_STEALING && cpuCount > 1;
+    const SimTime timerInterval = getTimerInterval();
+    PROFILE_BIND(&profile);
+
+    while (!allProcessesCompleted()) {
+        if (eventQueue.empty() && !hasPendingArrivals()) {
+            if (traceSink) traceSink->flush();
+            cerr << "Error: " << algorithmName << " event queue drained before all processes completed" << endl;
+            return false;
+        }
+
+        // Advance straight to the next event or arrival time
+        SimTime next;
+        if (eventQueue.empty()) {
+            next = getNextArrivalTime();
+        } else if (hasPendingArrivals()) {
+            next = min(eventQueue.top().time, getNextArrivalTime());
+        } else {
+            next = eventQueue.top().time;
+        }
+        
+        // A live feed may still submit processes that arrive before that
+        if (liveArrivals && !arrivalSource->awaitArrivals(next)) {
+            continue;
+        }
+
+        // Pause once everything up to the pause time has been simulated
+        if (pauseTime >= 0 && next > pauseTime) {
+            currentTime = max(currentTime, pauseTime);
+            paused = true;
+            if (traceSink) traceSink->flush();
+            return false;
+        }
+        currentTime = next;
+        bool balanceDue = false;
+        PROFILE_COUNT(ProfileCounter::STEPS);
+
+        // Admit every process that has become due, so that processes whose
+        // quantum expires at this instant queue up behind them
+        {
+            PROFILE_SCOPE(ProfilePhase::ARRIVALS);
+            checkArrivals();
+        }
+
+        while (!eventQueue.empty() && eventQueue.top().time == currentTime) {
+            PROFILE_SCOPE(ProfilePhase::EVENTS);
+            SimulationEvent event = eventQueue.top();
+            eventQueue.pop();
+
+            // Slice cut short by a preemption: the process is no longer on this CPU
+            if ((event.type == EventType::COMPLETION || event.type == EventType::QUANTUM_EXPIRY) &&
+                event.sequence != cpus[event.cpu].sliceEvent) {
+                PROFILE_COUNT(ProfileCounter::STALE_EVENTS);
+                continue;
+            }
+            PROFILE_COUNT(ProfileCounter::EVENTS);
+
+            switch (event.type) {
+                case EventType::RELEASE:
+                    releaseJob(event.cpu);
+                    break;
+                case EventType::IO_COMPLETION:
+                    completeIo(event.cpu);
+                    break;
+                case EventType::REFILL:
+                    processGroups->refill(static_cast<uint32_t>(event.cpu));
+                    break;
+                case EventType::COMPLETION:
+                    accountRunningTime(event.cpu);
+                    if (table.remainingTime[event.process] > 0) {
+                        blockProcess<Policy, Traced>(event.cpu);
+                        break;
+                    }
+                    if constexpr (Traced) {
+                        if (isTraceEnabled()) {
+                            PROFILE_SCOPE(ProfilePhase::OUTPUT);
+                            traceEvent(event.cpu) << "Process " << table.name(event.process) << " completed\n";
+                        }
+                    }
+                    completeProcessExecution(event.process);
+                    break;
+                case EventType::QUANTUM_EXPIRY:
+                    // Requeue, or keep running if nobody else waits for this CPU
+                    PROFILE_COUNT(ProfileCounter::QUANTUM_EXPIRIES);
+                    accountRunningTime(event.cpu);
+                    callOnQuantumExpired<Policy>(event.process, event.cpu);
+                    if (getRunQueue(event.cpu).empty() &&
+                        !(processGroups && processGroups->isProcessThrottled(event.process))) {
+                        beginTimeSlice<Policy>(event.cpu);
+                    } else {
+                        if constexpr (Traced) {
+                            if (isTraceEnabled()) {
+                                PROFILE_SCOPE(ProfilePhase::OUTPUT);
+                                traceEvent(event.cpu) << "Process " << table.name(event.process) << " preempted\n";
+                            }
+                        }
+                        preemptCurrentProcess(event.cpu);
+                    }
+                    break;
+                case EventType::BALANCE:
+                    balancePending = false;
+                    balanceDue = true;
+                    break;
+                case EventType::TIMER:
+                    timerPending = false;
+                    callOnTimer<Policy>();
+                    break;
+            }
+        }
+
+        if (balanceDue) {
+            balanceRunQueues();
+        }
+
+        // Dispatch the next process on every idle CPU
+        if (busyCpus < cpuCount) {
+            for (int cpu = 0; cpu < cpuCount; ++cpu) {
+                if (cpus[cpu].current != INVALID_PROCESS) continue;
+                if (getRunQueue(cpu).empty() && !(stealing && stealWork(cpu))) continue;
+                dispatchProcess<Policy, Traced>(callSelectNextProcess<Policy>(cpu), cpu);
+            }
+        }
+
+        if (isPreemptive && busyCpus > 0) {
+            PROFILE_SCOPE(ProfilePhase::PREEMPTION);
+            checkPreemption<Policy, Traced>();
+        }
+        if (busyCpus < cpuCount) {
+            PROFILE_COUNT(ProfileCounter::IDLE_STEPS);
+        }
+
+        // Balance again after one interval while there is work on the CPUs
+        if (periodic && !balancePending && busyCpus > 0) {
+            scheduleEvent(currentTime + balanceInterval, EventType::BALANCE, INVALID_PROCESS);
+            balancePending = true;
+        }
+        if (timerInterval > 0 && !timerPending && busyCpus > 0) {
+            scheduleEvent(currentTime + timerInterval, EventType::TIMER, INVALID_PROCESS);
+            timerPending = true;
+        }
+
+        // Abandon the run once it can no longer stay within the cutoff
+        if constexpr (Cutoff) {
+            if (cutoffEnabled && getMetricTotal(cutoffMetric) > cutoffLimit) {
+                cutOff = true;
+                if (traceSink) traceSink->flush();
+                return false;
+            }
+        }
+    }
+
+    {
+        PROFILE_SCOPE(ProfilePhase::STATISTICS);
+        calculateStatistics();
+    }
+    if (traceSink) traceSink->flush();
+    return true;
+}
+
+/**
+ * Dispatch Process Implementation
+ */
+template <class Policy, bool Traced>
+void Scheduler::dispatchProcess(ProcessHandle process, int cpu) {
+    if (process == INVALID_PROCESS) return;
+    PROFILE_SCOPE(ProfilePhase::DISPATCH);
+    PROFILE_COUNT(ProfileCounter::DISPATCHES);
+
+    CpuState& state = cpus[cpu];
+    SimTime overhead = 0;
+    if (state.lastDispatched != process) {
+        if (state.lastDispatched != INVALID_PROCESS) {
+            contextSwitches++;
+            state.stats.contextSwitches++;
+            overhead += dispatchCosts.contextSwitch;
+        }
+        overhead += dispatchCosts.cacheWarmup;
+    }
+    if (cpus.size() > 1 && table.lastCpu[process] >= 0 && table.lastCpu[process] != cpu) {
+        overhead += dispatchCosts.migration;
+    }
+    state.lastDispatched = process;
+    state.overheadEnd = currentTime + overhead;
+
+    startProcessExecution(process, cpu);
+    if constexpr (Traced) {
+        if (isTraceEnabled()) {
+            PROFILE_SCOPE(ProfilePhase::OUTPUT);
+            traceEvent(cpu) << callGetDispatchMessage<Policy>(process) << '\n';
+            if (overhead > 0) {
+                traceEvent(cpu) << "Dispatch overhead of " << overhead << " time units\n";
+            }
+        }
+    }
+    beginTimeSlice<Policy>(cpu);
+}
+
+/**
+ * Begin Time Slice Implementation
+ * Only one slice-end event is ever pending per CPU. A slice never runs past
+ * the end of the current CPU burst, nor past the quota its process group
+ * was granted.
+ */
+template <class Policy>
+void Scheduler::beginTimeSlice(int cpu) {
+    ProcessHandle process = cpus[cpu].current;
+    if (process == INVALID_PROCESS) return;
+
+    cpus[cpu].sliceStart = currentTime;
+    SimTime start = max(currentTime, cpus[cpu].overheadEnd);
+    int remaining = table.burstRemaining(process);
+    int slice = callGetTimeSlice<Policy>(process);
+    if (slice <= 0 || slice > remaining) {
+        slice = remaining;
+    }
+    if (processGroups) {
+        // May schedule a refill, so the slice event is numbered afterwards
+        slice = static_cast<int>(processGroups->grant(cpu, process, slice, start));
+    }
+
+    cpus[cpu].sliceEvent = eventSequence;
+    if (slice >= remaining) {
+        scheduleEvent(start + remaining, EventType::COMPLETION, process, cpu);
+    } else {
+        scheduleEvent(start + slice, EventType::QUANTUM_EXPIRY, process, cpu);
+    }
+}
+
+/**
+ * Block Process Implementation
+ */
+template <class Policy, bool Traced>
+void Scheduler::blockProcess(int cpu) {
+    ProcessHandle process = cpus[cpu].current;
+    const IoBurst& request = workload->ioBurst(process, table.ioCursor[process]);
+
+    callOnProcessBlocked<Policy>(process, cpu);
+    if (processGroups) {
+        processGroups->release(cpu);
+    }
+    if constexpr (Traced) {
+        if (isTraceEnabled()) {
+            PROFILE_SCOPE(ProfilePhase::OUTPUT);
+            traceEvent(cpu) << "Process " << table.name(process) << " blocked on device "
+                            << request.device << " for " << request.duration << '\n';
+        }
+        if (traceRecorder) {
+            traceRecorder->record(currentTime, table.pid(process), TraceEventType::BLOCK,
+                                  static_cast<uint8_t>(cpu));
+        }
+    }
+    cpus[cpu].current = INVALID_PROCESS;
+    cpus[cpu].sliceEvent = -1;
+    busyCpus--;
+    table.state[process] = ProcessState::WAITING;
+
+    if (request.device >= devices.size()) {
+        devices.resize(request.device + 1u);
+    }
+    deviceCount = max<size_t>(deviceCount, request.device + 1u);
+    IoDevice& device = devices[request.device];
+    if (device.current == INVALID_PROCESS) {
+        startIo(request.device, process);
+    } else {
+        device.queue.push_back({process, currentTime});
+        device.stats.maxQueueLength = max(device.stats.maxQueueLength, device.queue.size());
+    }
+}
+
+/**
+ * Check Preemption Implementation
+ */
+template <class Policy, bool Traced>
+void Scheduler::checkPreemption() {
+    auto preempt = [this](int cpu) {
+        if constexpr (Traced) {
+            if (isTraceEnabled()) {
+                PROFILE_SCOPE(ProfilePhase::OUTPUT);
+                traceEvent(cpu) << "Process " << table.name(cpus[cpu].current) << " preempted\n";
+            }
+        }
+        PROFILE_COUNT(ProfileCounter::PREEMPTIONS);
+        preemptCurrentProcess(cpu);
+        dispatchProcess<Policy, Traced>(callSelectNextProcess<Policy>(cpu), cpu);
+    };
+
+    const int cpuCount = static_cast<int>(cpus.size());
+    if (loadBalancing != LoadBalancing::GLOBAL_QUEUE) {
+        // Per-CPU run queues: each queue only competes with its own CPU
+        for (int cpu = 0; cpu < cpuCount; ++cpu) {
+            CpuState& state = cpus[cpu];
+            if (state.current == INVALID_PROCESS || state.runQueue->empty()) continue;
+            accountRunningTime(cpu);
+            ProcessHandle candidate = state.runQueue->top();
+            if (processGroups && !processGroups->sameGroup(state.current, candidate)) continue;
+            if (callShouldPreempt<Policy>(state.current, candidate, cpu)) {
+                preempt(cpu);
+            }
+        }
+        return;
+    }
+
+    // Shared queue: the queue top displaces the worst running process (of
+    // its own group, with process groups)
+    for (int cpu = 0; cpu < cpuCount; ++cpu) {
+        accountRunningTime(cpu);
+    }
+    while (!readyQueue->empty()) {
+        ProcessHandle candidate = readyQueue->top();
+        int victim = -1;
+        for (int cpu = 0; cpu < cpuCount; ++cpu) {
+            ProcessHandle running = cpus[cpu].current;
+            if (running == INVALID_PROCESS) continue;
+            if (processGroups && !processGroups->sameGroup(running, candidate)) continue;
+            if (victim < 0 || readyQueue->outranks(cpus[victim].current, running)) victim = cpu;
+        }
+        if (victim < 0 || !callShouldPreempt<Policy>(cpus[victim].current, candidate, victim)) {
+            return;
+        }
+        preempt(victim);
+    }
+}
+
+#endif // SCHEDULING_KERNEL_H
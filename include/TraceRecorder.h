@@ -0,0 +1,252 @@
+/**
+ * TraceRecorder.h - Binary Execution Trace Recorder HEADER FILE
+ *
+ * This header file defines the compact binary event log of a simulation run
+ * and the offline exporter that turns it into a Gantt chart. Every scheduling
+ * event is one fixed-size (time, pid, event type, cpu) record. Records are
+ * appended to a preallocated buffer and written to disk in large chunks, so
+ * recording costs a couple of stores per event and can stay enabled for very
+ * large trace replays.
+ *
+ */
+
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+#include <cstdint>      // For fixed-width record fields
+#include <fstream>      // For the log file
+#include <memory>       // For smart pointers
+#include <string>       // For file paths
+#include <vector>       // For the record buffer
+
+#include "ProcessTable.h" // Include workload definition (process names)
+
+using namespace std;
+
+// ========================================================================================
+// TRACE RECORDS
+// ========================================================================================
+
+/**
+ * Trace Event Type
+ */
+enum class TraceEventType : uint8_t {
+    ARRIVAL = 0,        // Process entered the ready queue for the first time
+    DISPATCH = 1,       // Process was given the CPU
+    PREEMPT = 2,        // Process was taken off the CPU before finishing
+    COMPLETE = 3,       // Process finished its last CPU burst
+    BLOCK = 4,          // Process left the CPU to wait for I/O
+    WAKEUP = 5          // Process finished its I/O (cpu holds the device index)
+};
+
+/**
+ * Get Trace Event Type Name
+ *
+ * @param type - Event type
+ * @return Lower-case event name
+ */
+const char* traceEventTypeToString(TraceEventType type);
+
+/**
+ * Trace Record
+ * One scheduling event, 16 bytes on disk and in memory
+ */
+struct TraceRecord {
+    int64_t time;               // Simulation time of the event
+    int32_t pid;                // Process ID
+    TraceEventType type;        // What happened
+    uint8_t cpu;                // CPU the event happened on
+    uint16_t reserved;          // Padding (zero)
+};
+
+static_assert(sizeof(TraceRecord) == 16, "TraceRecord must stay 16 bytes");
+
+// ========================================================================================
+// TRACE RECORDER
+// ========================================================================================
+
+/**
+ * Trace Recorder
+ *
+ * Append-only writer of a binary trace file. record() only stores into the
+ * preallocated buffer; the buffer is written out with one large write when it
+ * fills up, on flush() and on close().
+ *
+ * File layout (native byte order, version 1):
+ *   header   magic "OSSTRACE", version, recordSize
+ *   records  TraceRecord[...] until end of file
+ *
+ * A recorder is not thread-safe: give every concurrently running scheduler
+ * its own recorder.
+ */
+class TraceRecorder {
+private:
+    ofstream output;                // Log file
+    string path;                    // Log file path
+    vector<TraceRecord> buffer;     // Preallocated record buffer
+    size_t used;                    // Records pending in the buffer
+    uint64_t recordCount;           // Records written since open()
+    bool failed;                    // Whether a write failed
+
+    /**
+     * Write Buffer
+     * Writes the pending records with one write call
+     */
+    void writeBuffer();
+
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 64 * 1024;  // Records buffered (1 MiB)
+
+    /**
+     * Trace Recorder Constructor
+     *
+     * @param capacity - Records buffered before a write (default: 64 Ki)
+     */
+    explicit TraceRecorder(size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * Destructor
+     * Closes the log, writing any pending records
+     */
+    ~TraceRecorder();
+
+    TraceRecorder(const TraceRecorder&) = delete;
+    TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+    /**
+     * Open Log
+     * Creates (or truncates) the log file and writes its header
+     *
+     * @param filePath - Destination file
+     * @return True if the file was created
+     */
+    bool open(const string& filePath);
+
+    /**
+     * Close Log
+     * Writes pending records and closes the file
+     *
+     * @return True if every record was written
+     */
+    bool close();
+
+    /**
+     * Is Open
+     *
+     * @return Whether a log file is open
+     */
+    bool isOpen() const { return output.is_open(); }
+
+    /**
+     * Record Event
+     * Hot path: one 16-byte store, plus a chunked write every capacity records
+     *
+     * @param time - Simulation time
+     * @param pid - Process ID
+     * @param type - Event type
+     * @param cpu - CPU index (default: 0)
+     */
+    void record(int64_t time, int32_t pid, TraceEventType type, uint8_t cpu = 0) {
+        buffer[used++] = {time, pid, type, cpu, 0};
+        if (used == buffer.size()) {
+            writeBuffer();
+        }
+    }
+
+    /**
+     * Flush
+     * Writes pending records to the file
+     */
+    void flush();
+
+    /**
+     * Get Record Count
+     *
+     * @return Records recorded since open()
+     */
+    uint64_t getRecordCount() const { return recordCount + used; }
+};
+
+// ========================================================================================
+// TRACE EXPORTER
+// ========================================================================================
+
+/**
+ * Gantt Segment
+ * One interval during which a process held a CPU
+ */
+struct GanttSegment {
+    int cpu = 0;                            // CPU the process ran on
+    int pid = 0;                            // Process ID
+    int64_t start = 0;                      // Dispatch time
+    int64_t end = 0;                        // Preemption or completion time
+    TraceEventType endType = TraceEventType::COMPLETE;  // How the segment ended
+};
+
+/**
+ * Trace Exporter
+ *
+ * Offline conversion of a binary trace into a Gantt chart. Static helpers in
+ * the style of WorkloadLoader; errors are reported on cerr.
+ */
+class TraceExporter {
+public:
+    /**
+     * Read Trace
+     *
+     * @param path - Binary trace written by TraceRecorder
+     * @param records - Receives the records in file order
+     * @return True if the file was valid
+     */
+    static bool readTrace(const string& path, vector<TraceRecord>& records);
+
+    /**
+     * Build Gantt Segments
+     * Pairs every dispatch with the next preemption or completion on its CPU
+     *
+     * @param records - Trace records in recording order
+     * @return Segments ordered by start time per CPU
+     */
+    static vector<GanttSegment> buildSegments(const vector<TraceRecord>& records);
+
+    /**
+     * Export Chrome Trace JSON
+     * Writes the Trace Event Format read by chrome://tracing and Perfetto:
+     * one complete ("X") event per segment on a track per CPU, and one
+     * instant event per arrival. One simulation time unit is one microsecond.
+     *
+     * @param records - Trace records
+     * @param outputPath - Destination JSON file
+     * @param workload - Source of process names (nullptr labels by PID)
+     * @return True if the file was written
+     */
+    static bool exportChromeJson(const vector<TraceRecord>& records, const string& outputPath,
+                                 const Workload* workload = nullptr);
+
+    /**
+     * Export Gantt CSV
+     * One "cpu,pid,name,start,end,duration,end_event" row per segment
+     *
+     * @param records - Trace records
+     * @param outputPath - Destination CSV file
+     * @param workload - Source of process names (nullptr labels by PID)
+     * @return True if the file was written
+     */
+    static bool exportCsv(const vector<TraceRecord>& records, const string& outputPath,
+                          const Workload* workload = nullptr);
+
+    /**
+     * Export Trace File
+     * Reads a binary trace and writes CSV if the output path ends in ".csv",
+     * Chrome trace JSON otherwise
+     *
+     * @param tracePath - Binary trace to read
+     * @param outputPath - Destination file
+     * @param workload - Source of process names (nullptr labels by PID)
+     * @return True if the export succeeded
+     */
+    static bool exportFile(const string& tracePath, const string& outputPath,
+                           const Workload* workload = nullptr);
+};
+
+#endif // TRACE_RECORDER_H
@@ -0,0 +1,92 @@
+/**
+ * TraceSink.h - Buffered Execution Trace Output HEADER FILE
+ *
+ * This header file defines the TraceSink used by the schedulers for their
+ * human-readable execution trace. Lines are formatted into a large in-memory
+ * buffer and written to the output stream in chunks, instead of flushing the
+ * stream after every event with endl.
+ *
+ */
+
+#ifndef TRACE_SINK_H
+#define TRACE_SINK_H
+
+#include <cstdint>      // For fixed-width integers
+#include <iostream>     // For the output stream
+#include <string>       // For the line buffer
+#include <string_view>  // For non-owning text
+
+using namespace std;
+
+// ========================================================================================
+// VERBOSITY LEVELS
+// ========================================================================================
+
+/**
+ * Verbosity Level
+ * How much a scheduler reports while it runs
+ */
+enum class Verbosity {
+    QUIET = 0,      // Nothing but errors; the hot path does no output formatting
+    NORMAL = 1,     // Setup and progress messages
+    TRACE = 2       // Plus one line per scheduling event
+};
+
+// ========================================================================================
+// TRACE SINK
+// ========================================================================================
+
+/**
+ * Trace Sink
+ *
+ * Append-only text buffer in front of an output stream. The buffer is
+ * written out when it fills up, on flush() and on destruction.
+ */
+class TraceSink {
+private:
+    ostream& output;            // Destination stream
+    string buffer;              // Pending text
+    size_t capacity;            // Buffer size that triggers a write
+
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 64 * 1024;   // Bytes buffered before writing
+
+    /**
+     * Trace Sink Constructor
+     *
+     * @param stream - Destination stream (must outlive the sink)
+     * @param bufferSize - Bytes buffered before writing
+     */
+    explicit TraceSink(ostream& stream = cout, size_t bufferSize = DEFAULT_CAPACITY);
+
+    /**
+     * Destructor
+     * Writes any pending text
+     */
+    ~TraceSink();
+
+    TraceSink(const TraceSink&) = delete;
+    TraceSink& operator=(const TraceSink&) = delete;
+
+    /**
+     * Append Text
+     */
+    TraceSink& operator<<(string_view text);
+    TraceSink& operator<<(const char* text);
+    TraceSink& operator<<(char c);
+
+    /**
+     * Append Integer
+     * Formatted without locale or stream state
+     */
+    TraceSink& operator<<(int64_t value);
+    TraceSink& operator<<(int value);
+
+    /**
+     * Flush
+     * Writes the pending text to the stream and flushes it
+     */
+    void flush();
+};
+
+#endif // TRACE_SINK_H
@@ -0,0 +1,89 @@
+/**
+ * VectorKernels.h - Vectorised Column Kernels HEADER FILE
+ *
+ * This header file declares the bulk kernels that run over the columns of
+ * the process table: metric reductions after a run, workload validation
+ * before it, and the argmin scan of the linear-scan ready queue. Each kernel
+ * has three implementations:
+ * - AVX2, chosen at run time on x86-64 processors that support it
+ * - NEON, on AArch64
+ * - A scalar loop, used everywhere else and when the program is built with
+ *   VECTOR_KERNELS_SCALAR defined
+ * All three return exactly the same results: the reductions add integers.
+ *
+ */
+
+#ifndef VECTOR_KERNELS_H
+#define VECTOR_KERNELS_H
+
+#include <cstddef>      // For size_t
+#include <cstdint>      // For fixed-width integers
+#include <string>       // For the instruction set name
+
+#include "ProcessTable.h" // Include SimTime definition
+
+using namespace std;
+
+// ========================================================================================
+// METRIC REDUCTIONS
+// ========================================================================================
+
+/**
+ * Process Metric Totals
+ * Sums of the per-process metrics over a range of rows
+ */
+struct ProcessMetricTotals {
+    int64_t waiting = 0;        // Sum of the waiting times
+    int64_t turnaround = 0;     // Sum of completion - arrival (0 for rows not completed)
+    int64_t response = 0;       // Sum of start - arrival (-1 for rows not started)
+};
+
+/**
+ * Sum Process Metrics
+ * Computes turnaround and response time per row, as ProcessTable does, and
+ * adds them up together with the waiting times
+ *
+ * @param arrival - Arrival time column
+ * @param start - First dispatch time column (-1 if not started)
+ * @param completion - Completion time column (-1 if not completed)
+ * @param waiting - Waiting time column
+ * @param count - Number of rows
+ * @return Totals over the rows
+ */
+ProcessMetricTotals sumProcessMetrics(const SimTime* arrival, const SimTime* start,
+                                      const SimTime* completion, const SimTime* waiting, size_t count);
+
+// ========================================================================================
+// VALIDATION AND SELECTION
+// ========================================================================================
+
+/**
+ * Find Invalid Process
+ * Locates the first row with a non-positive burst or a negative arrival
+ *
+ * @param arrival - Arrival time column
+ * @param burst - Burst time column
+ * @param count - Number of rows
+ * @return Index of the first invalid row (count if every row is valid)
+ */
+size_t findInvalidProcess(const SimTime* arrival, const int* burst, size_t count);
+
+/**
+ * Find Minimum
+ * Locates the smallest (high, low) key pair, compared high word first
+ *
+ * @param high - Most significant key words
+ * @param low - Least significant key words
+ * @param count - Number of keys
+ * @return Index of the first occurrence of the smallest pair (0 if empty)
+ */
+size_t findMinimum(const int64_t* high, const int64_t* low, size_t count);
+
+/**
+ * Get Vector Instruction Set
+ *
+ * @return "avx2", "neon" or "scalar": the implementation the kernels use
+ */
+string getVectorInstructionSet();
+
+#endif // VECTOR_KERNELS_H
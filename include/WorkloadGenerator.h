@@ -0,0 +1,174 @@
+/**
+ * WorkloadGenerator.h - Synthetic Workload Generator HEADER FILE
+ *
+ * This header file defines a seeded generator of synthetic processes. The
+ * generator is an ArrivalSource: each process is drawn only when the
+ * simulation reaches its arrival, so a stream of any length needs constant
+ * memory. It models:
+ * - Arrivals: all at time 0, a Poisson process, or bursts of closely spaced
+ *   arrivals separated by quiet gaps
+ * - CPU bursts: uniform, exponential, heavy-tailed Pareto or bimodal
+ * - Priorities: a weighted mix of the three classes
+ * Random numbers and sampling are implemented here rather than taken from
+ * <random>, whose distributions differ between standard libraries, so a seed
+ * produces the same trace whichever library the simulator is built with.
+ *
+ */
+
+#ifndef WORKLOAD_GENERATOR_H
+#define WORKLOAD_GENERATOR_H
+
+#include <cstdint>      // For the generator state
+#include <memory>       // For smart pointers
+#include <string>       // For string operations
+
+#include "ArrivalSource.h" // Include the arrival source interface
+
+using namespace std;
+
+// ========================================================================================
+// DISTRIBUTIONS
+// ========================================================================================
+
+/**
+ * Arrival Pattern
+ */
+enum class ArrivalPattern {
+    BATCH,          // Every process at time 0
+    POISSON,        // Exponential gaps at the mean arrival rate
+    BURSTY          // Groups of closely spaced arrivals with quiet gaps between them
+};
+
+/**
+ * Burst Distribution
+ */
+enum class BurstDistribution {
+    UNIFORM,        // Uniform on [1, 2 * mean - 1]
+    EXPONENTIAL,    // Exponential with the given mean
+    PARETO,         // Heavy-tailed Pareto with the given mean
+    BIMODAL         // Mostly short bursts, some long ones, with the given overall mean
+};
+
+/**
+ * Get Arrival Pattern Name
+ *
+ * @param pattern - Pattern to name
+ * @return Lower-case pattern name
+ */
+string arrivalPatternToString(ArrivalPattern pattern);
+
+/**
+ * Get Burst Distribution Name
+ *
+ * @param distribution - Distribution to name
+ * @return Lower-case distribution name
+ */
+string burstDistributionToString(BurstDistribution distribution);
+
+/**
+ * Workload Generator Options
+ * Shape of a synthetic workload; invalid values are replaced by the defaults
+ * with a warning
+ */
+struct WorkloadGeneratorOptions {
+    uint64_t seed = 1;                                      // Same seed, same trace
+    uint64_t count = 1000;                                  // Processes to produce (0 = unbounded)
+    ArrivalPattern arrivals = ArrivalPattern::POISSON;      // Arrival process
+    double arrivalRate = 0.08;                              // Mean arrivals per time unit
+    double burstiness = 10.0;                               // BURSTY: rate inside a group over the mean rate
+    double meanGroupSize = 20.0;                            // BURSTY: mean arrivals per group
+    BurstDistribution bursts = BurstDistribution::EXPONENTIAL;  // CPU burst distribution
+    double meanBurst = 10.0;                                // Mean CPU burst
+    double paretoShape = 1.5;                               // PARETO: tail index (above 1)
+    double longBurstRatio = 20.0;                           // BIMODAL: long burst over short burst
+    double longBurstFraction = 0.1;                         // BIMODAL: share of long bursts
+    int maxBurst = 1000000;                                 // Bursts are clamped to [1, maxBurst]
+    double priorityMix[3] = {1.0, 1.0, 1.0};                // Relative weight of HIGH, MEDIUM, LOW
+    string name = "job";                                    // Name of every generated process
+};
+
+// ========================================================================================
+// WORKLOAD GENERATOR
+// ========================================================================================
+
+/**
+ * Workload Generator
+ *
+ * Produces processes in arrival order from seeded distributions. Processes
+ * get automatic PIDs, so the PIDs follow the arrival order. Bursty arrivals
+ * form groups of geometrically distributed size; gaps inside a group are
+ * burstiness times shorter than average and the gaps between groups make up
+ * the difference, so the long-run arrival rate stays arrivalRate.
+ *
+ * Used with Scheduler::setArrivalSource(generator, false), memory stays
+ * bounded by the processes in the system at once, however long the stream.
+ */
+class WorkloadGenerator : public ArrivalSource {
+private:
+    WorkloadGeneratorOptions options;   // Validated workload shape
+    uint64_t state[4];                  // xoshiro256** state
+    double mixTotal[3];                 // Cumulative priority weights
+    double clock;                       // Arrival time of the last process (unrounded)
+    uint64_t produced;                  // Processes drawn so far
+    uint64_t groupLeft;                 // BURSTY: arrivals left in the current group
+    ProcessSpec pending;                // Next process, already drawn
+    bool hasPending;                    // Whether pending holds a process
+
+    uint64_t nextRandom();
+    double uniform();
+    double exponential(double mean);
+    double drawGap();
+    int drawBurst();
+    Priority drawPriority();
+
+    /**
+     * Draw Next Process
+     * Fills pending, or clears hasPending once count processes were produced
+     */
+    void drawNext();
+
+public:
+    /**
+     * Workload Generator Constructor
+     *
+     * @param shape - Distributions, count and seed (default: WorkloadGeneratorOptions())
+     */
+    explicit WorkloadGenerator(const WorkloadGeneratorOptions& shape = WorkloadGeneratorOptions());
+
+    bool hasNext() const override;
+    SimTime peekArrivalTime() const override;
+    bool next(ProcessSpec& spec) override;
+
+    /**
+     * Rewind
+     * Reseeds the generator, so the same processes are produced again
+     *
+     * @return Always true
+     */
+    bool rewind() override;
+
+    /**
+     * Get Options
+     *
+     * @return Validated workload shape
+     */
+    const WorkloadGeneratorOptions& getOptions() const { return options; }
+
+    /**
+     * Get Produced Count
+     *
+     * @return Processes consumed with next() since the last rewind
+     */
+    uint64_t getProducedCount() const { return produced - (hasPending ? 1 : 0); }
+
+    /**
+     * Generate Workload
+     * Materialises a bounded stream, e.g. to save it or to run it many times
+     *
+     * @param shape - Distributions, count (positive) and seed
+     * @return Generated workload (nullptr if the count is unbounded)
+     */
+    static shared_ptr<Workload> generate(const WorkloadGeneratorOptions& shape);
+};
+
+#endif // WORKLOAD_GENERATOR_H
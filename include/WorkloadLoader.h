@@ -0,0 +1,161 @@
+/**
+ * WorkloadLoader.h - Trace File Workload Loader HEADER FILE
+ *
+ * This header file defines the loader used to replay recorded job traces.
+ * Two on-disk formats are supported:
+ * - CSV: one process per line, "name,arrival,burst[,priority[,io...]]", where
+ *   each io field is an I/O request "cpuBefore:duration[@device]" or a
+ *   real-time attribute "period=N" or "deadline=N" or the process group
+ *   "group=PATH". The file
+ *   is memory-mapped and parsed in place without per-line allocations,
+ *   straight into the workload columns.
+ * - Binary: a compact columnar image of a Workload, written by saveBinary().
+ *   Loading it is a handful of bulk copies, which makes repeated replays of
+ *   very large traces cheap.
+ *
+ */
+
+#ifndef WORKLOAD_LOADER_H
+#define WORKLOAD_LOADER_H
+
+#include <cstdint>      // For fixed-width header fields
+#include <memory>       // For smart pointers
+#include <string>       // For file paths
+#include <string_view>  // For CSV fields
+#include <vector>       // For the I/O request buffer
+
+#include "ProcessTable.h" // Include workload definition
+
+using namespace std;
+
+// ========================================================================================
+// ENUMERATIONS
+// ========================================================================================
+
+/**
+ * Workload File Format
+ */
+enum class WorkloadFormat {
+    AUTO,       // Detect from the file contents
+    CSV,        // Text, one process per line
+    BINARY      // Columnar image written by saveBinary()
+};
+
+// ========================================================================================
+// CSV LINES
+// ========================================================================================
+
+/**
+ * CSV Line Kind
+ * What one line of a CSV trace holds
+ */
+enum class CsvLineKind {
+    BLANK,      // Empty line or '#' comment
+    HEADER,     // Column header (only recognised on the first non-blank line)
+    PROCESS,    // Valid process
+    MALFORMED   // Anything else
+};
+
+/**
+ * CSV Process Line
+ * Fields of one parsed trace line. The views point into the parsed text;
+ * the I/O buffer keeps its storage from line to line
+ */
+struct CsvProcessLine {
+    string_view name;                       // Process name
+    SimTime arrival = 0;                    // Arrival time
+    int burst = 0;                          // Total CPU time
+    Priority priority = Priority::MEDIUM;   // Priority (out of range: MEDIUM)
+    int period = 0;                         // "period=N" (0: released once)
+    int deadline = 0;                       // "deadline=N" (0: the period, or none)
+    string_view group;                      // "group=PATH" (empty: root group)
+    vector<IoBurst> ioBursts;               // I/O requests in order
+};
+
+// ========================================================================================
+// WORKLOAD LOADER
+// ========================================================================================
+
+/**
+ * Workload Loader
+ *
+ * Static helpers that read and write workloads. Errors are reported on cerr;
+ * load functions return nullptr on failure and saveBinary() returns false.
+ *
+ * Binary layout (native byte order, version 4):
+ *   header   magic "OSSWKLD\0", version, processCount, nameCount, nameBytes
+ *   columns  int32 pid[n], int64 arrival[n], int32 burst[n], uint8 priority[n],
+ *            uint32 nameId[n], uint64 nameOffset[nameCount + 1], char names[nameBytes]
+ *   I/O      uint64 offsetCount, uint64 burstCount, uint32 ioOffset[offsetCount],
+ *            int32 cpuBefore[burstCount], int32 duration[burstCount],
+ *            uint16 device[burstCount]
+ *   timing   uint64 timingCount, int32 period[timingCount], int32 deadline[timingCount]
+ *   groups   uint64 groupCount, uint64 pathCount, uint64 pathBytes, uint32 group[groupCount],
+ *            uint64 pathOffset[pathCount + 1], char paths[pathBytes]
+ * Version 3 files (without the group section), version 2 files (without the
+ * timing section either) and version 1 files (without the I/O section) are
+ * still read.
+ */
+class WorkloadLoader {
+public:
+    /**
+     * Load Workload
+     *
+     * @param path - File to read
+     * @param format - File format (default: detect from the file)
+     * @return Loaded workload (nullptr on error)
+     */
+    static shared_ptr<Workload> load(const string& path, WorkloadFormat format = WorkloadFormat::AUTO);
+
+    /**
+     * Load CSV Workload
+     * Empty lines, '#' comments and a leading header line (text in the
+     * arrival and burst columns) are skipped. Malformed lines are reported
+     * and skipped. Names are not interned, so traces with millions of
+     * distinct job names avoid a hash table.
+     *
+     * @param path - CSV file to read
+     * @return Loaded workload (nullptr on error, or if no line was valid)
+     */
+    static shared_ptr<Workload> loadCsv(const string& path);
+
+    /**
+     * Parse CSV Line
+     * The grammar of loadCsv(), shared with StreamArrivalSource so trace files
+     * and live input accept the same lines
+     *
+     * @param line - Line text without its newline
+     * @param firstLine - Whether no earlier line was anything but blank
+     * @param process - Receives the fields of a PROCESS line
+     * @return What the line holds
+     */
+    static CsvLineKind parseCsvLine(string_view line, bool firstLine, CsvProcessLine& process);
+
+    /**
+     * Load Binary Workload
+     *
+     * @param path - Binary workload file to read
+     * @return Loaded workload (nullptr on error or corrupt file)
+     */
+    static shared_ptr<Workload> loadBinary(const string& path);
+
+    /**
+     * Save Binary Workload
+     *
+     * @param workload - Workload to write
+     * @param path - Destination file
+     * @return True if the file was written completely
+     */
+    static bool saveBinary(const Workload& workload, const string& path);
+
+    /**
+     * Detect Format
+     * Binary files are recognised by their magic number; anything else is CSV
+     *
+     * @param path - File to inspect
+     * @return Detected format (AUTO if the file cannot be opened)
+     */
+    static WorkloadFormat detectFormat(const string& path);
+};
+
+#endif // WORKLOAD_LOADER_H
@@ -0,0 +1,92 @@
+/**
+ * ArrivalSource.cpp - Streaming Process Arrival Source Implementation File
+ *
+ * This source file contains the implementation of the stream-backed
+ * arrival source.
+ *
+ */
+
+#include "ArrivalSource.h"
+
+#include <iostream>     // For warnings
+
+#include "WorkloadLoader.h" // Include the CSV line grammar
+
+// ========================================================================================
+// STREAM ARRIVAL SOURCE IMPLEMENTATION
+// ========================================================================================
+
+/**
+ * Stream Arrival Source Constructor Implementation
+ * Parses the first process eagerly so hasNext() and peekArrivalTime() are cheap
+ */
+StreamArrivalSource::StreamArrivalSource(istream& stream)
+    : input(stream), hasPending(false), seenData(false), lastArrivalTime(0), lineNumber(0)
+{
+    readNext();
+}
+
+/**
+ * Read Next Line Implementation
+ * Lines follow the CSV trace grammar (WorkloadLoader::parseCsvLine())
+ */
+void StreamArrivalSource::readNext() {
+    hasPending = false;
+
+    string line;
+    CsvProcessLine row;
+    while (getline(input, line)) {
+        lineNumber++;
+
+        CsvLineKind kind = WorkloadLoader::parseCsvLine(line, !seenData, row);
+        if (kind == CsvLineKind::BLANK) {
+            continue;
+        }
+        seenData = true;
+        if (kind == CsvLineKind::HEADER) {
+            continue;
+        }
+        if (kind == CsvLineKind::MALFORMED) {
+            cerr << "Warning: Skipping malformed process on line " << lineNumber << endl;
+            continue;
+        }
+
+        SimTime arrival = row.arrival;
+        if (arrival < lastArrivalTime) {
+            cerr << "Warning: Process " << row.name << " on line " << lineNumber
+                 << " arrives out of order. Setting arrival to " << lastArrivalTime << "." << endl;
+            arrival = lastArrivalTime;
+        }
+
+        pending.name = string(row.name);
+        pending.arrivalTime = arrival;
+        pending.burstTime = row.burst;
+        pending.priority = row.priority;
+        pending.pid = -1;
+        pending.ioBursts = row.ioBursts;
+        pending.period = row.period;
+        pending.relativeDeadline = row.deadline;
+        pending.group = string(row.group);
+        hasPending = true;
+        lastArrivalTime = arrival;
+        return;
+    }
+}
+
+bool StreamArrivalSource::hasNext() const {
+    return hasPending;
+}
+
+SimTime StreamArrivalSource::peekArrivalTime() const {
+    return hasPending ? pending.arrivalTime : 0;
+}
+
+bool StreamArrivalSource::next(ProcessSpec& spec) {
+    if (!hasPending) {
+        return false;
+    }
+
+    spec = pending;
+    readNext();
+    return true;
+}
@@ -0,0 +1,598 @@
+#include "CFSScheduler.h"
+#include "SchedulingKernel.h"
+
+#include <algorithm>    // For max
+
+using namespace std;
+
+namespace {
+
+const int64_t VRUNTIME_UNIT = 1024;     // Fixed-point vruntime units per time unit at nice 0
+
+/**
+ * Weighted Virtual Time
+ * Converts real run time into virtual runtime for a weight
+ */
+inline int64_t virtualTime(int64_t ran, int weight) {
+    return ran * VRUNTIME_UNIT * CFSScheduler::NICE_0_WEIGHT / weight;
+}
+
+} // namespace
+
+// ========================================================================================
+// CFS RUN QUEUE
+// ========================================================================================
+
+CfsRunQueue::CfsRunQueue(vector<CfsEntity>& shared, const ProcessTable& table, const int* priorityWeights)
+    : ReadyQueue(ReadyQueueOrder::FIFO, table),
+      entities(shared),
+      processes(table),
+      weights(priorityWeights),
+      root(INVALID_PROCESS),
+      leftmost(INVALID_PROCESS),
+      count(0),
+      totalWeight(0),
+      minVruntime(0) {}
+
+int CfsRunQueue::getWeight(ProcessHandle handle) const {
+    return weights[static_cast<int>(processes.priority(handle)) - 1];
+}
+
+int64_t CfsRunQueue::currentVruntime(ProcessHandle handle) const {
+    const CfsEntity& entity = entities[handle];
+    if (entity.runStartRemaining < 0) {
+        return entity.vruntime;
+    }
+    return entity.vruntime + virtualTime(entity.runStartRemaining - processes.remainingTime[handle],
+                                         getWeight(handle));
+}
+
+bool CfsRunQueue::less(ProcessHandle a, ProcessHandle b) const {
+    const CfsEntity& x = entities[a];
+    const CfsEntity& y = entities[b];
+    if (x.vruntime != y.vruntime) return x.vruntime < y.vruntime;
+    return x.sequence < y.sequence;
+}
+
+void CfsRunQueue::rotateLeft(ProcessHandle x) {
+    ProcessHandle y = entities[x].right;
+    entities[x].right = entities[y].left;
+    if (entities[y].left != INVALID_PROCESS) {
+        entities[entities[y].left].parent = x;
+    }
+    ProcessHandle parent = entities[x].parent;
+    entities[y].parent = parent;
+    if (parent == INVALID_PROCESS) {
+        root = y;
+    } else if (entities[parent].left == x) {
+        entities[parent].left = y;
+    } else {
+        entities[parent].right = y;
+    }
+    entities[y].left = x;
+    entities[x].parent = y;
+}
+
+void CfsRunQueue::rotateRight(ProcessHandle x) {
+    ProcessHandle y = entities[x].left;
+    entities[x].left = entities[y].right;
+    if (entities[y].right != INVALID_PROCESS) {
+        entities[entities[y].right].parent = x;
+    }
+    ProcessHandle parent = entities[x].parent;
+    entities[y].parent = parent;
+    if (parent == INVALID_PROCESS) {
+        root = y;
+    } else if (entities[parent].right == x) {
+        entities[parent].right = y;
+    } else {
+        entities[parent].left = y;
+    }
+    entities[y].right = x;
+    entities[x].parent = y;
+}
+
+/**
+ * Insert Fixup
+ * Restores the red-black properties after inserting red node x
+ */
+void CfsRunQueue::insertFixup(ProcessHandle x) {
+    auto isRed = [this](ProcessHandle node) { return node != INVALID_PROCESS && entities[node].red; };
+
+    while (isRed(entities[x].parent)) {
+        ProcessHandle parent = entities[x].parent;
+        ProcessHandle grandparent = entities[parent].parent;
+        if (parent == entities[grandparent].left) {
+            ProcessHandle uncle = entities[grandparent].right;
+            if (isRed(uncle)) {
+                entities[parent].red = false;
+                entities[uncle].red = false;
+                entities[grandparent].red = true;
+                x = grandparent;
+                continue;
+            }
+            if (x == entities[parent].right) {
+                x = parent;
+                rotateLeft(x);
+                parent = entities[x].parent;
+            }
+            entities[parent].red = false;
+            entities[grandparent].red = true;
+            rotateRight(grandparent);
+        } else {
+            ProcessHandle uncle = entities[grandparent].left;
+            if (isRed(uncle)) {
+                entities[parent].red = false;
+                entities[uncle].red = false;
+                entities[grandparent].red = true;
+                x = grandparent;
+                continue;
+            }
+            if (x == entities[parent].left) {
+                x = parent;
+                rotateRight(x);
+                parent = entities[x].parent;
+            }
+            entities[parent].red = false;
+            entities[grandparent].red = true;
+            rotateLeft(grandparent);
+        }
+    }
+    entities[root].red = false;
+}
+
+/**
+ * Erase Fixup
+ * Restores the red-black properties after removing a black node; x took its
+ * place (possibly empty) below parent
+ */
+void CfsRunQueue::eraseFixup(ProcessHandle x, ProcessHandle parent) {
+    auto isRed = [this](ProcessHandle node) { return node != INVALID_PROCESS && entities[node].red; };
+
+    while (x != root && !isRed(x)) {
+        if (x == entities[parent].left) {
+            ProcessHandle sibling = entities[parent].right;
+            if (isRed(sibling)) {
+                entities[sibling].red = false;
+                entities[parent].red = true;
+                rotateLeft(parent);
+                sibling = entities[parent].right;
+            }
+            if (!isRed(entities[sibling].left) && !isRed(entities[sibling].right)) {
+                entities[sibling].red = true;
+                x = parent;
+                parent = entities[x].parent;
+                continue;
+            }
+            if (!isRed(entities[sibling].right)) {
+                entities[entities[sibling].left].red = false;
+                entities[sibling].red = true;
+                rotateRight(sibling);
+                sibling = entities[parent].right;
+            }
+            entities[sibling].red = entities[parent].red;
+            entities[parent].red = false;
+            entities[entities[sibling].right].red = false;
+            rotateLeft(parent);
+        } else {
+            ProcessHandle sibling = entities[parent].left;
+            if (isRed(sibling)) {
+                entities[sibling].red = false;
+                entities[parent].red = true;
+                rotateRight(parent);
+                sibling = entities[parent].left;
+            }
+            if (!isRed(entities[sibling].left) && !isRed(entities[sibling].right)) {
+                entities[sibling].red = true;
+                x = parent;
+                parent = entities[x].parent;
+                continue;
+            }
+            if (!isRed(entities[sibling].left)) {
+                entities[entities[sibling].right].red = false;
+                entities[sibling].red = true;
+                rotateLeft(sibling);
+                sibling = entities[parent].left;
+            }
+            entities[sibling].red = entities[parent].red;
+            entities[parent].red = false;
+            entities[entities[sibling].left].red = false;
+            rotateRight(parent);
+        }
+        x = root;
+    }
+    if (x != INVALID_PROCESS) {
+        entities[x].red = false;
+    }
+}
+
+/**
+ * Erase Implementation
+ * Classic red-black deletion; z's in-order successor takes its place when
+ * z has two children
+ */
+void CfsRunQueue::erase(ProcessHandle z) {
+    auto transplant = [this](ProcessHandle u, ProcessHandle v) {
+        ProcessHandle parent = entities[u].parent;
+        if (parent == INVALID_PROCESS) {
+            root = v;
+        } else if (entities[parent].left == u) {
+            entities[parent].left = v;
+        } else {
+            entities[parent].right = v;
+        }
+        if (v != INVALID_PROCESS) {
+            entities[v].parent = parent;
+        }
+    };
+
+    ProcessHandle x;
+    ProcessHandle xParent;
+    bool removedRed = entities[z].red;
+
+    if (entities[z].left == INVALID_PROCESS) {
+        x = entities[z].right;
+        xParent = entities[z].parent;
+        transplant(z, x);
+    } else if (entities[z].right == INVALID_PROCESS) {
+        x = entities[z].left;
+        xParent = entities[z].parent;
+        transplant(z, x);
+    } else {
+        ProcessHandle y = entities[z].right;
+        while (entities[y].left != INVALID_PROCESS) {
+            y = entities[y].left;
+        }
+        removedRed = entities[y].red;
+        x = entities[y].right;
+        if (entities[y].parent == z) {
+            xParent = y;
+        } else {
+            xParent = entities[y].parent;
+            transplant(y, x);
+            entities[y].right = entities[z].right;
+            entities[entities[y].right].parent = y;
+        }
+        transplant(z, y);
+        entities[y].left = entities[z].left;
+        entities[entities[y].left].parent = y;
+        entities[y].red = entities[z].red;
+    }
+
+    if (!removedRed) {
+        eraseFixup(x, xParent);
+    }
+    entities[z].parent = entities[z].left = entities[z].right = INVALID_PROCESS;
+}
+
+/**
+ * Push Implementation
+ * A process coming off the CPU is charged the virtual time it ran. Any other
+ * process (new, or migrated from another CPU) starts no earlier than the
+ * queue's minimum vruntime, so it cannot claim CPU time it never waited for.
+ */
+void CfsRunQueue::push(ProcessHandle handle) {
+    if (handle >= entities.size()) {
+        entities.resize(handle + 1);
+    }
+    int weight = getWeight(handle);
+    CfsEntity& entity = entities[handle];
+    if (entity.runStartRemaining >= 0) {
+        entity.vruntime += virtualTime(entity.runStartRemaining - processes.remainingTime[handle], weight);
+        entity.runStartRemaining = -1;
+    } else {
+        entity.vruntime = max(entity.vruntime, minVruntime);
+    }
+    entity.sequence = nextSequence++;
+    entity.left = entity.right = INVALID_PROCESS;
+    entity.red = true;
+
+    // Descend to the insertion point, noting whether we only went left
+    ProcessHandle parent = INVALID_PROCESS;
+    ProcessHandle node = root;
+    bool isLeftmost = true;
+    while (node != INVALID_PROCESS) {
+        parent = node;
+        if (less(handle, node)) {
+            node = entities[node].left;
+        } else {
+            node = entities[node].right;
+            isLeftmost = false;
+        }
+    }
+    entities[handle].parent = parent;
+    if (parent == INVALID_PROCESS) {
+        root = handle;
+    } else if (less(handle, parent)) {
+        entities[parent].left = handle;
+    } else {
+        entities[parent].right = handle;
+    }
+    if (isLeftmost) {
+        leftmost = handle;
+    }
+
+    insertFixup(handle);
+    count++;
+    totalWeight += weight;
+}
+
+ProcessHandle CfsRunQueue::top() const {
+    return leftmost;
+}
+
+/**
+ * Pop Implementation
+ * The leftmost node has no left child, so its successor is the leftmost
+ * node of its right subtree or, failing that, its parent
+ */
+ProcessHandle CfsRunQueue::pop() {
+    ProcessHandle handle = leftmost;
+    if (handle == INVALID_PROCESS) return INVALID_PROCESS;
+
+    ProcessHandle successor = entities[handle].right;
+    if (successor != INVALID_PROCESS) {
+        while (entities[successor].left != INVALID_PROCESS) {
+            successor = entities[successor].left;
+        }
+    } else {
+        successor = entities[handle].parent;
+    }
+
+    erase(handle);
+    leftmost = successor;
+    count--;
+    totalWeight -= getWeight(handle);
+    minVruntime = max(minVruntime, entities[handle].vruntime);
+    return handle;
+}
+
+size_t CfsRunQueue::size() const {
+    return count;
+}
+
+/**
+ * Clear Implementation
+ * Links of the removed entities are reset when they are pushed again
+ */
+void CfsRunQueue::clear() {
+    root = INVALID_PROCESS;
+    leftmost = INVALID_PROCESS;
+    count = 0;
+    totalWeight = 0;
+    minVruntime = 0;
+}
+
+void CfsRunQueue::collect(vector<ProcessHandle>& out) const {
+    ProcessHandle node = leftmost;
+    while (node != INVALID_PROCESS) {
+        out.push_back(node);
+        if (entities[node].right != INVALID_PROCESS) {
+            node = entities[node].right;
+            while (entities[node].left != INVALID_PROCESS) {
+                node = entities[node].left;
+            }
+            continue;
+        }
+        ProcessHandle child = node;
+        node = entities[node].parent;
+        while (node != INVALID_PROCESS && entities[node].right == child) {
+            child = node;
+            node = entities[node].parent;
+        }
+    }
+}
+
+bool CfsRunQueue::outranks(ProcessHandle a, ProcessHandle b) const {
+    return currentVruntime(a) < currentVruntime(b);
+}
+
+// ========================================================================================
+// CFS SCHEDULER
+// ========================================================================================
+
+/**
+ * CFS Constructor
+ * Weights are the Linux nice -5, 0 and +5 load weights
+ */
+CFSScheduler::CFSScheduler(SimTime latency, SimTime granularity)
+    : Scheduler("CFS", true),
+      targetLatency(1),
+      minGranularity(1),
+      wakeupGranularity(1),
+      weights{3121, NICE_0_WEIGHT, 335} {
+    setMinGranularity(granularity);
+    setTargetLatency(latency);
+    rebuildReadyQueues();
+}
+
+/**
+ * Implements the Completely Fair Scheduler (CFS)
+ *
+ * Algorithm flow:
+ * 1. Run the shared event loop:
+ *    - Arrivals enter the tree at the queue's minimum vruntime and preempt the
+ *      running process if they trail it by more than the wakeup granularity.
+ *    - The process with the smallest vruntime is dispatched for its weighted
+ *      share of the scheduling period.
+ *    - When the slice ends the process is charged its weighted run time and
+ *      re-enters the tree, unless nothing else is runnable.
+ *    - A process blocking for I/O is charged when it leaves the CPU and, like
+ *      an arrival, re-enters no earlier than the queue's minimum vruntime.
+ * 2. Stop when all processes are terminated.
+ */
+bool CFSScheduler::schedule() {
+    if (isTraceEnabled()) {
+        trace() << "\n=== CFS Scheduling Execution (latency " << static_cast<int64_t>(targetLatency)
+                << ", granularity " << static_cast<int64_t>(minGranularity) << ") ===\n";
+    }
+
+    entities.assign(entities.size(), CfsEntity());
+    return runEventLoop<CFSScheduler>();
+}
+
+/**
+ * Set Target Latency Implementation
+ */
+void CFSScheduler::setTargetLatency(SimTime latency) {
+    if (latency < minGranularity) {
+        cerr << "Warning: CFS target latency must be at least the minimum granularity. Using "
+             << minGranularity << "." << endl;
+        latency = minGranularity;
+    }
+    targetLatency = latency;
+}
+
+/**
+ * Set Minimum Granularity Implementation
+ */
+void CFSScheduler::setMinGranularity(SimTime granularity) {
+    if (granularity <= 0) {
+        cerr << "Warning: CFS minimum granularity must be positive. Using 1." << endl;
+        granularity = 1;
+    }
+    minGranularity = granularity;
+    wakeupGranularity = granularity;
+    if (targetLatency < minGranularity) {
+        targetLatency = minGranularity;
+    }
+}
+
+/**
+ * Set Priority Weight Implementation
+ */
+void CFSScheduler::setPriorityWeight(Priority priority, int weight) {
+    if (weight <= 0) {
+        cerr << "Warning: Ignoring non-positive CFS weight " << weight << endl;
+        return;
+    }
+    weights[static_cast<int>(priority) - 1] = weight;
+}
+
+CfsRunQueue& CFSScheduler::cfsQueue(int cpu) const {
+    return static_cast<CfsRunQueue&>(*cpus[cpu].queue);
+}
+
+CfsRunQueue& CFSScheduler::cfsQueue(int cpu, ProcessHandle process) const {
+    return static_cast<CfsRunQueue&>(getPolicyQueue(cpu, process));
+}
+
+int CFSScheduler::cpuOf(ProcessHandle process) const {
+    return cpus.size() > 1 ? table.lastCpu[process] : 0;
+}
+
+unique_ptr<ReadyQueue> CFSScheduler::createRunQueue(ReadyQueueOrder) {
+    return make_unique<CfsRunQueue>(entities, table, weights);
+}
+
+/**
+ * Select Next Process
+ * Takes the leftmost process and starts measuring its slice
+ */
+ProcessHandle CFSScheduler::selectNextProcess(int cpu) {
+    ProcessHandle process = getRunQueue(cpu).pop();
+    entities[process].runStartRemaining = table.remainingTime[process];
+    return process;
+}
+
+/**
+ * Weighted share of the scheduling period, never below the minimum granularity.
+ * A shared queue serves every CPU, so its load is split between them.
+ */
+int CFSScheduler::getTimeSlice(ProcessHandle process) const {
+    const CfsRunQueue& queue = cfsQueue(cpuOf(process), process);
+    int64_t sharing = loadBalancing == LoadBalancing::GLOBAL_QUEUE ? static_cast<int64_t>(cpus.size()) : 1;
+    int64_t weight = queue.getWeight(process);
+    int64_t runnable = static_cast<int64_t>(queue.size()) / sharing + 1;
+    int64_t totalWeight = queue.getTotalWeight() / sharing + weight;
+
+    int64_t period = max<int64_t>(targetLatency, runnable * minGranularity);
+    int64_t slice = max<int64_t>(period * weight / totalWeight, minGranularity);
+    return static_cast<int>(min<int64_t>(slice, table.remainingTime[process]));
+}
+
+string CFSScheduler::getDispatchMessage(ProcessHandle process) const {
+    return "Process " + string(table.name(process)) + " (vruntime " +
+           to_string(entities[process].vruntime / VRUNTIME_UNIT) + ") started/resumed";
+}
+
+/**
+ * Charge the burst now, so the wakeup is placed like a new arrival
+ */
+void CFSScheduler::onProcessBlocked(ProcessHandle process, int cpu) {
+    entities[process].vruntime = cfsQueue(cpu, process).currentVruntime(process);
+    entities[process].runStartRemaining = -1;
+}
+
+/**
+ * The new process is placed like any other arrival
+ */
+void CFSScheduler::onProcessRecycled(ProcessHandle process) {
+    if (process < entities.size()) {
+        entities[process] = CfsEntity();
+    }
+}
+
+/**
+ * Saved state: the minimum vruntime of every queue, then the vruntime and
+ * slice start of every process
+ */
+void CFSScheduler::savePolicyState(vector<int64_t>& state) const {
+    const size_t queueCount = loadBalancing == LoadBalancing::GLOBAL_QUEUE ? 1 : cpus.size();
+    for (size_t queue = 0; queue < queueCount; ++queue) {
+        state.push_back(cfsQueue(static_cast<int>(queue)).getMinVruntime());
+    }
+    state.push_back(static_cast<int64_t>(entities.size()));
+    for (const CfsEntity& entity : entities) {
+        state.push_back(entity.vruntime);
+        state.push_back(entity.runStartRemaining);
+    }
+}
+
+/**
+ * The tree is keyed by the entities, so it is rebuilt once they are back.
+ * Under another policy every process starts at vruntime 0 and running
+ * processes are charged from the snapshot time on.
+ */
+void CFSScheduler::restorePolicyState(const SchedulerSnapshot& source, bool samePolicy) {
+    for (size_t queue = 0; queue < source.queues.size(); ++queue) {
+        cfsQueue(static_cast<int>(queue)).clear();
+    }
+    entities.assign(table.size(), CfsEntity());
+
+    if (samePolicy) {
+        const vector<int64_t>& state = source.policyState;
+        size_t word = 0;
+        for (size_t queue = 0; queue < source.queues.size(); ++queue) {
+            cfsQueue(static_cast<int>(queue)).setMinVruntime(state[word++]);
+        }
+        size_t count = min(static_cast<size_t>(state[word++]), entities.size());
+        for (size_t process = 0; process < count; ++process) {
+            entities[process].vruntime = state[word++];
+            entities[process].runStartRemaining = static_cast<int>(state[word++]);
+        }
+    } else {
+        for (const CpuState& cpu : cpus) {
+            if (cpu.current != INVALID_PROCESS) {
+                entities[cpu.current].runStartRemaining = table.remainingTime[cpu.current];
+            }
+        }
+    }
+
+    for (size_t queue = 0; queue < source.queues.size(); ++queue) {
+        CfsRunQueue& target = cfsQueue(static_cast<int>(queue));
+        for (ProcessHandle process : source.queues[queue]) {
+            target.push(process);
+        }
+    }
+}
+
+/**
+ * Wakeup preemption: the candidate must trail the running process by more
+ * than the wakeup granularity, in the candidate's virtual time
+ */
+bool CFSScheduler::shouldPreempt(ProcessHandle running, ProcessHandle candidate, int cpu) const {
+    const CfsRunQueue& queue = cfsQueue(cpu, running);
+    int64_t lead = queue.currentVruntime(running) - queue.currentVruntime(candidate);
+    return lead > virtualTime(wakeupGranularity, queue.getWeight(candidate));
+}
@@ -0,0 +1,317 @@
+/**
+ * ComparisonRunner.cpp - Parallel Multi-Algorithm Comparison Implementation File
+ *
+ * This source file contains the implementation of the worker thread pool
+ * and the comparison runner built on it.
+ *
+ */
+
+#include "ComparisonRunner.h"
+
+#include <algorithm>    // For min
+#include <atomic>       // For the shared work counter
+#include <chrono>       // For wall-clock timing
+#include <iomanip>      // For formatted output
+#include <iostream>     // For output operations
+#include <thread>       // For worker threads
+
+// ========================================================================================
+// PARALLEL EXECUTION IMPLEMENTATION
+// ========================================================================================
+
+/**
+ * Run Parallel Implementation
+ */
+void runParallel(size_t jobCount, size_t threads, const function<void(size_t)>& job) {
+    if (threads == 0) {
+        threads = thread::hardware_concurrency();
+    }
+    size_t workers = min(max<size_t>(threads, 1), jobCount);
+
+    if (workers <= 1) {
+        for (size_t i = 0; i < jobCount; ++i) {
+            job(i);
+        }
+        return;
+    }
+
+    atomic<size_t> nextIndex(0);
+    auto worker = [jobCount, &job, &nextIndex]() {
+        size_t index;
+        while ((index = nextIndex.fetch_add(1, memory_order_relaxed)) < jobCount) {
+            job(index);
+        }
+    };
+
+    vector<thread> pool;
+    pool.reserve(workers);
+    for (size_t i = 0; i < workers; ++i) {
+        pool.emplace_back(worker);
+    }
+    for (auto& t : pool) {
+        t.join();
+    }
+}
+
+// ========================================================================================
+// CSV OUTPUT IMPLEMENTATION
+// ========================================================================================
+
+/**
+ * Quote CSV Field Implementation
+ */
+string quoteCsvField(const string& text) {
+    if (text.find_first_of(",\"\r\n") == string::npos) {
+        return text;
+    }
+    string quoted = "\"";
+    for (char c : text) {
+        if (c == '"') quoted += '"';
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+// ========================================================================================
+// RESULT COLLECTION
+// ========================================================================================
+
+/**
+ * Collect Result Implementation
+ */
+void collectResult(const Scheduler& scheduler, ComparisonResult& result) {
+    result.averageWaitingTime = scheduler.getAverageWaitingTime();
+    result.averageTurnaroundTime = scheduler.getAverageTurnaroundTime();
+    result.averageResponseTime = scheduler.getAverageResponseTime();
+    result.totalExecutionTime = scheduler.getTotalExecutionTime();
+    result.contextSwitches = scheduler.getContextSwitchCount();
+    result.cpuCount = scheduler.getCpuCount();
+    result.migrations = scheduler.getMigrationCount();
+    result.overheadTime = scheduler.getOverheadTime();
+    result.utilisation = 0.0;
+    for (const CpuStatistics& cpu : scheduler.getCpuStatistics()) {
+        result.utilisation += cpu.utilisation / result.cpuCount;
+    }
+    result.statistics = scheduler.getRunStatistics();
+    result.processCount = static_cast<long long>(result.statistics.getCount());
+    result.throughput = result.totalExecutionTime > 0 ?
+        static_cast<double>(result.processCount) / result.totalExecutionTime : 0.0;
+}
+
+// ========================================================================================
+// CONSTRUCTOR
+// ========================================================================================
+
+/**
+ * Comparison Runner Constructor Implementation
+ */
+ComparisonRunner::ComparisonRunner(shared_ptr<const Workload> sharedWorkload, size_t threads)
+    : workload(std::move(sharedWorkload)), threadCount(0), verbosity(Verbosity::QUIET)
+{
+    setThreadCount(threads);
+}
+
+// ========================================================================================
+// CONFIGURATION
+// ========================================================================================
+
+/**
+ * Add Scheduler Implementation
+ */
+size_t ComparisonRunner::addScheduler(unique_ptr<Scheduler> scheduler, const string& label) {
+    if (!scheduler) {
+        cerr << "Error: Cannot add null scheduler to comparison" << endl;
+        return schedulers.size();
+    }
+
+    labels.push_back(label.empty() ? scheduler->getAlgorithmName() : label);
+    schedulers.push_back(std::move(scheduler));
+    return schedulers.size() - 1;
+}
+
+/**
+ * Set Snapshot Implementation
+ */
+void ComparisonRunner::setSnapshot(shared_ptr<const SchedulerSnapshot> start) {
+    snapshot = move(start);
+}
+
+/**
+ * Set Thread Count Implementation
+ */
+void ComparisonRunner::setThreadCount(size_t threads) {
+    if (threads == 0) {
+        threads = thread::hardware_concurrency();
+    }
+    threadCount = max<size_t>(threads, 1);
+}
+
+/**
+ * Get Thread Count Implementation
+ */
+size_t ComparisonRunner::getThreadCount() const {
+    return threadCount;
+}
+
+/**
+ * Set Verbosity Implementation
+ */
+void ComparisonRunner::setVerbosity(Verbosity level) {
+    verbosity = level;
+}
+
+/**
+ * Get Scheduler Count Implementation
+ */
+size_t ComparisonRunner::getSchedulerCount() const {
+    return schedulers.size();
+}
+
+/**
+ * Get Scheduler Implementation
+ */
+const Scheduler& ComparisonRunner::getScheduler(size_t index) const {
+    return *schedulers[index];
+}
+
+// ========================================================================================
+// EXECUTION
+// ========================================================================================
+
+/**
+ * Run One Scheduler Implementation
+ * Only touches schedulers[index] and results[index], so no synchronisation is needed
+ */
+void ComparisonRunner::runOne(size_t index) {
+    Scheduler& scheduler = *schedulers[index];
+    ComparisonResult& result = results[index];
+    result.label = labels[index];
+
+    auto start = chrono::steady_clock::now();
+    try {
+        scheduler.setVerbosity(verbosity);
+        if (snapshot) {
+            result.success = scheduler.restore(*snapshot) && scheduler.resume();
+        } else {
+            scheduler.setWorkload(workload);
+            result.success = scheduler.schedule();
+        }
+    } catch (const exception& e) {
+        cerr << "Error: " << labels[index] << " failed: " << e.what() << endl;
+        result.success = false;
+    }
+    auto end = chrono::steady_clock::now();
+    result.wallMilliseconds = chrono::duration<double, milli>(end - start).count();
+
+    if (result.success) {
+        collectResult(scheduler, result);
+    }
+}
+
+/**
+ * Run All Schedulers Implementation
+ */
+const vector<ComparisonResult>& ComparisonRunner::run() {
+    results.assign(schedulers.size(), ComparisonResult());
+    size_t threads = verbosity >= Verbosity::TRACE ? 1 : threadCount;
+    runParallel(schedulers.size(), threads, [this](size_t index) { runOne(index); });
+    return results;
+}
+
+/**
+ * Get Results Implementation
+ */
+const vector<ComparisonResult>& ComparisonRunner::getResults() const {
+    return results;
+}
+
+// ========================================================================================
+// REPORTING
+// ========================================================================================
+
+/**
+ * Print Comparison Table Implementation
+ */
+void ComparisonRunner::printComparison() const {
+    // Streamed processes are only known once a run has admitted them
+    long long processCount = workload ? static_cast<long long>(workload->size()) : 0;
+    bool overhead = false;
+    bool deadlines = false;
+    for (const auto& result : results) {
+        if (result.success) processCount = max(processCount, result.processCount);
+        overhead = overhead || result.overheadTime > 0;
+        deadlines = deadlines || result.statistics.getDeadlineCount() > 0;
+    }
+
+    // Free dispatches skip the overhead column, workloads without deadlines the misses
+    const int width = 88 + (overhead ? 10 : 0) + (deadlines ? 10 : 0);
+
+    cout << "\n=== Algorithm Comparison (" << processCount
+         << " processes, " << min(threadCount, schedulers.size()) << " threads) ===" << endl;
+    cout << left << setw(24) << "Algorithm" << right
+         << setw(10) << "Waiting"
+         << setw(12) << "Turnaround"
+         << setw(10) << "Response"
+         << setw(10) << "Makespan"
+         << setw(10) << "Switches"
+         << setw(12) << "Throughput";
+    if (overhead) cout << setw(10) << "Overhead";
+    if (deadlines) cout << setw(10) << "Misses";
+    cout << endl;
+    cout << string(width, '-') << endl;
+
+    for (const auto& result : results) {
+        cout << left << setw(24) << result.label << right;
+        if (!result.success) {
+            cout << setw(width - 24) << "FAILED" << endl;
+            continue;
+        }
+        cout << fixed << setprecision(2)
+             << setw(10) << result.averageWaitingTime
+             << setw(12) << result.averageTurnaroundTime
+             << setw(10) << result.averageResponseTime
+             << setw(10) << result.totalExecutionTime
+             << setw(10) << result.contextSwitches
+             << setw(12) << setprecision(4) << result.throughput;
+        if (overhead) cout << setw(10) << result.overheadTime;
+        if (deadlines) cout << setw(10) << result.statistics.getDeadlineMisses();
+        cout << endl;
+    }
+
+    cout << string(width, '-') << endl;
+}
+
+/**
+ * Print Comparison CSV Implementation
+ */
+void ComparisonRunner::printCsv() const {
+    cout << "algorithm,success,processes,avg_waiting,avg_turnaround,avg_response,"
+         << "makespan,context_switches,throughput,cpus,migrations,utilisation,overhead,"
+         << "p50_response,p99_response,p999_response,p50_turnaround,p99_turnaround,p999_turnaround,"
+         << "deadline_jobs,deadline_misses,mean_lateness,max_lateness,wall_ms\n";
+
+    long long workloadSize = workload ? static_cast<long long>(workload->size()) : 0;
+    for (const auto& result : results) {
+        cout << quoteCsvField(result.label) << ',' << (result.success ? 1 : 0) << ','
+             << (result.success ? result.processCount : workloadSize) << ','
+             << fixed << setprecision(4)
+             << result.averageWaitingTime << ','
+             << result.averageTurnaroundTime << ','
+             << result.averageResponseTime << ','
+             << result.totalExecutionTime << ','
+             << result.contextSwitches << ','
+             << setprecision(6) << result.throughput << ','
+             << result.cpuCount << ',' << result.migrations << ','
+             << setprecision(4) << result.utilisation << ','
+             << result.overheadTime << ',';
+        for (SchedulingMetric metric : {SchedulingMetric::RESPONSE_TIME, SchedulingMetric::TURNAROUND_TIME}) {
+            const LogHistogram& histogram = result.statistics.get(metric);
+            cout << histogram.getPercentile(50) << ',' << histogram.getPercentile(99) << ','
+                 << histogram.getPercentile(99.9) << ',';
+        }
+        cout << result.statistics.getDeadlineCount() << ',' << result.statistics.getDeadlineMisses() << ','
+             << result.statistics.getMeanLateness() << ',' << result.statistics.getMaxLateness() << ',';
+        cout << setprecision(3) << result.wallMilliseconds << '\n';
+    }
+    cout.flush();
+}
@@ -0,0 +1,1011 @@
+/**
+ * DistributedSweep.cpp - Multi-Node Parameter Sweep Implementation File
+ *
+ * This source file contains the wire protocol, the sweep coordinator and the
+ * sweep worker.
+ *
+ */
+
+#include "DistributedSweep.h"
+
+#include <algorithm>    // For min, max and find_if
+#include <chrono>       // For connect retries
+#include <condition_variable>  // For the task queue
+#include <cstdio>       // For remove and rename
+#include <cstring>      // For memcpy
+#include <deque>        // For the task queue
+#include <filesystem>   // For temporary workload files
+#include <fstream>      // For workload images
+#include <initializer_list>  // For the accepted message types
+#include <iomanip>      // For formatted output
+#include <iostream>     // For output operations
+#include <mutex>        // For the task queue
+#include <new>          // For bad_alloc
+#include <thread>       // For the connection threads
+
+#include <arpa/inet.h>  // For inet_ntop
+#include <netdb.h>      // For getaddrinfo
+#include <netinet/in.h> // For sockaddr_in
+#include <netinet/tcp.h> // For TCP_NODELAY
+#include <poll.h>       // For the accept loop
+#include <sys/socket.h> // For sockets
+#include <sys/time.h>   // For socket timeouts
+#include <unistd.h>     // For close and getpid
+
+#include "WorkloadLoader.h" // Include binary workload format
+
+// ========================================================================================
+// WIRE PROTOCOL
+// ========================================================================================
+
+namespace {
+
+const uint32_t PROTOCOL_MAGIC = 0x4453534f;             // "OSSD"
+const uint32_t PROTOCOL_VERSION = 1;
+const uint64_t MAX_WORKLOAD_BYTES = uint64_t(1) << 36;  // Largest accepted workload image (64 GiB)
+const uint64_t MAX_SHARD_BYTES = uint64_t(1) << 30;     // Largest accepted shard or result list (1 GiB)
+const uint64_t MAX_CONTROL_BYTES = 1024;                // Largest accepted greeting, request or DONE
+const double HELLO_SECONDS = 10.0;                      // How long a new connection may take to greet
+
+/**
+ * Message Type
+ */
+enum class MessageType : uint32_t {
+    HELLO = 1,          // Worker -> coordinator: protocol version, threads
+    ASSIGN = 2,         // Coordinator -> worker: shard, workload digest, settings, tasks
+    NEED_WORKLOAD = 3,  // Worker -> coordinator: digest of a workload it does not have
+    WORKLOAD = 4,       // Coordinator -> worker: digest and binary workload image
+    RESULT = 5,         // Worker -> coordinator: shard and one result per task
+    DONE = 6            // Coordinator -> worker: the sweep is over
+};
+
+/**
+ * Message Header
+ * Precedes every payload on the connection (native byte order)
+ */
+struct MessageHeader {
+    uint32_t magic;     // PROTOCOL_MAGIC
+    uint32_t type;      // MessageType
+    uint64_t length;    // Payload bytes
+};
+
+/**
+ * Payload Writer
+ * Appends fixed-width values and strings to a message payload
+ */
+class PayloadWriter {
+public:
+    string data;
+
+    template <class T>
+    void put(T value) {
+        data.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    void putString(const string& text) {
+        put(static_cast<uint32_t>(text.size()));
+        data.append(text);
+    }
+};
+
+/**
+ * Payload Reader
+ * Reads what PayloadWriter wrote; any read past the end fails the reader
+ */
+class PayloadReader {
+public:
+    const char* cursor;
+    const char* end;
+    bool valid = true;
+
+    explicit PayloadReader(const string& payload) : cursor(payload.data()), end(payload.data() + payload.size()) {}
+
+    template <class T>
+    T get() {
+        T value{};
+        if (static_cast<size_t>(end - cursor) < sizeof(value)) {
+            valid = false;
+            cursor = end;
+            return value;
+        }
+        memcpy(&value, cursor, sizeof(value));
+        cursor += sizeof(value);
+        return value;
+    }
+
+    string getString() {
+        uint32_t size = get<uint32_t>();
+        if (static_cast<size_t>(end - cursor) < size) {
+            valid = false;
+            cursor = end;
+            return string();
+        }
+        string text(cursor, size);
+        cursor += size;
+        return text;
+    }
+};
+
+/**
+ * Send All
+ *
+ * @return False if the connection failed
+ */
+bool sendAll(int socket, const char* data, size_t size) {
+    while (size > 0) {
+        ssize_t sent = send(socket, data, size, MSG_NOSIGNAL);
+        if (sent <= 0) return false;
+        data += sent;
+        size -= static_cast<size_t>(sent);
+    }
+    return true;
+}
+
+/**
+ * Receive All
+ *
+ * @return False if the connection failed, closed or timed out
+ */
+bool receiveAll(int socket, char* data, size_t size) {
+    while (size > 0) {
+        ssize_t received = recv(socket, data, size, 0);
+        if (received <= 0) return false;
+        data += received;
+        size -= static_cast<size_t>(received);
+    }
+    return true;
+}
+
+/**
+ * Send Message
+ */
+bool sendMessage(int socket, MessageType type, const string& payload) {
+    MessageHeader header{PROTOCOL_MAGIC, static_cast<uint32_t>(type), payload.size()};
+    return sendAll(socket, reinterpret_cast<const char*>(&header), sizeof(header)) &&
+           sendAll(socket, payload.data(), payload.size());
+}
+
+/**
+ * Get Message Limit
+ * Only workload images are large, and only workers receive them
+ *
+ * @param type - Message type
+ * @return Largest accepted payload in bytes
+ */
+uint64_t getMessageLimit(MessageType type) {
+    switch (type) {
+        case MessageType::ASSIGN:
+        case MessageType::RESULT:
+            return MAX_SHARD_BYTES;
+        case MessageType::WORKLOAD:
+            return MAX_WORKLOAD_BYTES;
+        default:
+            return MAX_CONTROL_BYTES;
+    }
+}
+
+/**
+ * Receive Message
+ * The type and length are checked before the payload is allocated, so a
+ * peer can only make the receiver allocate what the expected types allow
+ *
+ * @param accepted - Message types expected at this point of the protocol
+ * @return False if the connection failed, the header is malformed, of an
+ *         unexpected type or too long for its type, or the payload does not
+ *         fit in memory
+ */
+bool receiveMessage(int socket, initializer_list<MessageType> accepted, MessageType& type, string& payload) {
+    MessageHeader header;
+    if (!receiveAll(socket, reinterpret_cast<char*>(&header), sizeof(header)) ||
+        header.magic != PROTOCOL_MAGIC) {
+        return false;
+    }
+    type = static_cast<MessageType>(header.type);
+    if (find(accepted.begin(), accepted.end(), type) == accepted.end() || header.length > getMessageLimit(type)) {
+        return false;
+    }
+    try {
+        payload.resize(static_cast<size_t>(header.length));
+    } catch (const bad_alloc&) {
+        cerr << "Error: No memory for a message of " << header.length << " bytes" << endl;
+        return false;
+    }
+    return receiveAll(socket, &payload[0], payload.size());
+}
+
+/**
+ * Set Socket Timeout
+ *
+ * @param seconds - Longest wait of a send or receive (0 = no limit)
+ */
+void setSocketTimeout(int socket, double seconds) {
+    timeval timeout{};
+    timeout.tv_sec = static_cast<time_t>(seconds);
+    timeout.tv_usec = static_cast<suseconds_t>((seconds - static_cast<double>(timeout.tv_sec)) * 1e6);
+    setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    setsockopt(socket, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+}
+
+/**
+ * Connect To
+ *
+ * @return Connected socket (-1 on failure)
+ */
+int connectTo(const string& host, int port) {
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* addresses = nullptr;
+    if (getaddrinfo(host.c_str(), to_string(port).c_str(), &hints, &addresses) != 0) {
+        return -1;
+    }
+    int connected = -1;
+    for (addrinfo* address = addresses; address && connected < 0; address = address->ai_next) {
+        int candidate = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+        if (candidate < 0) continue;
+        if (connect(candidate, address->ai_addr, address->ai_addrlen) == 0) {
+            connected = candidate;
+        } else {
+            close(candidate);
+        }
+    }
+    freeaddrinfo(addresses);
+    if (connected >= 0) {
+        int enable = 1;
+        setsockopt(connected, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+    }
+    return connected;
+}
+
+/**
+ * Get Digest
+ * 64-bit FNV-1a of a workload image; names the image in caches
+ */
+uint64_t getDigest(const string& bytes) {
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : bytes) {
+        hash = (hash ^ c) * 1099511628211ull;
+    }
+    return hash;
+}
+
+/**
+ * Get Digest Name
+ *
+ * @return Digest as 16 hexadecimal digits
+ */
+string getDigestName(uint64_t digest) {
+    static const char DIGITS[] = "0123456789abcdef";
+    string name(16, '0');
+    for (int i = 15; i >= 0; --i, digest >>= 4) {
+        name[static_cast<size_t>(i)] = DIGITS[digest & 0xf];
+    }
+    return name;
+}
+
+/**
+ * Read File
+ *
+ * @return False if the file could not be read
+ */
+bool readFile(const string& path, string& bytes) {
+    ifstream input(path, ios::binary | ios::ate);
+    if (!input) return false;
+    streamoff size = input.tellg();
+    bytes.resize(static_cast<size_t>(size > 0 ? size : 0));
+    input.seekg(0);
+    return static_cast<bool>(input.read(&bytes[0], static_cast<streamsize>(bytes.size())));
+}
+
+/**
+ * Get Temporary Path
+ *
+ * @return Path of a scratch file of this process
+ */
+string getTemporaryPath(const string& name) {
+    error_code error;
+    filesystem::path directory = filesystem::temp_directory_path(error);
+    if (error) directory = ".";
+    return (directory / ("ossweep-" + to_string(getpid()) + "-" + name)).string();
+}
+
+void writeSettings(PayloadWriter& writer, const SweepSettings& settings) {
+    writer.put<int32_t>(settings.cpus);
+    writer.put<int32_t>(static_cast<int32_t>(settings.balancing));
+    writer.put<int32_t>(settings.balanceInterval);
+    writer.put<int64_t>(settings.dispatchCosts.contextSwitch);
+    writer.put<int64_t>(settings.dispatchCosts.cacheWarmup);
+    writer.put<int64_t>(settings.dispatchCosts.migration);
+    writer.put<int32_t>(settings.throughputWindow);
+    writer.put<int32_t>(settings.releaseHorizon);
+    writer.put<int32_t>(settings.mlfqLevels);
+    writer.put<int32_t>(settings.boostInterval);
+    writer.put<int32_t>(settings.agingThreshold);
+    writer.put<int32_t>(settings.targetLatency);
+    writer.put<int32_t>(settings.minGranularity);
+}
+
+SweepSettings readSettings(PayloadReader& reader) {
+    SweepSettings settings;
+    settings.cpus = reader.get<int32_t>();
+    settings.balancing = static_cast<LoadBalancing>(reader.get<int32_t>());
+    settings.balanceInterval = reader.get<int32_t>();
+    settings.dispatchCosts.contextSwitch = reader.get<int64_t>();
+    settings.dispatchCosts.cacheWarmup = reader.get<int64_t>();
+    settings.dispatchCosts.migration = reader.get<int64_t>();
+    settings.throughputWindow = reader.get<int32_t>();
+    settings.releaseHorizon = reader.get<int32_t>();
+    settings.mlfqLevels = reader.get<int32_t>();
+    settings.boostInterval = reader.get<int32_t>();
+    settings.agingThreshold = reader.get<int32_t>();
+    settings.targetLatency = reader.get<int32_t>();
+    settings.minGranularity = reader.get<int32_t>();
+    return settings;
+}
+
+void writeResult(PayloadWriter& writer, const ComparisonResult& result) {
+    writer.putString(result.label);
+    writer.put<uint8_t>(result.success ? 1 : 0);
+    writer.put<int64_t>(result.processCount);
+    writer.put(result.averageWaitingTime);
+    writer.put(result.averageTurnaroundTime);
+    writer.put(result.averageResponseTime);
+    writer.put<int64_t>(result.totalExecutionTime);
+    writer.put<int64_t>(result.contextSwitches);
+    writer.put<int32_t>(result.cpuCount);
+    writer.put<int64_t>(result.migrations);
+    writer.put<int64_t>(result.overheadTime);
+    writer.put(result.utilisation);
+    writer.put(result.throughput);
+    writer.put(result.wallMilliseconds);
+    result.statistics.serialize(writer.data);
+}
+
+bool readResult(PayloadReader& reader, ComparisonResult& result) {
+    result.label = reader.getString();
+    result.success = reader.get<uint8_t>() != 0;
+    result.processCount = reader.get<int64_t>();
+    result.averageWaitingTime = reader.get<double>();
+    result.averageTurnaroundTime = reader.get<double>();
+    result.averageResponseTime = reader.get<double>();
+    result.totalExecutionTime = reader.get<int64_t>();
+    result.contextSwitches = reader.get<int64_t>();
+    result.cpuCount = reader.get<int32_t>();
+    result.migrations = reader.get<int64_t>();
+    result.overheadTime = reader.get<int64_t>();
+    result.utilisation = reader.get<double>();
+    result.throughput = reader.get<double>();
+    result.wallMilliseconds = reader.get<double>();
+    return reader.valid && result.statistics.deserialize(reader.cursor, reader.end);
+}
+
+/**
+ * Configuration Summary
+ * One configuration pooled over every workload
+ */
+struct ConfigurationSummary {
+    const SweepTask* task = nullptr;        // First task of the configuration
+    size_t runs = 0;                        // Tasks of the configuration
+    size_t completed = 0;                   // Tasks that completed
+    long long contextSwitches = 0;          // Summed over the completed tasks
+    RunStatistics statistics;               // Merged sketches of the completed tasks
+
+    double getSwitches() const {
+        return completed > 0 ? static_cast<double>(contextSwitches) / completed : 0.0;
+    }
+};
+
+/**
+ * Summarise Configurations
+ *
+ * @param results - Task results in task order
+ * @return One summary per label, in order of first appearance
+ */
+vector<ConfigurationSummary> summariseConfigurations(const vector<SweepTaskResult>& results) {
+    vector<ConfigurationSummary> summaries;
+    for (const SweepTaskResult& entry : results) {
+        auto summary = find_if(summaries.begin(), summaries.end(), [&entry](const ConfigurationSummary& s) {
+            return s.task->label == entry.task.label;
+        });
+        if (summary == summaries.end()) {
+            summaries.emplace_back();
+            summary = summaries.end() - 1;
+            summary->task = &entry.task;
+        }
+        summary->runs++;
+        if (!entry.result.success) continue;
+        summary->completed++;
+        summary->contextSwitches += entry.result.contextSwitches;
+        summary->statistics.merge(entry.result.statistics);
+    }
+    return summaries;
+}
+
+/**
+ * Get Objective Value
+ */
+double getObjectiveValue(const ConfigurationSummary& summary, SchedulingMetric objective) {
+    if (objective == SchedulingMetric::CONTEXT_SWITCHES) {
+        return summary.getSwitches();
+    }
+    return summary.statistics.get(objective).getMean();
+}
+
+/**
+ * Find Best Configuration
+ *
+ * @return Index of the complete configuration with the smallest objective (-1 if none)
+ */
+int findBest(const vector<ConfigurationSummary>& summaries, SchedulingMetric objective) {
+    int best = -1;
+    for (size_t i = 0; i < summaries.size(); ++i) {
+        if (summaries[i].completed == 0 || summaries[i].completed != summaries[i].runs) continue;
+        if (best < 0 || getObjectiveValue(summaries[i], objective) < getObjectiveValue(summaries[best], objective)) {
+            best = static_cast<int>(i);
+        }
+    }
+    return best;
+}
+
+} // namespace
+
+// ========================================================================================
+// SWEEP COORDINATOR
+// ========================================================================================
+
+/**
+ * Coordinator State
+ */
+struct SweepCoordinator::State {
+    mutex lock;                             // Guards everything below and the results
+    condition_variable changed;             // Signals requeued tasks and the end of the sweep
+    deque<size_t> pending;                  // Tasks waiting for a worker, oldest first
+    size_t unfinished = 0;                  // Tasks without a final result
+    uint64_t nextShard = 0;                 // Identifier of the next shard
+    size_t workers = 0;                     // Workers that joined
+    vector<string> images;                  // Binary image of each workload
+    vector<uint64_t> digests;               // Digest of each image
+};
+
+/**
+ * Sweep Coordinator Constructor Implementation
+ */
+SweepCoordinator::SweepCoordinator(const SweepSettings& machine, SchedulingMetric target)
+    : settings(machine), objective(target), listenSocket(-1), port(0), shardSize(0),
+      maxAttempts(DEFAULT_RETRIES + 1), shardTimeout(0.0), progress(false) {}
+
+/**
+ * Destructor Implementation
+ */
+SweepCoordinator::~SweepCoordinator() {
+    if (listenSocket >= 0) {
+        close(listenSocket);
+    }
+}
+
+/**
+ * Add Workload Implementation
+ */
+uint32_t SweepCoordinator::addWorkload(shared_ptr<const Workload> workload, const string& name) {
+    workloads.push_back(std::move(workload));
+    workloadNames.push_back(name);
+    return static_cast<uint32_t>(workloads.size() - 1);
+}
+
+/**
+ * Add Task Implementation
+ */
+void SweepCoordinator::addTask(const string& algorithm, int quantum, uint32_t workload, const string& label) {
+    SweepTask task;
+    task.algorithm = algorithm;
+    task.quantum = quantum;
+    task.workload = workload;
+    task.label = label;
+    tasks.push_back(std::move(task));
+}
+
+/**
+ * Listen Implementation
+ */
+bool SweepCoordinator::listen(int listenPort) {
+    if (listenSocket >= 0) {
+        close(listenSocket);
+    }
+    listenSocket = socket(AF_INET6, SOCK_STREAM, 0);
+    bool ipv6 = listenSocket >= 0;
+    if (!ipv6) {
+        listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+    }
+    if (listenSocket < 0) {
+        cerr << "Error: Cannot create a socket" << endl;
+        return false;
+    }
+    int enable = 1;
+    setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+    bool bound;
+    if (ipv6) {
+        int dualStack = 0;
+        setsockopt(listenSocket, IPPROTO_IPV6, IPV6_V6ONLY, &dualStack, sizeof(dualStack));
+        sockaddr_in6 address{};
+        address.sin6_family = AF_INET6;
+        address.sin6_addr = in6addr_any;
+        address.sin6_port = htons(static_cast<uint16_t>(listenPort));
+        bound = bind(listenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+    } else {
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_ANY);
+        address.sin_port = htons(static_cast<uint16_t>(listenPort));
+        bound = bind(listenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+    }
+    if (!bound || ::listen(listenSocket, 64) != 0) {
+        cerr << "Error: Cannot listen on port " << listenPort << endl;
+        close(listenSocket);
+        listenSocket = -1;
+        return false;
+    }
+
+    sockaddr_storage local{};
+    socklen_t length = sizeof(local);
+    getsockname(listenSocket, reinterpret_cast<sockaddr*>(&local), &length);
+    port = ntohs(local.ss_family == AF_INET6 ? reinterpret_cast<sockaddr_in6*>(&local)->sin6_port
+                                             : reinterpret_cast<sockaddr_in*>(&local)->sin_port);
+    return true;
+}
+
+/**
+ * Run Sweep Implementation
+ *
+ * Algorithm flow:
+ * 1. Encode every workload in the binary format once and name it by digest.
+ * 2. Queue every task, then accept workers until no task is unfinished; each
+ *    connection is served on its own thread.
+ * 3. Turn away late workers, close the port, and wake the idle connections
+ *    so they end their workers.
+ */
+bool SweepCoordinator::run() {
+    if (listenSocket < 0) {
+        cerr << "Error: The coordinator must listen() before run()" << endl;
+        return false;
+    }
+
+    State state;
+    for (size_t i = 0; i < workloads.size(); ++i) {
+        string path = getTemporaryPath("workload-" + to_string(i) + ".bin");
+        string image;
+        bool saved = WorkloadLoader::saveBinary(*workloads[i], path) && readFile(path, image);
+        remove(path.c_str());
+        if (!saved) {
+            cerr << "Error: Cannot encode workload " << workloadNames[i] << endl;
+            close(listenSocket);
+            listenSocket = -1;
+            return false;
+        }
+        state.digests.push_back(getDigest(image));
+        state.images.push_back(std::move(image));
+    }
+
+    results.assign(tasks.size(), SweepTaskResult());
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        results[i].task = tasks[i];
+        results[i].result.label = tasks[i].label;
+        state.pending.push_back(i);
+    }
+    state.unfinished = tasks.size();
+    if (progress) {
+        cerr << "Coordinating " << tasks.size() << " runs over " << workloads.size()
+             << (workloads.size() == 1 ? " workload" : " workloads") << " on port " << port << endl;
+    }
+
+    vector<thread> connections;
+    while (true) {
+        {
+            lock_guard<mutex> guard(state.lock);
+            if (state.unfinished == 0) break;
+        }
+        pollfd listening{listenSocket, POLLIN, 0};
+        if (poll(&listening, 1, 200) <= 0 || !(listening.revents & POLLIN)) continue;
+
+        sockaddr_storage address{};
+        socklen_t length = sizeof(address);
+        int connection = accept(listenSocket, reinterpret_cast<sockaddr*>(&address), &length);
+        if (connection < 0) continue;
+        int enable = 1;
+        setsockopt(connection, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+
+        char host[INET6_ADDRSTRLEN] = "?";
+        int peerPort = 0;
+        if (address.ss_family == AF_INET6) {
+            auto* peer = reinterpret_cast<sockaddr_in6*>(&address);
+            if (IN6_IS_ADDR_V4MAPPED(&peer->sin6_addr)) {
+                inet_ntop(AF_INET, &peer->sin6_addr.s6_addr[12], host, sizeof(host));
+            } else {
+                inet_ntop(AF_INET6, &peer->sin6_addr, host, sizeof(host));
+            }
+            peerPort = ntohs(peer->sin6_port);
+        } else if (address.ss_family == AF_INET) {
+            auto* peer = reinterpret_cast<sockaddr_in*>(&address);
+            inet_ntop(AF_INET, &peer->sin_addr, host, sizeof(host));
+            peerPort = ntohs(peer->sin_port);
+        }
+        string peer = string(host) + ":" + to_string(peerPort);
+        connections.emplace_back([this, &state, connection, peer]() { serveWorker(state, connection, peer); });
+    }
+
+    // Workers that connected too late are told right away that the sweep is over
+    pollfd listening{listenSocket, POLLIN, 0};
+    while (poll(&listening, 1, 0) > 0 && (listening.revents & POLLIN)) {
+        int late = accept(listenSocket, nullptr, nullptr);
+        if (late < 0) break;
+        sendMessage(late, MessageType::DONE, string());
+        close(late);
+    }
+    close(listenSocket);
+    listenSocket = -1;
+
+    state.changed.notify_all();
+    for (thread& connection : connections) {
+        connection.join();
+    }
+
+    bool success = true;
+    for (const SweepTaskResult& entry : results) {
+        success = success && entry.result.success;
+    }
+    return success;
+}
+
+/**
+ * Serve Worker Implementation
+ *
+ * Algorithm flow:
+ * 1. Read the worker's greeting and its thread count.
+ * 2. Take the next shard: the oldest pending task and the pending tasks of
+ *    the same workload right behind it, up to the shard size.
+ * 3. Send it, answer a request for its workload, and read the results.
+ * 4. If the connection fails on the way, requeue the shard's tasks (or fail
+ *    those that ran out of attempts) and drop the worker.
+ */
+void SweepCoordinator::serveWorker(State& state, int socket, const string& peer) {
+    MessageType type;
+    string payload;
+    setSocketTimeout(socket, HELLO_SECONDS);
+    if (!receiveMessage(socket, {MessageType::HELLO}, type, payload)) {
+        close(socket);
+        return;
+    }
+    PayloadReader hello(payload);
+    uint32_t version = hello.get<uint32_t>();
+    uint32_t threads = hello.get<uint32_t>();
+    if (!hello.valid || version != PROTOCOL_VERSION) {
+        cerr << "Warning: Worker " << peer << " speaks protocol version " << version << ", not "
+             << PROTOCOL_VERSION << endl;
+        close(socket);
+        return;
+    }
+    setSocketTimeout(socket, shardTimeout);
+    const size_t limit = shardSize > 0 ? shardSize : max<size_t>(threads, 1);
+    {
+        lock_guard<mutex> guard(state.lock);
+        state.workers++;
+    }
+    if (progress) {
+        cerr << "Worker " << peer << " joined (" << threads << " threads)" << endl;
+    }
+
+    while (true) {
+        // Next shard
+        vector<size_t> shard;
+        uint64_t shardId;
+        {
+            unique_lock<mutex> guard(state.lock);
+            state.changed.wait(guard, [&state]() { return !state.pending.empty() || state.unfinished == 0; });
+            if (state.pending.empty()) {
+                break;
+            }
+            const uint32_t workload = tasks[state.pending.front()].workload;
+            while (!state.pending.empty() && shard.size() < limit && tasks[state.pending.front()].workload == workload) {
+                shard.push_back(state.pending.front());
+                state.pending.pop_front();
+                results[shard.back()].attempts++;
+            }
+            shardId = state.nextShard++;
+        }
+        const uint32_t workload = tasks[shard.front()].workload;
+
+        PayloadWriter assign;
+        assign.put(shardId);
+        assign.put(state.digests[workload]);
+        writeSettings(assign, settings);
+        assign.put(static_cast<uint32_t>(shard.size()));
+        for (size_t index : shard) {
+            assign.putString(tasks[index].algorithm);
+            assign.put<int32_t>(tasks[index].quantum);
+            assign.putString(tasks[index].label);
+        }
+
+        // Run it, shipping the workload if the worker asks for it. Running out
+        // of memory on the way only drops this worker
+        vector<ComparisonResult> shardResults(shard.size());
+        bool delivered = sendMessage(socket, MessageType::ASSIGN, assign.data);
+        try {
+            while (delivered) {
+                delivered = receiveMessage(socket, {MessageType::NEED_WORKLOAD, MessageType::RESULT}, type, payload);
+                if (!delivered) break;
+                PayloadReader reader(payload);
+                if (type == MessageType::NEED_WORKLOAD) {
+                    uint64_t digest = reader.get<uint64_t>();
+                    PayloadWriter image;
+                    image.put(state.digests[workload]);
+                    image.data.append(state.images[workload]);
+                    delivered = reader.valid && digest == state.digests[workload] &&
+                                sendMessage(socket, MessageType::WORKLOAD, image.data);
+                    continue;
+                }
+                delivered = reader.get<uint64_t>() == shardId && reader.get<uint32_t>() == shard.size();
+                for (size_t i = 0; i < shard.size() && delivered; ++i) {
+                    delivered = readResult(reader, shardResults[i]);
+                }
+                break;
+            }
+        } catch (const bad_alloc&) {
+            cerr << "Warning: Out of memory serving worker " << peer << endl;
+            delivered = false;
+        }
+
+        lock_guard<mutex> guard(state.lock);
+        if (!delivered) {
+            for (size_t index : shard) {
+                if (results[index].attempts >= maxAttempts) {
+                    results[index].result.success = false;
+                    state.unfinished--;
+                    cerr << "Error: " << tasks[index].label << " on " << workloadNames[workload] << " failed on "
+                         << results[index].attempts << " workers" << endl;
+                } else {
+                    state.pending.push_back(index);
+                }
+            }
+            if (progress) {
+                cerr << "Worker " << peer << " lost; requeued its shard of " << shard.size() << " runs" << endl;
+            }
+            state.changed.notify_all();
+            close(socket);
+            return;
+        }
+        for (size_t i = 0; i < shard.size(); ++i) {
+            results[shard[i]].result = std::move(shardResults[i]);
+        }
+        state.unfinished -= shard.size();
+        if (progress) {
+            cerr << "Worker " << peer << " finished " << shard.size() << " runs on " << workloadNames[workload]
+                 << " (" << state.unfinished << " left)" << endl;
+        }
+        if (state.unfinished == 0) {
+            state.changed.notify_all();
+        }
+    }
+
+    sendMessage(socket, MessageType::DONE, string());
+    close(socket);
+}
+
+/**
+ * Print Sweep Table Implementation
+ */
+void SweepCoordinator::printResults() const {
+    vector<ConfigurationSummary> summaries = summariseConfigurations(results);
+    int best = findBest(summaries, objective);
+
+    cout << "\n=== Distributed Sweep (" << summaries.size() << " configurations, " << workloads.size()
+         << (workloads.size() == 1 ? " workload" : " workloads") << ", objective: "
+         << schedulingMetricToString(objective) << ") ===" << endl;
+    cout << left << setw(28) << "Configuration" << right
+         << setw(6) << "Runs"
+         << setw(10) << "Waiting"
+         << setw(12) << "Turnaround"
+         << setw(10) << "Response"
+         << setw(10) << "P99 Wait"
+         << setw(10) << "P99 Turn"
+         << setw(10) << "Switches" << endl;
+    cout << string(96, '-') << endl;
+
+    for (const ConfigurationSummary& summary : summaries) {
+        cout << left << setw(28) << summary.task->label << right << setw(6) << summary.runs;
+        if (summary.completed != summary.runs) {
+            cout << setw(62) << (to_string(summary.runs - summary.completed) + " FAILED") << endl;
+            continue;
+        }
+        LogHistogram waiting = summary.statistics.get(SchedulingMetric::WAITING_TIME);
+        LogHistogram turnaround = summary.statistics.get(SchedulingMetric::TURNAROUND_TIME);
+        cout << fixed << setprecision(2)
+             << setw(10) << waiting.getMean()
+             << setw(12) << turnaround.getMean()
+             << setw(10) << summary.statistics.get(SchedulingMetric::RESPONSE_TIME).getMean()
+             << setw(10) << waiting.getPercentile(99)
+             << setw(10) << turnaround.getPercentile(99)
+             << setw(10) << summary.getSwitches() << endl;
+    }
+
+    cout << string(96, '-') << endl;
+    if (best >= 0) {
+        cout << "Best configuration: " << summaries[best].task->label << endl;
+    } else {
+        cout << "No configuration completed on every workload" << endl;
+    }
+    cout << "Averages and percentiles pool every process of every workload; switches are per run" << endl;
+}
+
+/**
+ * Print Sweep CSV Implementation
+ */
+void SweepCoordinator::printCsv() const {
+    vector<ConfigurationSummary> summaries = summariseConfigurations(results);
+    int best = findBest(summaries, objective);
+
+    cout << "algorithm,quantum,runs,completed,processes,avg_waiting,avg_turnaround,avg_response,"
+         << "p50_waiting,p99_waiting,p99_turnaround,p99_response,context_switches,best\n";
+    for (size_t i = 0; i < summaries.size(); ++i) {
+        const ConfigurationSummary& summary = summaries[i];
+        LogHistogram waiting = summary.statistics.get(SchedulingMetric::WAITING_TIME);
+        LogHistogram turnaround = summary.statistics.get(SchedulingMetric::TURNAROUND_TIME);
+        LogHistogram response = summary.statistics.get(SchedulingMetric::RESPONSE_TIME);
+        cout << summary.task->algorithm << ',' << summary.task->quantum << ',' << summary.runs << ','
+             << summary.completed << ',' << summary.statistics.getCount() << ','
+             << fixed << setprecision(4)
+             << waiting.getMean() << ',' << turnaround.getMean() << ',' << response.getMean() << ','
+             << waiting.getPercentile(50) << ',' << waiting.getPercentile(99) << ','
+             << turnaround.getPercentile(99) << ',' << response.getPercentile(99) << ','
+             << summary.getSwitches() << ',' << (static_cast<int>(i) == best ? 1 : 0) << '\n';
+    }
+    cout.flush();
+}
+
+// ========================================================================================
+// SWEEP WORKER
+// ========================================================================================
+
+/**
+ * Sweep Worker Constructor Implementation
+ */
+SweepWorker::SweepWorker(SweepSchedulerFactory schedulerFactory, size_t threads)
+    : factory(std::move(schedulerFactory)), threadCount(threads), shardCount(0), workloadsReceived(0) {}
+
+/**
+ * Run Worker Implementation
+ *
+ * Algorithm flow:
+ * 1. Connect, retrying while the coordinator is not up yet, and greet it.
+ * 2. For every shard, find its workload in memory, then in the cache
+ *    directory, and only then ask the coordinator for it.
+ * 3. Run the shard's tasks in parallel and send back one result per task.
+ */
+bool SweepWorker::run(const string& host, int port) {
+    int socket = -1;
+    auto deadline = chrono::steady_clock::now() + chrono::duration<double>(CONNECT_SECONDS);
+    while ((socket = connectTo(host, port)) < 0 && chrono::steady_clock::now() < deadline) {
+        this_thread::sleep_for(chrono::milliseconds(200));
+    }
+    if (socket < 0) {
+        cerr << "Error: Cannot connect to coordinator " << host << ":" << port << endl;
+        return false;
+    }
+
+    size_t threads = threadCount > 0 ? threadCount : max(1u, thread::hardware_concurrency());
+    PayloadWriter hello;
+    hello.put(PROTOCOL_VERSION);
+    hello.put(static_cast<uint32_t>(threads));
+    if (!sendMessage(socket, MessageType::HELLO, hello.data)) {
+        cerr << "Error: Lost connection to coordinator " << host << ":" << port << endl;
+        close(socket);
+        return false;
+    }
+
+    vector<pair<uint64_t, shared_ptr<const Workload>>> loaded;     // Most recently used last
+    MessageType type;
+    string payload;
+    while (receiveMessage(socket, {MessageType::ASSIGN, MessageType::DONE}, type, payload)) {
+        if (type == MessageType::DONE) {
+            close(socket);
+            return true;
+        }
+        PayloadReader reader(payload);
+        uint64_t shardId = reader.get<uint64_t>();
+        uint64_t digest = reader.get<uint64_t>();
+        SweepSettings settings = readSettings(reader);
+        uint32_t count = reader.get<uint32_t>();
+        vector<SweepTask> shard;
+        for (uint32_t i = 0; i < count && reader.valid; ++i) {
+            SweepTask task;
+            task.algorithm = reader.getString();
+            task.quantum = reader.get<int32_t>();
+            task.label = reader.getString();
+            shard.push_back(std::move(task));
+        }
+        if (type != MessageType::ASSIGN || !reader.valid) {
+            cerr << "Error: Malformed message from coordinator" << endl;
+            break;
+        }
+
+        // Workload: memory, then disk cache, then the coordinator
+        shared_ptr<const Workload> workload;
+        auto cached = find_if(loaded.begin(), loaded.end(), [digest](const auto& entry) { return entry.first == digest; });
+        if (cached != loaded.end()) {
+            workload = cached->second;
+            loaded.erase(cached);
+        }
+        const string cachePath = cacheDirectory.empty() ? string()
+                               : (filesystem::path(cacheDirectory) / (getDigestName(digest) + ".bin")).string();
+        if (!workload && !cachePath.empty() && filesystem::exists(cachePath)) {
+            workload = WorkloadLoader::loadBinary(cachePath);
+        }
+        if (!workload) {
+            PayloadWriter request;
+            request.put(digest);
+            if (!sendMessage(socket, MessageType::NEED_WORKLOAD, request.data) ||
+                !receiveMessage(socket, {MessageType::WORKLOAD}, type, payload)) {
+                break;
+            }
+            PayloadReader image(payload);
+            uint64_t imageDigest = image.get<uint64_t>();
+            string bytes = image.valid ? string(image.cursor, image.end) : string();
+            if (!image.valid || imageDigest != digest || getDigest(bytes) != digest) {
+                cerr << "Error: Workload " << getDigestName(digest) << " arrived damaged" << endl;
+                break;
+            }
+            string path = cachePath.empty() ? getTemporaryPath(getDigestName(digest) + ".bin") : cachePath;
+            string partial = path + ".part";
+            {
+                ofstream output(partial, ios::binary | ios::trunc);
+                output.write(bytes.data(), static_cast<streamsize>(bytes.size()));
+            }
+            if (rename(partial.c_str(), path.c_str()) == 0) {
+                workload = WorkloadLoader::loadBinary(path);
+            }
+            if (cachePath.empty()) {
+                remove(path.c_str());
+            }
+            remove(partial.c_str());
+            workloadsReceived++;
+        }
+        if (!workload) {
+            cerr << "Error: Cannot load workload " << getDigestName(digest) << endl;
+            break;
+        }
+        loaded.emplace_back(digest, workload);
+        if (loaded.size() > MEMORY_CACHE_ENTRIES) {
+            loaded.erase(loaded.begin());
+        }
+
+        // Run the shard
+        ComparisonRunner runner(workload, threads);
+        vector<size_t> slots;
+        for (const SweepTask& task : shard) {
+            auto scheduler = factory(task, settings);
+            if (!scheduler) {
+                cerr << "Error: Unknown algorithm '" << task.algorithm << "'" << endl;
+                slots.push_back(SIZE_MAX);
+                continue;
+            }
+            slots.push_back(runner.addScheduler(std::move(scheduler), task.label));
+        }
+        const vector<ComparisonResult>& runs = runner.run();
+
+        PayloadWriter result;
+        result.put(shardId);
+        result.put(count);
+        for (size_t i = 0; i < shard.size(); ++i) {
+            ComparisonResult failed;
+            failed.label = shard[i].label;
+            writeResult(result, slots[i] != SIZE_MAX ? runs[slots[i]] : failed);
+        }
+        if (!sendMessage(socket, MessageType::RESULT, result.data)) {
+            break;
+        }
+        shardCount++;
+    }
+
+    cerr << "Error: Lost connection to coordinator " << host << ":" << port << endl;
+    close(socket);
+    return false;
+}
@@ -0,0 +1,21 @@
+#include "../include/EDFScheduler.h"
+#include "../include/SchedulingKernel.h"
+
+EDFScheduler::EDFScheduler()
+    : Scheduler("EDF", true, ReadyQueueOrder::DEADLINE) {}
+
+bool EDFScheduler::schedule() {
+    if (isTraceEnabled()) {
+        trace() << "\n=== " << algorithmName << " Scheduling Execution ===\n";
+    }
+
+    return runEventLoop<EDFScheduler>();
+}
+
+string EDFScheduler::getDispatchMessage(ProcessHandle process) const {
+    if (table.relativeDeadline(process) == 0) {
+        return "Process " + string(table.name(process)) + " (no deadline) started";
+    }
+    return "Process " + string(table.name(process)) + " (Deadline " +
+           to_string(table.absoluteDeadline(process)) + ") started";
+}
@@ -0,0 +1,720 @@
+/**
+ * GroupScheduling.cpp - Hierarchical Process Groups Implementation File
+ *
+ * This source file contains the group file loader, the per-run group tree
+ * with its quota bookkeeping, and the hierarchical ready queue.
+ *
+ */
+
+#include "GroupScheduling.h"
+
+#include <algorithm>    // For min and max
+#include <charconv>     // For number parsing
+#include <fstream>      // For reading group files
+#include <iostream>     // For error reporting
+
+// ========================================================================================
+// GROUP HIERARCHY IMPLEMENTATION
+// ========================================================================================
+
+/**
+ * Add Group Implementation
+ */
+bool GroupHierarchy::add(const GroupSpec& spec) {
+    if (spec.path.empty() || !Workload::isValidGroupPath(spec.path)) {
+        cerr << "Error: Invalid group path '" << spec.path << "'" << endl;
+        return false;
+    }
+    if (spec.weight <= 0 || spec.quota < 0 || spec.period <= 0) {
+        cerr << "Error: Group " << spec.path << " needs a positive weight and period and a non-negative quota" << endl;
+        return false;
+    }
+    if (find(spec.path)) {
+        cerr << "Error: Group " << spec.path << " is declared twice" << endl;
+        return false;
+    }
+    groups.push_back(spec);
+    return true;
+}
+
+/**
+ * Find Group Implementation
+ */
+const GroupSpec* GroupHierarchy::find(string_view path) const {
+    for (const GroupSpec& spec : groups) {
+        if (spec.path == path) {
+            return &spec;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Load Hierarchy Implementation
+ *
+ * Algorithm flow:
+ * 1. Read the file line by line, skipping empty lines and '#' comments.
+ * 2. Split each line at commas: the path, the weight, then "quota=N" and
+ *    "period=N" attributes in any order.
+ * 3. Add the group; the first invalid line fails the whole file.
+ */
+shared_ptr<GroupHierarchy> GroupHierarchy::load(const string& path) {
+    ifstream input(path);
+    if (!input) {
+        cerr << "Error: Cannot open group file " << path << endl;
+        return nullptr;
+    }
+
+    auto number = [](string_view text, SimTime& value) {
+        auto result = from_chars(text.data(), text.data() + text.size(), value);
+        return !text.empty() && result.ec == errc() && result.ptr == text.data() + text.size();
+    };
+    auto trim = [](string_view text) {
+        while (!text.empty() && (text.front() == ' ' || text.front() == '\t')) text.remove_prefix(1);
+        while (!text.empty() && (text.back() == ' ' || text.back() == '\t' || text.back() == '\r')) text.remove_suffix(1);
+        return text;
+    };
+
+    auto hierarchy = make_shared<GroupHierarchy>();
+    string line;
+    size_t lineNumber = 0;
+    while (getline(input, line)) {
+        lineNumber++;
+        string_view rest = trim(line);
+        if (rest.empty() || rest.front() == '#') {
+            continue;
+        }
+
+        vector<string_view> fields;
+        while (true) {
+            size_t comma = rest.find(',');
+            fields.push_back(trim(rest.substr(0, comma)));
+            if (comma == string_view::npos) break;
+            rest.remove_prefix(comma + 1);
+        }
+
+        GroupSpec spec;
+        SimTime weight = 0;
+        bool valid = fields.size() >= 2 && number(fields[1], weight) && weight <= INT32_MAX;
+        spec.path = string(fields[0]);
+        spec.weight = static_cast<int>(weight);
+        bool hasPeriod = false;
+        for (size_t i = 2; valid && i < fields.size(); ++i) {
+            string_view field = fields[i];
+            if (field.substr(0, 6) == "quota=") {
+                valid = number(field.substr(6), spec.quota);
+            } else if (field.substr(0, 7) == "period=") {
+                valid = number(field.substr(7), spec.period);
+                hasPeriod = true;
+            } else {
+                valid = false;
+            }
+        }
+        if (!valid) {
+            cerr << "Error: Malformed group on line " << lineNumber << " of " << path
+                 << " (expected path,weight[,quota=N][,period=N])" << endl;
+            return nullptr;
+        }
+        if (!hasPeriod) {
+            spec.period = DEFAULT_PERIOD;
+        }
+        if (!hierarchy->add(spec)) {
+            return nullptr;
+        }
+    }
+    return hierarchy;
+}
+
+// ========================================================================================
+// PROCESS GROUPS IMPLEMENTATION
+// ========================================================================================
+
+/**
+ * Process Groups Constructor Implementation
+ */
+ProcessGroups::ProcessGroups(shared_ptr<const GroupHierarchy> groups, const ProcessTable& processTable,
+                             const SimTime& currentTime)
+    : hierarchy(std::move(groups)),
+      table(processTable),
+      clock(currentTime),
+      mappedWorkload(nullptr),
+      limited(false) {
+    reset(1);
+}
+
+/**
+ * Reset Implementation
+ * Declared groups keep their node numbers from run to run
+ */
+void ProcessGroups::reset(int cpuCount) {
+    nodes.assign(1, Node());
+    nodeOfPath.clear();
+    mappedWorkload = nullptr;
+    grants.assign(static_cast<size_t>(max(cpuCount, 1)), Grant());
+    limited = false;
+
+    for (const GroupSpec& spec : hierarchy->getGroups()) {
+        Node& node = nodes[resolve(spec.path)];
+        node.weight = spec.weight;
+        node.quota = spec.quota;
+        node.period = spec.period;
+        node.pool = spec.quota;
+        limited = limited || spec.quota > 0;
+    }
+}
+
+/**
+ * Resolve Path Implementation
+ */
+uint32_t ProcessGroups::resolve(string_view path) {
+    uint32_t parent = ROOT;
+    size_t end = 0;
+    while (end < path.size()) {
+        size_t slash = path.find('/', end);
+        end = slash == string_view::npos ? path.size() : slash;
+        string_view prefix = path.substr(0, end);
+
+        uint32_t found = ROOT;
+        for (uint32_t node = 1; node < nodes.size(); ++node) {
+            if (nodes[node].path == prefix) {
+                found = node;
+                break;
+            }
+        }
+        if (found == ROOT) {
+            found = static_cast<uint32_t>(nodes.size());
+            Node created;
+            created.path = string(prefix);
+            created.parent = parent;
+            created.depth = nodes[parent].depth + 1;
+            nodes.push_back(std::move(created));
+        }
+        parent = found;
+        end++;
+    }
+    return parent;
+}
+
+/**
+ * Resolve Process Implementation
+ */
+uint32_t ProcessGroups::resolveProcess(ProcessHandle process) {
+    const Workload& workload = table.getWorkload();
+    if (mappedWorkload != &workload) {
+        nodeOfPath.clear();
+        mappedWorkload = &workload;
+    }
+    for (size_t id = nodeOfPath.size(); id < workload.groupPathCount(); ++id) {
+        nodeOfPath.push_back(resolve(workload.groupPath(static_cast<uint32_t>(id))));
+    }
+    return nodeOfPath[table.group(process)];
+}
+
+/**
+ * Is Process Throttled Implementation
+ */
+bool ProcessGroups::isProcessThrottled(ProcessHandle process) {
+    if (!limited) {
+        return false;
+    }
+    for (uint32_t node = nodeOf(process); node != ROOT; node = nodes[node].parent) {
+        if (nodes[node].throttled) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Register Queue Implementation
+ */
+void ProcessGroups::registerQueue(GroupReadyQueue* queue) {
+    queues.push_back(queue);
+}
+
+/**
+ * Unregister Queue Implementation
+ */
+void ProcessGroups::unregisterQueue(GroupReadyQueue* queue) {
+    queues.erase(remove(queues.begin(), queues.end(), queue), queues.end());
+}
+
+/**
+ * Change Waiting Implementation
+ */
+void ProcessGroups::changeWaiting(uint32_t node, long long delta) {
+    while (true) {
+        nodes[node].waiting += delta;
+        if (nodes[node].quota > 0) {
+            updateHeld(node);
+        }
+        if (node == ROOT) {
+            return;
+        }
+        node = nodes[node].parent;
+    }
+}
+
+/**
+ * Refresh Pool Implementation
+ */
+void ProcessGroups::refresh(uint32_t node, SimTime time) {
+    Node& group = nodes[node];
+    SimTime index = time / group.period;
+    if (index > group.periodIndex) {
+        group.periodIndex = index;
+        group.pool = group.quota;
+        if (group.throttled) {
+            setThrottled(node, false);
+        }
+    }
+}
+
+/**
+ * Set Throttled Implementation
+ */
+void ProcessGroups::setThrottled(uint32_t node, bool throttled) {
+    if (nodes[node].throttled == throttled) {
+        return;
+    }
+    nodes[node].throttled = throttled;
+    for (GroupReadyQueue* queue : queues) {
+        queue->throttlingChanged(node);
+    }
+    if (throttled && !nodes[node].refillPending && scheduleRefill) {
+        nodes[node].refillPending = true;
+        scheduleRefill((nodes[node].periodIndex + 1) * nodes[node].period, node);
+    }
+    updateHeld(node);
+}
+
+/**
+ * Update Held Time Implementation
+ */
+void ProcessGroups::updateHeld(uint32_t node) {
+    Node& group = nodes[node];
+    bool held = group.throttled && group.grants == 0 && group.waiting > 0;
+    if (held && group.heldSince < 0) {
+        group.heldSince = clock;
+        group.throttles++;
+    } else if (!held && group.heldSince >= 0) {
+        group.throttledTime += clock - group.heldSince;
+        group.heldSince = -1;
+    }
+}
+
+/**
+ * Grant Time Slice Implementation
+ *
+ * Algorithm flow:
+ * 1. Return the CPU's previous grant.
+ * 2. Refill the pools of the limited groups on the path whose period has
+ *    passed, and bound the slice by every pool and period end.
+ * 3. Take the slice from the pools; a pool that runs dry throttles its group.
+ */
+SimTime ProcessGroups::grant(int cpu, ProcessHandle process, SimTime slice, SimTime start) {
+    release(cpu);
+    if (!limited) {
+        return slice;
+    }
+
+    uint32_t leaf = nodeOf(process);
+    SimTime granted = slice;
+    bool bounded = false;
+    for (uint32_t node = leaf; node != ROOT; node = nodes[node].parent) {
+        if (nodes[node].quota == 0) continue;
+        refresh(node, start);
+        const Node& group = nodes[node];
+        granted = min({granted, group.pool, (group.periodIndex + 1) * group.period - start});
+        bounded = true;
+    }
+    if (!bounded || granted <= 0) {
+        return bounded ? 0 : slice;
+    }
+
+    for (uint32_t node = leaf; node != ROOT; node = nodes[node].parent) {
+        Node& group = nodes[node];
+        if (group.quota == 0) continue;
+        group.pool -= granted;
+        group.grants++;
+        if (group.pool == 0) {
+            setThrottled(node, true);
+        }
+        updateHeld(node);
+    }
+    grants[cpu] = {leaf, granted, start, true};
+    return granted;
+}
+
+/**
+ * Charge Implementation
+ */
+void ProcessGroups::charge(int cpu, ProcessHandle process, SimTime elapsed) {
+    for (uint32_t node = nodeOf(process); ; node = nodes[node].parent) {
+        nodes[node].runTime += elapsed;
+        if (node == ROOT) break;
+    }
+    Grant& held = grants[cpu];
+    if (held.active) {
+        held.amount -= min(elapsed, held.amount);
+    }
+}
+
+/**
+ * Release Grant Implementation
+ * Unused quota only goes back to the period it was taken from
+ */
+void ProcessGroups::release(int cpu) {
+    Grant& held = grants[cpu];
+    if (!held.active) {
+        return;
+    }
+    held.active = false;
+
+    for (uint32_t node = held.node; node != ROOT; node = nodes[node].parent) {
+        Node& group = nodes[node];
+        if (group.quota == 0) continue;
+        group.grants--;
+        if (held.amount > 0 && held.start / group.period == group.periodIndex) {
+            group.pool = min(group.quota, group.pool + held.amount);
+            if (group.throttled) {
+                setThrottled(node, false);
+            }
+        }
+        updateHeld(node);
+    }
+}
+
+/**
+ * Refill Implementation
+ */
+void ProcessGroups::refill(uint32_t node) {
+    nodes[node].refillPending = false;
+    refresh(node, clock);
+    if (nodes[node].throttled && scheduleRefill) {
+        nodes[node].refillPending = true;
+        scheduleRefill((nodes[node].periodIndex + 1) * nodes[node].period, node);
+    }
+}
+
+/**
+ * Record Completion Implementation
+ */
+void ProcessGroups::recordCompletion(ProcessHandle process, SimTime waiting, SimTime response,
+                                     SimTime turnaround) {
+    for (uint32_t node = nodeOf(process); ; node = nodes[node].parent) {
+        nodes[node].waitingTimes.record(waiting);
+        nodes[node].responseTimes.record(response);
+        nodes[node].turnaroundTimes.record(turnaround);
+        if (node == ROOT) break;
+    }
+}
+
+/**
+ * Get Statistics Implementation
+ * Children follow their parent, in creation order
+ */
+vector<GroupStatistics> ProcessGroups::getStatistics(SimTime makespan, int cpuCount) const {
+    vector<vector<uint32_t>> children(nodes.size());
+    for (uint32_t node = 1; node < nodes.size(); ++node) {
+        children[nodes[node].parent].push_back(node);
+    }
+
+    vector<GroupStatistics> result;
+    vector<uint32_t> pending = {ROOT};
+    while (!pending.empty()) {
+        uint32_t node = pending.back();
+        pending.pop_back();
+        pending.insert(pending.end(), children[node].rbegin(), children[node].rend());
+
+        const Node& group = nodes[node];
+        GroupStatistics stats;
+        stats.path = group.path;
+        stats.depth = group.depth;
+        stats.weight = group.weight;
+        stats.quota = group.quota;
+        stats.period = group.quota > 0 ? group.period : 0;
+        stats.runTime = group.runTime;
+        stats.utilisation = makespan > 0 ? static_cast<double>(group.runTime) /
+                                           (static_cast<double>(makespan) * max(cpuCount, 1)) : 0.0;
+        stats.throttledTime = group.throttledTime + (group.heldSince >= 0 ? clock - group.heldSince : 0);
+        stats.throttles = group.throttles;
+        stats.waiting = group.waitingTimes;
+        stats.response = group.responseTimes;
+        stats.turnaround = group.turnaroundTimes;
+        result.push_back(std::move(stats));
+    }
+    return result;
+}
+
+// ========================================================================================
+// GROUP READY QUEUE IMPLEMENTATION
+// ========================================================================================
+
+/**
+ * Group Ready Queue Constructor Implementation
+ */
+GroupReadyQueue::GroupReadyQueue(ProcessGroups& processGroups, ReadyQueueOrder order,
+                                 const ProcessTable& table, QueueFactory queueFactory)
+    : ReadyQueue(order, table), groups(processGroups), factory(std::move(queueFactory)) {
+    groups.registerQueue(this);
+}
+
+/**
+ * Destructor Implementation
+ */
+GroupReadyQueue::~GroupReadyQueue() {
+    groups.unregisterQueue(this);
+}
+
+/**
+ * Get Entry Implementation
+ * Parents are created before their children, so growing for a node never
+ * moves the entries of its parents while they are in use
+ */
+GroupReadyQueue::Entry& GroupReadyQueue::entry(uint32_t node) {
+    if (node >= entries.size()) {
+        entries.resize(max<size_t>(groups.size(), node + 1));
+    }
+    return entries[node];
+}
+
+/**
+ * Get Own Queue Implementation
+ */
+ReadyQueue& GroupReadyQueue::ownQueue(uint32_t node) {
+    Entry& group = entry(node);
+    if (!group.own) {
+        group.own = factory();
+    }
+    return *group.own;
+}
+
+/**
+ * Relink Implementation
+ * A group is in its parent's set while it has selectable processes and is not throttled
+ */
+void GroupReadyQueue::relink(uint32_t node) {
+    Entry& group = entries[node];
+    Entry& parent = entries[groups.parentOf(node)];
+    bool wanted = group.eligible > 0 && !groups.isThrottled(node);
+    if (wanted && !group.linked) {
+        group.vruntime = max(group.vruntime, parent.minVruntime);
+        parent.entities.insert({group.vruntime, node});
+        group.linked = true;
+    } else if (!wanted && group.linked) {
+        parent.entities.erase({group.vruntime, node});
+        group.linked = false;
+    }
+}
+
+/**
+ * Relink Own Entity Implementation
+ */
+void GroupReadyQueue::relinkOwn(uint32_t node) {
+    Entry& group = entries[node];
+    bool wanted = group.own && !group.own->empty();
+    if (wanted && !group.ownLinked) {
+        group.ownVruntime = max(group.ownVruntime, group.minVruntime);
+        group.entities.insert({group.ownVruntime, SELF});
+        group.ownLinked = true;
+    } else if (!wanted && group.ownLinked) {
+        group.entities.erase({group.ownVruntime, SELF});
+        group.ownLinked = false;
+    }
+}
+
+/**
+ * Add Eligible Implementation
+ * The change climbs the tree until it reaches a throttled group, whose
+ * parent does not see its processes
+ */
+void GroupReadyQueue::addEligible(uint32_t node, int64_t delta) {
+    entry(node).eligible += delta;
+    while (node != ProcessGroups::ROOT && !groups.isThrottled(node)) {
+        uint32_t parent = groups.parentOf(node);
+        relink(node);
+        entries[parent].eligible += delta;
+        node = parent;
+    }
+}
+
+/**
+ * Selected Node Implementation
+ */
+uint32_t GroupReadyQueue::selectedNode() const {
+    uint32_t node = ProcessGroups::ROOT;
+    while (node < entries.size() && !entries[node].entities.empty()) {
+        uint32_t next = entries[node].entities.begin()->second;
+        if (next == SELF) {
+            break;
+        }
+        node = next;
+    }
+    return node;
+}
+
+/**
+ * Push Process Implementation
+ */
+void GroupReadyQueue::push(ProcessHandle handle) {
+    uint32_t node = groups.nodeOf(handle);
+    ownQueue(node).push(handle);
+    relinkOwn(node);
+    addEligible(node, 1);
+    groups.changeWaiting(node, 1);
+}
+
+/**
+ * Peek Best Process Implementation
+ */
+ProcessHandle GroupReadyQueue::top() const {
+    if (size() == 0) {
+        return INVALID_PROCESS;
+    }
+    return entries[selectedNode()].own->top();
+}
+
+/**
+ * Pop Best Process Implementation
+ * Every level on the way down advances its virtual time floor to the entity it picks
+ */
+ProcessHandle GroupReadyQueue::pop() {
+    if (size() == 0) {
+        return INVALID_PROCESS;
+    }
+
+    uint32_t node = ProcessGroups::ROOT;
+    while (true) {
+        Entry& group = entries[node];
+        auto [vruntime, next] = *group.entities.begin();
+        group.minVruntime = max(group.minVruntime, vruntime);
+        if (next == SELF) break;
+        node = next;
+    }
+
+    ProcessHandle handle = entries[node].own->pop();
+    relinkOwn(node);
+    addEligible(node, -1);
+    groups.changeWaiting(node, -1);
+    return handle;
+}
+
+/**
+ * Get Queue Size Implementation
+ */
+size_t GroupReadyQueue::size() const {
+    return entries.empty() ? 0 : entries[ProcessGroups::ROOT].eligible;
+}
+
+/**
+ * Clear Queue Implementation
+ * Only used between runs: the group tree is reset along with the queues
+ */
+void GroupReadyQueue::clear() {
+    for (Entry& group : entries) {
+        if (group.own) {
+            group.own->clear();
+        }
+        group.entities.clear();
+        group.vruntime = 0;
+        group.ownVruntime = 0;
+        group.minVruntime = 0;
+        group.eligible = 0;
+        group.linked = false;
+        group.ownLinked = false;
+    }
+}
+
+/**
+ * Outranks Implementation
+ * Processes of different groups are never compared
+ */
+bool GroupReadyQueue::outranks(ProcessHandle a, ProcessHandle b) const {
+    uint32_t node = groups.nodeOf(a);
+    if (node != groups.nodeOf(b)) {
+        return false;
+    }
+    return node < entries.size() && entries[node].own ? entries[node].own->outranks(a, b)
+                                                      : ordering.outranks(a, b);
+}
+
+/**
+ * Collect Processes Implementation
+ * Group by group, each in its own dispatch order
+ */
+void GroupReadyQueue::collect(vector<ProcessHandle>& out) const {
+    for (const Entry& group : entries) {
+        if (group.own) {
+            group.own->collect(out);
+        }
+    }
+}
+
+/**
+ * Charge Implementation
+ * The own entity runs at the default weight; each group on the path at its own
+ */
+void GroupReadyQueue::charge(ProcessHandle process, SimTime elapsed) {
+    uint32_t node = groups.nodeOf(process);
+    Entry& leaf = entry(node);
+    int64_t ownDelta = elapsed * VRUNTIME_SCALE / GroupHierarchy::DEFAULT_WEIGHT;
+    if (leaf.ownLinked) {
+        leaf.entities.erase({leaf.ownVruntime, SELF});
+        leaf.ownVruntime += ownDelta;
+        leaf.entities.insert({leaf.ownVruntime, SELF});
+    } else {
+        leaf.ownVruntime += ownDelta;
+    }
+
+    while (node != ProcessGroups::ROOT) {
+        Entry& group = entries[node];
+        int64_t delta = elapsed * VRUNTIME_SCALE / groups.weightOf(node);
+        uint32_t parent = groups.parentOf(node);
+        if (group.linked) {
+            entries[parent].entities.erase({group.vruntime, node});
+            group.vruntime += delta;
+            entries[parent].entities.insert({group.vruntime, node});
+        } else {
+            group.vruntime += delta;
+        }
+        node = parent;
+    }
+}
+
+/**
+ * Throttling Changed Implementation
+ */
+void GroupReadyQueue::throttlingChanged(uint32_t node) {
+    if (node == ProcessGroups::ROOT || node >= entries.size() || entries[node].eligible == 0) {
+        return;
+    }
+    int64_t delta = static_cast<int64_t>(entries[node].eligible);
+    relink(node);
+    addEligible(groups.parentOf(node), groups.isThrottled(node) ? -delta : delta);
+}
+
+/**
+ * Get Selected Queue Implementation
+ */
+ReadyQueue& GroupReadyQueue::getSelectedQueue() {
+    return ownQueue(selectedNode());
+}
+
+/**
+ * Get Group Queue Implementation
+ */
+ReadyQueue& GroupReadyQueue::getGroupQueue(ProcessHandle process) {
+    return ownQueue(groups.nodeOf(process));
+}
+
+/**
+ * For Each Group Queue Implementation
+ */
+void GroupReadyQueue::forEachGroupQueue(const function<void(ReadyQueue&)>& visit) {
+    for (Entry& group : entries) {
+        if (group.own) {
+            visit(*group.own);
+        }
+    }
+}
@@ -0,0 +1,125 @@
+/**
+ * Instrumentation.cpp - Hot-Path Profiling Counters Implementation File
+ *
+ * This source file contains the thread-local binding, merging and the JSON
+ * dump of the profiling counters.
+ *
+ */
+
+#include "Instrumentation.h"
+
+#include <algorithm>    // For max
+
+#ifdef SCHEDULER_PROFILING
+thread_local ProfileCounters* activeProfile = nullptr;
+#endif
+
+/**
+ * Get Profile Phase Name Implementation
+ */
+string profilePhaseToString(ProfilePhase phase) {
+    switch (phase) {
+        case ProfilePhase::ARRIVALS:
+            return "arrivals";
+        case ProfilePhase::EVENTS:
+            return "events";
+        case ProfilePhase::SELECTION:
+            return "selection";
+        case ProfilePhase::DISPATCH:
+            return "dispatch";
+        case ProfilePhase::PREEMPTION:
+            return "preemption";
+        case ProfilePhase::STATISTICS:
+            return "statistics";
+        case ProfilePhase::OUTPUT:
+            return "output";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+/**
+ * Get Profile Counter Name Implementation
+ */
+string profileCounterToString(ProfileCounter counter) {
+    switch (counter) {
+        case ProfileCounter::STEPS:
+            return "steps";
+        case ProfileCounter::EVENTS:
+            return "events";
+        case ProfileCounter::STALE_EVENTS:
+            return "stale_events";
+        case ProfileCounter::ARRIVALS:
+            return "arrivals";
+        case ProfileCounter::DISPATCHES:
+            return "dispatches";
+        case ProfileCounter::PREEMPTIONS:
+            return "preemptions";
+        case ProfileCounter::QUANTUM_EXPIRIES:
+            return "quantum_expiries";
+        case ProfileCounter::IDLE_STEPS:
+            return "idle_steps";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+/**
+ * Get Profile Clock Name Implementation
+ */
+const char* getProfileClockName() {
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    return "tsc";
+#elif defined(__aarch64__)
+    return "cntvct";
+#else
+    return "ns";
+#endif
+}
+
+// ========================================================================================
+// PROFILE COUNTERS IMPLEMENTATION
+// ========================================================================================
+
+/**
+ * Merge Implementation
+ */
+void ProfileCounters::merge(const ProfileCounters& other) {
+    for (size_t i = 0; i < PROFILE_PHASE_COUNT; ++i) {
+        phaseTicks[i] += other.phaseTicks[i];
+        phaseCalls[i] += other.phaseCalls[i];
+    }
+    for (size_t i = 0; i < PROFILE_COUNTER_COUNT; ++i) {
+        counters[i] += other.counters[i];
+    }
+    runTicks += other.runTicks;
+    readyQueueHighWater = max(readyQueueHighWater, other.readyQueueHighWater);
+    eventQueueHighWater = max(eventQueueHighWater, other.eventQueueHighWater);
+}
+
+/**
+ * Print JSON Implementation
+ * Ticks outside every phase (loop control, queue pops) are reported as "other"
+ */
+void ProfileCounters::printJson(ostream& output, const string& label) const {
+    uint64_t phaseTotal = 0;
+    for (size_t i = 0; i < PROFILE_PHASE_COUNT; ++i) {
+        phaseTotal += phaseTicks[i];
+    }
+
+    output << "{\"algorithm\":\"" << label << "\",\"enabled\":" << (isProfilingEnabled() ? "true" : "false")
+           << ",\"clock\":\"" << getProfileClockName() << "\",\"run_ticks\":" << runTicks
+           << ",\"phases\":{";
+    for (size_t i = 0; i < PROFILE_PHASE_COUNT; ++i) {
+        output << '"' << profilePhaseToString(static_cast<ProfilePhase>(i)) << "\":{\"ticks\":"
+               << phaseTicks[i] << ",\"calls\":" << phaseCalls[i] << "},";
+    }
+    output << "\"other\":{\"ticks\":" << (runTicks > phaseTotal ? runTicks - phaseTotal : 0) << "}}"
+           << ",\"counters\":{";
+    for (size_t i = 0; i < PROFILE_COUNTER_COUNT; ++i) {
+        output << (i > 0 ? "," : "") << '"' << profileCounterToString(static_cast<ProfileCounter>(i))
+               << "\":" << counters[i];
+    }
+    output << "},\"high_water\":{\"ready_queue\":" << readyQueueHighWater
+           << ",\"event_queue\":" << eventQueueHighWater << "}}";
+}
@@ -0,0 +1,212 @@
+/**
+ * LiveArrivalSource.cpp - Live Process Submission Feed Implementation File
+ *
+ * This source file contains the lock-free submission queue and the lockstep
+ * wait of the live arrival source.
+ *
+ */
+
+#include "LiveArrivalSource.h"
+
+#include <algorithm>    // For push_heap and pop_heap
+#include <functional>   // For greater
+#include <thread>       // For yield and sleep_for
+
+static const unsigned SPIN_ROUNDS = 64;         // Yields before the consumer starts sleeping
+static const double MAX_SLEEP_SECONDS = 200e-6; // Longest sleep between two looks at the queue
+
+/**
+ * Get Live Clock Name Implementation
+ */
+string liveClockToString(LiveClock clock) {
+    switch (clock) {
+        case LiveClock::VIRTUAL:
+            return "virtual";
+        case LiveClock::WALL:
+            return "wall";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+// ========================================================================================
+// PRODUCER SIDE
+// ========================================================================================
+
+/**
+ * Live Arrival Source Constructor Implementation
+ */
+LiveArrivalSource::LiveArrivalSource(LiveClock liveClock, double timeScale)
+    : head(nullptr), virtualTime(0), closed(false), tail(nullptr), clock(liveClock),
+      unitsPerSecond(timeScale > 0.0 ? timeScale : 1000.0), start(chrono::steady_clock::now()),
+      received(0), late(0), granted(-1), finished(false)
+{
+    Node* stub = new Node();
+    stub->next.store(nullptr, memory_order_relaxed);
+    head.store(stub, memory_order_relaxed);
+    tail = stub;
+}
+
+/**
+ * Live Arrival Source Destructor Implementation
+ */
+LiveArrivalSource::~LiveArrivalSource() {
+    while (tail) {
+        Node* next = tail->next.load(memory_order_acquire);
+        delete tail;
+        tail = next;
+    }
+}
+
+/**
+ * Submit Process Implementation
+ *
+ * Algorithm flow:
+ * 1. Stamp the arrival time (wall clock only) and fill a fresh node.
+ * 2. Swap the node in as the new head; this orders the producers.
+ * 3. Link the previous head to it. Until then the consumer sees the queue
+ *    end at the previous head and simply picks the node up on a later drain.
+ */
+void LiveArrivalSource::submit(ProcessSpec spec) {
+    if (clock == LiveClock::WALL) {
+        spec.arrivalTime = getClock();
+    }
+    Node* node = new Node();
+    node->next.store(nullptr, memory_order_relaxed);
+    node->spec = std::move(spec);
+
+    Node* previous = head.exchange(node, memory_order_acq_rel);
+    previous->next.store(node, memory_order_release);
+}
+
+/**
+ * Advance Clock Implementation
+ */
+void LiveArrivalSource::advanceClock(SimTime time) {
+    SimTime current = virtualTime.load(memory_order_relaxed);
+    while (time > current &&
+           !virtualTime.compare_exchange_weak(current, time, memory_order_release, memory_order_relaxed)) {
+    }
+}
+
+/**
+ * Close Feed Implementation
+ */
+void LiveArrivalSource::close() {
+    closed.store(true, memory_order_release);
+}
+
+/**
+ * Get Clock Implementation
+ */
+SimTime LiveArrivalSource::getClock() const {
+    if (clock == LiveClock::VIRTUAL) {
+        return virtualTime.load(memory_order_acquire);
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return static_cast<SimTime>(seconds * unitsPerSecond);
+}
+
+// ========================================================================================
+// CONSUMER SIDE
+// ========================================================================================
+
+/**
+ * Drain Queue Implementation
+ */
+void LiveArrivalSource::drain() {
+    Node* next;
+    while ((next = tail->next.load(memory_order_acquire)) != nullptr) {
+        Buffered arrival;
+        arrival.arrivalTime = next->spec.arrivalTime;
+        if (arrival.arrivalTime <= granted) {
+            arrival.arrivalTime = granted + 1;
+            late++;
+        }
+        arrival.sequence = received++;
+        arrival.spec = std::move(next->spec);
+        buffer.push_back(std::move(arrival));
+        push_heap(buffer.begin(), buffer.end(), greater<Buffered>());
+
+        delete tail;
+        tail = next;
+    }
+}
+
+/**
+ * Has Next Process Implementation
+ */
+bool LiveArrivalSource::hasNext() const {
+    return !finished || !buffer.empty();
+}
+
+/**
+ * Peek Arrival Time Implementation
+ */
+SimTime LiveArrivalSource::peekArrivalTime() const {
+    return buffer.empty() ? INT64_MAX : buffer.front().arrivalTime;
+}
+
+/**
+ * Next Process Implementation
+ */
+bool LiveArrivalSource::next(ProcessSpec& spec) {
+    if (buffer.empty()) {
+        return false;
+    }
+    pop_heap(buffer.begin(), buffer.end(), greater<Buffered>());
+    spec = std::move(buffer.back().spec);
+    spec.arrivalTime = buffer.back().arrivalTime;
+    buffer.pop_back();
+    return true;
+}
+
+/**
+ * Await Arrivals Implementation
+ *
+ * Algorithm flow:
+ * 1. Drain the queue. The closed flag is read first, so a drain that follows
+ *    a closed flag has seen every submission.
+ * 2. The step is safe once the clock has passed the earlier of the requested
+ *    time and the earliest buffered arrival, because every later submission
+ *    arrives at the clock or after it.
+ * 3. Otherwise yield, then sleep in short slices (with the wall clock, no
+ *    longer than the time left) and try again.
+ * 4. If the wait turned up an earlier arrival or ended the feed, the caller
+ *    has to recompute its step; otherwise nothing can arrive up to the step
+ *    any more.
+ */
+bool LiveArrivalSource::awaitArrivals(SimTime time) {
+    const bool hadNext = hasNext();
+    unsigned rounds = 0;
+    while (!finished) {
+        bool closing = closed.load(memory_order_acquire);
+        drain();
+        if (closing) {
+            finished = true;
+            break;
+        }
+
+        SimTime bound = min(time, peekArrivalTime());
+        SimTime now = getClock();
+        if (bound < INT64_MAX && now > bound) {
+            break;
+        }
+
+        if (++rounds <= SPIN_ROUNDS) {
+            this_thread::yield();
+            continue;
+        }
+        double pause = MAX_SLEEP_SECONDS;
+        if (clock == LiveClock::WALL && bound < INT64_MAX) {
+            pause = min(pause, static_cast<double>(bound + 1 - now) / unitsPerSecond);
+        }
+        this_thread::sleep_for(chrono::duration<double>(pause));
+    }
+
+    if (hasNext() != hadNext || peekArrivalTime() < time) {
+        return false;
+    }
+    granted = max(granted, time);
+    return true;
+}
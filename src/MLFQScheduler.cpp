@@ -0,0 +1,406 @@
+#include "MLFQScheduler.h"
+#include "SchedulingKernel.h"
+
+#include <climits>      // For quantum saturation
+
+using namespace std;
+
+// ========================================================================================
+// FEEDBACK LEVELS
+// ========================================================================================
+
+/**
+ * Set Level Implementation
+ */
+void FeedbackLevels::set(ProcessHandle handle, int newLevel, int remaining) {
+    if (handle >= epoch.size()) {
+        level.resize(handle + 1, 0);
+        levelStart.resize(handle + 1, 0);
+        epoch.resize(handle + 1, 0);
+    }
+    level[handle] = static_cast<uint8_t>(newLevel);
+    levelStart[handle] = remaining;
+    epoch[handle] = currentEpoch;
+}
+
+// ========================================================================================
+// MULTILEVEL READY QUEUE
+// ========================================================================================
+
+MultilevelReadyQueue::MultilevelReadyQueue(int levelCount, FeedbackLevels& feedback,
+                                           const ProcessTable& table)
+    : ReadyQueue(ReadyQueueOrder::FIFO, table),
+      levels(feedback),
+      processes(table),
+      head(levelCount, INVALID_PROCESS),
+      tail(levelCount, INVALID_PROCESS),
+      nonEmpty(0),
+      count(0) {}
+
+void MultilevelReadyQueue::append(int level, ProcessHandle handle, SimTime time) {
+    if (handle >= next.size()) {
+        next.resize(handle + 1, INVALID_PROCESS);
+        joined.resize(handle + 1, 0);
+    }
+    next[handle] = INVALID_PROCESS;
+    joined[handle] = time;
+    if (head[level] == INVALID_PROCESS) {
+        head[level] = handle;
+        nonEmpty |= uint64_t(1) << level;
+    } else {
+        next[tail[level]] = handle;
+    }
+    tail[level] = handle;
+}
+
+ProcessHandle MultilevelReadyQueue::popLevel(int level) {
+    ProcessHandle handle = head[level];
+    head[level] = next[handle];
+    if (head[level] == INVALID_PROCESS) {
+        tail[level] = INVALID_PROCESS;
+        nonEmpty &= ~(uint64_t(1) << level);
+    }
+    return handle;
+}
+
+void MultilevelReadyQueue::push(ProcessHandle handle) {
+    int level = min(levels.get(handle), static_cast<int>(head.size()) - 1);
+    append(level, handle, processes.readyTime[handle]);
+    count++;
+}
+
+ProcessHandle MultilevelReadyQueue::top() const {
+    return nonEmpty ? head[__builtin_ctzll(nonEmpty)] : INVALID_PROCESS;
+}
+
+ProcessHandle MultilevelReadyQueue::pop() {
+    if (!nonEmpty) return INVALID_PROCESS;
+    count--;
+    return popLevel(__builtin_ctzll(nonEmpty));
+}
+
+size_t MultilevelReadyQueue::size() const {
+    return count;
+}
+
+void MultilevelReadyQueue::clear() {
+    fill(head.begin(), head.end(), INVALID_PROCESS);
+    fill(tail.begin(), tail.end(), INVALID_PROCESS);
+    nonEmpty = 0;
+    count = 0;
+}
+
+void MultilevelReadyQueue::collect(vector<ProcessHandle>& out) const {
+    for (ProcessHandle first : head) {
+        for (ProcessHandle handle = first; handle != INVALID_PROCESS; handle = next[handle]) {
+            out.push_back(handle);
+        }
+    }
+}
+
+bool MultilevelReadyQueue::outranks(ProcessHandle a, ProcessHandle b) const {
+    return levels.get(a) < levels.get(b);
+}
+
+/**
+ * Boost Implementation
+ * Splices the lower lists behind level 0 in level order
+ */
+void MultilevelReadyQueue::boost() {
+    uint64_t lower = nonEmpty & ~uint64_t(1);
+    while (lower) {
+        int level = __builtin_ctzll(lower);
+        lower &= lower - 1;
+        if (head[0] == INVALID_PROCESS) {
+            head[0] = head[level];
+        } else {
+            next[tail[0]] = head[level];
+        }
+        tail[0] = tail[level];
+        head[level] = INVALID_PROCESS;
+        tail[level] = INVALID_PROCESS;
+    }
+    nonEmpty = nonEmpty ? 1 : 0;
+}
+
+/**
+ * Age Implementation
+ * Lists are ordered by join time, so only heads are inspected. Levels are
+ * visited top-down and promoted processes join with the current time, so a
+ * process climbs at most one level per call.
+ */
+int MultilevelReadyQueue::age(SimTime now, SimTime threshold) {
+    int promoted = 0;
+    uint64_t lower = nonEmpty & ~uint64_t(1);
+    while (lower) {
+        int level = __builtin_ctzll(lower);
+        lower &= lower - 1;
+        while (head[level] != INVALID_PROCESS && now - joined[head[level]] >= threshold) {
+            ProcessHandle handle = popLevel(level);
+            levels.set(handle, level - 1, processes.remainingTime[handle]);
+            append(level - 1, handle, now);
+            promoted++;
+        }
+    }
+    return promoted;
+}
+
+// ========================================================================================
+// MLFQ SCHEDULER
+// ========================================================================================
+
+/**
+ * MLFQ Constructor
+ * Base class queues were built before this object existed; rebuild them as
+ * multilevel queues
+ */
+MLFQScheduler::MLFQScheduler(int levelCount, int baseQuantum, SimTime boost, SimTime aging)
+    : RoundRobinScheduler("MLFQ", baseQuantum, true),
+      boostInterval(boost > 0 ? boost : 0),
+      agingThreshold(aging > 0 ? aging : 0),
+      demotions(0),
+      promotions(0),
+      boosts(0) {
+    if (levelCount < 1 || levelCount > MultilevelReadyQueue::MAX_LEVELS) {
+        cerr << "Warning: MLFQ level count must be between 1 and "
+             << MultilevelReadyQueue::MAX_LEVELS << ". Using 3." << endl;
+        levelCount = 3;
+    }
+    int quantum = getTimeQuantum();
+    for (int level = 0; level < levelCount; ++level) {
+        quanta.push_back(quantum);
+        quantum = quantum < INT_MAX / 2 ? quantum * 2 : INT_MAX;
+    }
+    rebuildReadyQueues();
+}
+
+/**
+ * Implements the Multilevel Feedback Queue (MLFQ) Scheduling Algorithm
+ *
+ * Algorithm flow:
+ * 1. Run the shared event loop with a per-level time slice:
+ *    - Arrivals join the back of level 0 and preempt a process running on a
+ *      lower level.
+ *    - A process that uses up its level's quantum is demoted one level.
+ *    - Before each dispatch, processes that waited the aging threshold at
+ *      their level are promoted one level.
+ *    - Every boost interval all processes return to level 0.
+ *    - The head of the highest non-empty level is dispatched.
+ * 2. Stop when all processes are terminated.
+ */
+bool MLFQScheduler::schedule() {
+    if (isTraceEnabled()) {
+        trace() << "\n=== MLFQ Scheduling Execution (" << getLevelCount() << " levels, quanta";
+        for (int quantum : quanta) {
+            trace() << ' ' << quantum;
+        }
+        trace() << ") ===\n";
+    }
+
+    levels.resetAll();
+    demotions = 0;
+    promotions = 0;
+    boosts = 0;
+    return runEventLoop<MLFQScheduler>();
+}
+
+/**
+ * Set Level Quanta Implementation
+ */
+bool MLFQScheduler::setQuanta(const vector<int>& levelQuanta) {
+    if (levelQuanta.empty() || levelQuanta.size() > static_cast<size_t>(MultilevelReadyQueue::MAX_LEVELS)) {
+        cerr << "Error: MLFQ needs between 1 and " << MultilevelReadyQueue::MAX_LEVELS
+             << " levels" << endl;
+        return false;
+    }
+    for (int quantum : levelQuanta) {
+        if (quantum <= 0) {
+            cerr << "Error: MLFQ quanta must be positive" << endl;
+            return false;
+        }
+    }
+    quanta = levelQuanta;
+    rebuildReadyQueues();
+    return true;
+}
+
+/**
+ * Set Boost Interval Implementation
+ */
+void MLFQScheduler::setBoostInterval(SimTime interval) {
+    boostInterval = interval > 0 ? interval : 0;
+}
+
+/**
+ * Set Aging Threshold Implementation
+ */
+void MLFQScheduler::setAgingThreshold(SimTime threshold) {
+    agingThreshold = threshold > 0 ? threshold : 0;
+}
+
+MultilevelReadyQueue& MLFQScheduler::levelQueue(int cpu) {
+    return static_cast<MultilevelReadyQueue&>(getRunQueue(cpu));
+}
+
+unique_ptr<ReadyQueue> MLFQScheduler::createRunQueue(ReadyQueueOrder) {
+    return make_unique<MultilevelReadyQueue>(static_cast<int>(quanta.size()), levels, table);
+}
+
+/**
+ * Select Next Process
+ * Ages the run queue (the one of the group served next, with process groups),
+ * then takes the head of its highest non-empty level
+ */
+ProcessHandle MLFQScheduler::selectNextProcess(int cpu) {
+    auto& queue = static_cast<MultilevelReadyQueue&>(getPolicyQueue(cpu));
+    if (agingThreshold > 0) {
+        int promoted = queue.age(currentTime, agingThreshold);
+        promotions += promoted;
+        if (promoted > 0 && isTraceEnabled()) {
+            traceEvent(cpu) << promoted << " waiting process(es) aged up one level\n";
+        }
+    }
+
+    ProcessHandle process = getRunQueue(cpu).pop();
+    levels.touch(process, table.remainingTime[process]);
+    return process;
+}
+
+/**
+ * Each dispatch runs for what is left of the level's quantum
+ */
+int MLFQScheduler::getTimeSlice(ProcessHandle process) const {
+    int remaining = table.remainingTime[process];
+    int slice = quanta[levels.get(process)] - levels.used(process, remaining);
+    return slice > 0 ? slice : 1;
+}
+
+string MLFQScheduler::getDispatchMessage(ProcessHandle process) const {
+    return "Process " + string(table.name(process)) + " (level " +
+           to_string(levels.get(process)) + ") started/resumed";
+}
+
+/**
+ * Demote once the level's quantum is used up
+ */
+void MLFQScheduler::onQuantumExpired(ProcessHandle process, int cpu) {
+    int level = levels.get(process);
+    int remaining = table.remainingTime[process];
+    if (levels.used(process, remaining) < quanta[level]) {
+        return;
+    }
+
+    int lower = min(level + 1, static_cast<int>(quanta.size()) - 1);
+    levels.set(process, lower, remaining);
+    if (lower != level) {
+        demotions++;
+        if (isTraceEnabled()) {
+            traceEvent(cpu) << "Process " << table.name(process) << " demoted to level " << lower << '\n';
+        }
+    }
+}
+
+/**
+ * The new process starts on level 0 with a fresh allotment
+ */
+void MLFQScheduler::onProcessRecycled(ProcessHandle process) {
+    levels.set(process, 0, table.remainingTime[process]);
+}
+
+/**
+ * Saved state: the counters, the level and level start of every process
+ * (-1 when it has no current entry), then the join time of every queued
+ * process in dispatch order
+ */
+void MLFQScheduler::savePolicyState(vector<int64_t>& state) const {
+    state.push_back(demotions);
+    state.push_back(promotions);
+    state.push_back(boosts);
+    state.push_back(static_cast<int64_t>(table.size()));
+    for (ProcessHandle process = 0; process < table.size(); ++process) {
+        bool current = levels.isCurrent(process);
+        state.push_back(current ? levels.get(process) : -1);
+        state.push_back(current ? levels.getLevelStart(process) : 0);
+    }
+
+    const size_t queueCount = loadBalancing == LoadBalancing::GLOBAL_QUEUE ? 1 : cpus.size();
+    vector<ProcessHandle> queued;
+    for (size_t queue = 0; queue < queueCount; ++queue) {
+        const auto& source = static_cast<const MultilevelReadyQueue&>(*cpus[queue].queue);
+        queued.clear();
+        source.collect(queued);
+        for (ProcessHandle process : queued) {
+            state.push_back(source.getJoinTime(process));
+        }
+    }
+}
+
+/**
+ * Processes are queued by level, so the lists are refilled once the levels
+ * are back. Under another policy every process starts on level 0.
+ */
+void MLFQScheduler::restorePolicyState(const SchedulerSnapshot& source, bool samePolicy) {
+    for (size_t queue = 0; queue < source.queues.size(); ++queue) {
+        levelQueue(static_cast<int>(queue)).clear();
+    }
+    levels.resetAll();
+    demotions = promotions = boosts = 0;
+
+    const vector<int64_t>& state = source.policyState;
+    size_t word = 0;
+    if (samePolicy) {
+        demotions = static_cast<int>(state[word++]);
+        promotions = static_cast<int>(state[word++]);
+        boosts = static_cast<int>(state[word++]);
+        size_t count = static_cast<size_t>(state[word++]);
+        const int lowest = getLevelCount() - 1;
+        for (ProcessHandle process = 0; process < count; ++process) {
+            int64_t level = state[word++];
+            int64_t start = state[word++];
+            if (level >= 0) {
+                levels.set(process, min(static_cast<int>(level), lowest), static_cast<int>(start));
+            }
+        }
+    } else {
+        for (const CpuState& cpu : cpus) {
+            if (cpu.current != INVALID_PROCESS) {
+                levels.touch(cpu.current, table.remainingTime[cpu.current]);
+            }
+        }
+    }
+
+    for (size_t queue = 0; queue < source.queues.size(); ++queue) {
+        MultilevelReadyQueue& target = levelQueue(static_cast<int>(queue));
+        for (ProcessHandle process : source.queues[queue]) {
+            target.push(process);
+            if (samePolicy) {
+                target.setJoinTime(process, state[word++]);
+            }
+        }
+    }
+}
+
+SimTime MLFQScheduler::getTimerInterval() const {
+    return quanta.size() > 1 ? boostInterval : 0;
+}
+
+/**
+ * Priority Boost
+ * Every process returns to level 0 with a fresh allotment
+ */
+void MLFQScheduler::onTimer() {
+    levels.resetAll();
+    for (int cpu = 0; cpu < static_cast<int>(cpus.size()); ++cpu) {
+        if (cpus[cpu].current != INVALID_PROCESS) {
+            accountRunningTime(cpu);
+            levels.touch(cpus[cpu].current, table.remainingTime[cpus[cpu].current]);
+        }
+        forEachPolicyQueue(cpu, [](ReadyQueue& queue) {
+            static_cast<MultilevelReadyQueue&>(queue).boost();
+        });
+    }
+    boosts++;
+    if (isTraceEnabled()) {
+        trace() << "Time " << currentTime << ": Priority boost\n";
+    }
+}
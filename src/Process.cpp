@@ -35,11 +35,14 @@ Process::Process(const string& processName, int arrival, int burst, Priority pri
       arrivalTime(arrival),              // Set arrival time
       burstTime(burst),                  // Set required CPU time
       remainingTime(burst),              // Initially equals burst time
+      period(0),                         // Not periodic
+      relativeDeadline(0),               // No deadline
       waitingTime(0),                    // No waiting time initially
       turnaroundTime(0),                 // No turnaround time initially
       responseTime(-1),                  // -1 indicates not yet started
       startTime(-1),                     // -1 indicates not yet started
-      hasStarted(false)                  // Process hasn't started execution
+      hasStarted(false),                 // Process hasn't started execution
+      readyTime(-1)                      // Not in the ready queue yet
 {
     // Validate input parameters
     if (arrival < 0) {
@@ -56,24 +59,28 @@ Process::Process(const string& processName, int arrival, int burst, Priority pri
 
 /**
  * Copy Constructor Implementation
- * Creates a copy of an existing process with a new unique PID
+ * Creates a copy of an existing process with the same PID
  */
 Process::Process(const Process& other)
-    : pid(nextPID++),                    // New unique PID
+    : pid(other.pid),                    // Same process, same PID
       name(other.name),                  // Copy name
       state(other.state),                // Copy state
       priority(other.priority),          // Copy priority
       arrivalTime(other.arrivalTime),    // Copy arrival time
       burstTime(other.burstTime),        // Copy burst time
       remainingTime(other.remainingTime), // Copy remaining time
+      ioBursts(other.ioBursts),          // Copy I/O burst sequence
+      period(other.period),              // Copy period
+      relativeDeadline(other.relativeDeadline), // Copy relative deadline
       waitingTime(other.waitingTime),    // Copy waiting time
       turnaroundTime(other.turnaroundTime), // Copy turnaround time
       responseTime(other.responseTime),  // Copy response time
       startTime(other.startTime),        // Copy start time
-      hasStarted(other.hasStarted)       // Copy execution flag
+      hasStarted(other.hasStarted),      // Copy execution flag
+      readyTime(other.readyTime)         // Copy ready queue entry time
 {
-    // Copy constructor creates a new process with fresh PID
-    // but copies all other attributes from the original process
+    // The PID counter is not advanced: PIDs only depend on the processes
+    // constructed, not on how often they are copied
 }
 
 /**
@@ -93,11 +100,15 @@ Process& Process::operator=(const Process& other) {
     arrivalTime = other.arrivalTime;
     burstTime = other.burstTime;
     remainingTime = other.remainingTime;
+    ioBursts = other.ioBursts;
+    period = other.period;
+    relativeDeadline = other.relativeDeadline;
     waitingTime = other.waitingTime;
     turnaroundTime = other.turnaroundTime;
     responseTime = other.responseTime;
     startTime = other.startTime;
     hasStarted = other.hasStarted;
+    readyTime = other.readyTime;
     
     return *this;
 }
@@ -118,6 +129,20 @@ void Process::reset() {
     responseTime = -1;                  // Reset response time indicator
     startTime = -1;                     // Reset start time indicator
     hasStarted = false;                 // Reset execution flag
+    readyTime = -1;                     // Not in the ready queue
+}
+
+/**
+ * Add I/O Burst Implementation
+ * Invalid requests are rejected here; the workload checks the whole sequence
+ * against the burst time when the process is added to a scheduler
+ */
+void Process::addIoBurst(int cpuBefore, int duration, uint16_t device) {
+    if (cpuBefore <= 0 || duration <= 0) {
+        cout << "Warning: Process " << name << " ignores I/O burst with non-positive times." << endl;
+        return;
+    }
+    ioBursts.push_back({cpuBefore, duration, device});
 }
 
 /**
@@ -146,6 +171,13 @@ string Process::getProcessInfo() const {
     info += "  Burst Time: " + to_string(burstTime) + "\n";
     info += "  Remaining Time: " + to_string(remainingTime) + "\n";
     
+    if (period > 0) {
+        info += "  Period: " + to_string(period) + "\n";
+    }
+    if (relativeDeadline > 0) {
+        info += "  Relative Deadline: " + to_string(relativeDeadline) + "\n";
+    }
+    
     if (hasStarted) {
         info += "  Start Time: " + to_string(startTime) + "\n";
         info += "  Response Time: " + to_string(responseTime) + "\n";
@@ -183,9 +215,7 @@ void Process::updateStatistics(int completionTime) {
     // Calculate turnaround time (completion time - arrival time)
     turnaroundTime = completionTime - arrivalTime;
     
-    // Calculate waiting time (turnaround time - burst time)
-    waitingTime = turnaroundTime - burstTime;
-    
+    // Waiting time was accumulated lazily while the process sat in the ready queue
     // Ensure waiting time is not negative (shouldn't happen in proper scheduling)
     if (waitingTime < 0) {
         waitingTime = 0;
@@ -210,7 +240,22 @@ void Process::updateStatistics(int completionTime) {
  * Helper function that returns a string representation of the process state
  */
 string Process::stateToString() const {
-    switch (state) {
+    return stateToString(state);
+}
+
+/**
+ * Convert Priority to String Implementation
+ * Helper function that returns a string representation of the process priority
+ */
+string Process::priorityToString() const {
+    return priorityToString(priority);
+}
+
+/**
+ * Convert Process State to String (Static) Implementation
+ */
+string Process::stateToString(ProcessState processState) {
+    switch (processState) {
         case ProcessState::NEW:
             return "NEW";
         case ProcessState::READY:
@@ -227,11 +272,10 @@ string Process::stateToString() const {
 }
 
 /**
- * Convert Priority to String Implementation
- * Helper function that returns a string representation of the process priority
+ * Convert Priority to String (Static) Implementation
  */
-string Process::priorityToString() const {
-    switch (priority) {
+string Process::priorityToString(Priority processPriority) {
+    switch (processPriority) {
         case Priority::HIGH:
             return "HIGH";
         case Priority::MEDIUM:
@@ -242,3 +286,10 @@ string Process::priorityToString() const {
             return "UNKNOWN";
     }
 }
+
+/**
+ * Reset PID Counter Implementation
+ */
+void Process::resetPIDCounter(int firstPID) {
+    nextPID = firstPID;
+}
@@ -0,0 +1,693 @@
+/**
+ * ProcessTable.cpp - Structure-of-Arrays Process Table Implementation File
+ *
+ * This source file contains the implementation of the string pool, the
+ * workload column store, the per-run process table and the process view.
+ *
+ */
+
+#include "ProcessTable.h"
+
+#include <algorithm>    // For stable_sort and fill
+#include <charconv>     // For I/O burst parsing
+#include <cstring>      // For memcpy
+#include <numeric>      // For iota
+
+// ========================================================================================
+// STRING POOL IMPLEMENTATION
+// ========================================================================================
+
+/**
+ * String Pool Constructor Implementation
+ */
+StringPool::StringPool() : blockUsed(BLOCK_SIZE), indexedCount(0) {}
+
+/**
+ * String Pool Copy Constructor Implementation
+ * Views must point into the new pool's own blocks, so strings are copied
+ * again under the same ids
+ */
+StringPool::StringPool(const StringPool& other) : blockUsed(BLOCK_SIZE), indexedCount(0) {
+    strings.reserve(other.strings.size());
+    for (const auto& text : other.strings) {
+        append(text);
+    }
+}
+
+/**
+ * String Pool Assignment Operator Implementation
+ */
+StringPool& StringPool::operator=(const StringPool& other) {
+    if (this == &other) {
+        return *this;
+    }
+
+    blocks.clear();
+    blockUsed = BLOCK_SIZE;
+    strings.clear();
+    index.clear();
+    indexedCount = 0;
+    strings.reserve(other.strings.size());
+    for (const auto& text : other.strings) {
+        append(text);
+    }
+    return *this;
+}
+
+/**
+ * Store String Implementation
+ * Strings are copied into the current block; oversized strings get a block of their own
+ */
+string_view StringPool::store(string_view text) {
+    char* storage;
+    if (text.size() > BLOCK_SIZE) {
+        blocks.emplace_back(new char[text.size()]);
+        storage = blocks.back().get();
+        // Keep filling the previous block afterwards
+        if (blocks.size() > 1) {
+            swap(blocks[blocks.size() - 1], blocks[blocks.size() - 2]);
+        } else {
+            blockUsed = BLOCK_SIZE;
+        }
+    } else {
+        if (blocks.empty() || blockUsed + text.size() > BLOCK_SIZE) {
+            blocks.emplace_back(new char[BLOCK_SIZE]);
+            blockUsed = 0;
+        }
+        storage = blocks.back().get() + blockUsed;
+        blockUsed += text.size();
+    }
+
+    if (!text.empty()) {
+        memcpy(storage, text.data(), text.size());
+    }
+    return string_view(storage, text.size());
+}
+
+/**
+ * Intern String Implementation
+ * Appended strings are indexed first, the earliest id winning for duplicates
+ */
+uint32_t StringPool::intern(string_view text) {
+    for (; indexedCount < strings.size(); ++indexedCount) {
+        index.emplace(strings[indexedCount], static_cast<uint32_t>(indexedCount));
+    }
+
+    auto found = index.find(text);
+    if (found != index.end()) {
+        return found->second;
+    }
+
+    uint32_t id = append(text);
+    index.emplace(strings.back(), id);
+    indexedCount = strings.size();
+    return id;
+}
+
+/**
+ * Append String Implementation
+ */
+uint32_t StringPool::append(string_view text) {
+    uint32_t id = static_cast<uint32_t>(strings.size());
+    strings.push_back(store(text));
+    return id;
+}
+
+/**
+ * Reserve Capacity Implementation
+ */
+void StringPool::reserve(size_t count) {
+    strings.reserve(count);
+}
+
+/**
+ * Get String Implementation
+ */
+string_view StringPool::get(uint32_t id) const {
+    return id < strings.size() ? strings[id] : string_view();
+}
+
+/**
+ * Get Pool Size Implementation
+ */
+size_t StringPool::size() const {
+    return strings.size();
+}
+
+// ========================================================================================
+// WORKLOAD IMPLEMENTATION
+// ========================================================================================
+
+/**
+ * Workload Constructor Implementation
+ */
+Workload::Workload() : nextPid(1), maxPid(0), sortedByArrival(true) {}
+
+/**
+ * Add Process Implementation
+ */
+ProcessHandle Workload::add(const ProcessSpec& spec) {
+    if (!spec.ioBursts.empty() &&
+        !checkIoBursts(spec.ioBursts.data(), spec.ioBursts.size(), max(spec.burstTime, 1))) {
+        cerr << "Warning: Process " << spec.name << " has an invalid I/O burst sequence" << endl;
+        return INVALID_PROCESS;
+    }
+
+    ProcessHandle handle = addRow(spec.name, spec.arrivalTime, spec.burstTime, spec.priority, spec.pid, true);
+    if (handle != INVALID_PROCESS && !spec.ioBursts.empty()) {
+        setIoBursts(handle, spec.ioBursts);
+    }
+    if (handle != INVALID_PROCESS && !setTiming(handle, spec.period, spec.relativeDeadline)) {
+        cout << "Warning: Process " << spec.name << " has a negative period or deadline. Ignoring them." << endl;
+    }
+    if (handle != INVALID_PROCESS && !setGroup(handle, spec.group)) {
+        cout << "Warning: Process " << spec.name << " has an invalid group path. Using the root group." << endl;
+    }
+    return handle;
+}
+
+/**
+ * Add Process (Field Overload) Implementation
+ */
+ProcessHandle Workload::add(string_view name, SimTime arrival, int burst,
+                            Priority prio, int explicitPid) {
+    return addRow(name, arrival, burst, prio, explicitPid, true);
+}
+
+/**
+ * Add Row Implementation
+ * Duplicate detection is free while PIDs keep increasing (the common case);
+ * the PID set is only materialised the first time an out-of-order PID shows up
+ */
+ProcessHandle Workload::addRow(string_view name, SimTime arrival, int burst,
+                               Priority prio, int explicitPid, bool internName) {
+    int processPid = explicitPid >= 0 ? explicitPid : nextPid;
+
+    if (processPid <= maxPid) {
+        if (usedPids.empty()) {
+            usedPids.insert(pid.begin(), pid.end());
+        }
+        if (usedPids.count(processPid)) {
+            cerr << "Warning: Process with PID " << processPid << " already exists" << endl;
+            return INVALID_PROCESS;
+        }
+    }
+    if (!usedPids.empty()) {
+        usedPids.insert(processPid);
+    }
+
+    if (arrival < 0) {
+        cout << "Warning: Process " << name << " has negative arrival time. Setting to 0." << endl;
+        arrival = 0;
+    }
+
+    if (burst <= 0) {
+        cout << "Warning: Process " << name << " has invalid burst time. Setting to 1." << endl;
+        burst = 1;
+    }
+
+    if (!arrivalTime.empty() && arrival < arrivalTime.back()) {
+        sortedByArrival = false;
+    }
+
+    ProcessHandle handle = static_cast<ProcessHandle>(pid.size());
+    pid.push_back(processPid);
+    nameId.push_back(internName ? names.intern(name) : names.append(name));
+    arrivalTime.push_back(arrival);
+    burstTime.push_back(burst);
+    priority.push_back(prio);
+
+    maxPid = max(maxPid, processPid);
+    nextPid = max(nextPid, processPid + 1);
+    return handle;
+}
+
+/**
+ * Check I/O Bursts Implementation
+ */
+bool Workload::checkIoBursts(const IoBurst* bursts, size_t count, int burst) {
+    int64_t cpuTime = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (bursts[i].cpuBefore <= 0 || bursts[i].duration <= 0) {
+            return false;
+        }
+        cpuTime += bursts[i].cpuBefore;
+    }
+    return cpuTime < burst;
+}
+
+/**
+ * Set I/O Bursts Implementation
+ * Rows between the last process with I/O and this one get empty ranges
+ */
+bool Workload::setIoBursts(ProcessHandle handle, const vector<IoBurst>& bursts) {
+    if (handle + 1 != size() || ioOffset.size() > handle + 1 ||
+        !checkIoBursts(bursts.data(), bursts.size(), burstTime[handle])) {
+        return false;
+    }
+    if (bursts.empty()) {
+        return true;
+    }
+
+    if (ioOffset.empty()) {
+        ioOffset.push_back(0);
+    }
+    ioOffset.resize(handle + 1, static_cast<uint32_t>(ioBursts.size()));
+    ioBursts.insert(ioBursts.end(), bursts.begin(), bursts.end());
+    ioOffset.push_back(static_cast<uint32_t>(ioBursts.size()));
+    return true;
+}
+
+/**
+ * Set Timing Implementation
+ * Rows between the last real-time process and this one get zeros
+ */
+bool Workload::setTiming(ProcessHandle handle, int taskPeriod, int deadline) {
+    if (handle >= size() || taskPeriod < 0 || deadline < 0) {
+        return false;
+    }
+    if (deadline == 0) {
+        deadline = taskPeriod;
+    }
+    if (handle >= relativeDeadline.size()) {
+        if (deadline == 0) {
+            return true;
+        }
+        period.resize(handle + 1, 0);
+        relativeDeadline.resize(handle + 1, 0);
+    }
+
+    period[handle] = taskPeriod;
+    relativeDeadline[handle] = deadline;
+    while (!relativeDeadline.empty() && relativeDeadline.back() == 0) {
+        period.pop_back();
+        relativeDeadline.pop_back();
+    }
+    return true;
+}
+
+/**
+ * Set Group Implementation
+ * Rows between the last grouped process and this one get the root group
+ */
+bool Workload::setGroup(ProcessHandle handle, string_view path) {
+    if (handle >= size() || !isValidGroupPath(path)) {
+        return false;
+    }
+    if (path.empty() && handle >= group.size()) {
+        return true;
+    }
+
+    if (groupPaths.size() == 0) {
+        groupPaths.intern("");
+    }
+    if (handle >= group.size()) {
+        group.resize(handle + 1, 0);
+    }
+    group[handle] = groupPaths.intern(path);
+    while (!group.empty() && group.back() == 0) {
+        group.pop_back();
+    }
+    return true;
+}
+
+/**
+ * Is Valid Group Path Implementation
+ */
+bool Workload::isValidGroupPath(string_view path) {
+    if (path.empty()) {
+        return true;
+    }
+    size_t start = 0;
+    while (true) {
+        size_t slash = path.find('/', start);
+        size_t length = (slash == string_view::npos ? path.size() : slash) - start;
+        if (length == 0) {
+            return false;
+        }
+        if (slash == string_view::npos) {
+            return true;
+        }
+        start = slash + 1;
+    }
+}
+
+/**
+ * Reuse Row Implementation
+ */
+bool Workload::assign(ProcessHandle handle, const ProcessSpec& spec) {
+    if (handle >= size() || ioCount(handle) > 0 || !spec.ioBursts.empty()) {
+        return false;
+    }
+
+    int processPid = spec.pid >= 0 ? spec.pid : nextPid;
+    if (!usedPids.empty()) {
+        usedPids.insert(processPid);
+    }
+    if (handle > 0 && spec.arrivalTime < arrivalTime[handle - 1]) {
+        sortedByArrival = false;
+    }
+
+    pid[handle] = processPid;
+    nameId[handle] = names.intern(spec.name);
+    arrivalTime[handle] = max<SimTime>(spec.arrivalTime, 0);
+    burstTime[handle] = max(spec.burstTime, 1);
+    priority[handle] = spec.priority;
+    if (!setTiming(handle, spec.period, spec.relativeDeadline)) {
+        setTiming(handle, 0, 0);
+    }
+    if (!setGroup(handle, spec.group)) {
+        setGroup(handle, "");
+    }
+
+    maxPid = max(maxPid, processPid);
+    nextPid = max(nextPid, processPid + 1);
+    return true;
+}
+
+/**
+ * Truncate Implementation
+ * Interned names of the dropped rows stay in the pool
+ */
+void Workload::truncate(size_t count) {
+    if (count >= size()) {
+        return;
+    }
+
+    pid.resize(count);
+    nameId.resize(count);
+    arrivalTime.resize(count);
+    burstTime.resize(count);
+    priority.resize(count);
+    if (ioOffset.size() > count + 1) {
+        ioBursts.resize(ioOffset[count]);
+        ioOffset.resize(count + 1);
+    }
+    if (ioBursts.empty()) {
+        ioOffset.clear();
+    }
+    if (relativeDeadline.size() > count) {
+        period.resize(count);
+        relativeDeadline.resize(count);
+        while (!relativeDeadline.empty() && relativeDeadline.back() == 0) {
+            period.pop_back();
+            relativeDeadline.pop_back();
+        }
+    }
+    if (group.size() > count) {
+        group.resize(count);
+        while (!group.empty() && group.back() == 0) {
+            group.pop_back();
+        }
+    }
+
+    usedPids.clear();
+    maxPid = 0;
+    for (int processPid : pid) {
+        maxPid = max(maxPid, processPid);
+    }
+    nextPid = maxPid + 1;
+    sortedByArrival = is_sorted(arrivalTime.begin(), arrivalTime.end());
+}
+
+/**
+ * Parse I/O Burst Implementation
+ */
+bool Workload::parseIoBurst(string_view token, IoBurst& burst) {
+    const char* cursor = token.data();
+    const char* end = cursor + token.size();
+    auto number = [&cursor, end](auto& value) {
+        auto result = from_chars(cursor, end, value);
+        cursor = result.ptr;
+        return result.ec == errc();
+    };
+
+    burst.device = 0;
+    if (!number(burst.cpuBefore) || cursor == end || *cursor++ != ':' || !number(burst.duration)) {
+        return false;
+    }
+    if (cursor != end && (*cursor++ != '@' || !number(burst.device))) {
+        return false;
+    }
+    return cursor == end && burst.cpuBefore > 0 && burst.duration > 0;
+}
+
+/**
+ * Reserve Capacity Implementation
+ */
+void Workload::reserve(size_t capacity) {
+    pid.reserve(capacity);
+    nameId.reserve(capacity);
+    arrivalTime.reserve(capacity);
+    burstTime.reserve(capacity);
+    priority.reserve(capacity);
+    names.reserve(capacity);
+}
+
+/**
+ * Get Process Count Implementation
+ */
+size_t Workload::size() const {
+    return pid.size();
+}
+
+/**
+ * Get Process Name Implementation
+ */
+string_view Workload::name(ProcessHandle handle) const {
+    return names.get(nameId[handle]);
+}
+
+/**
+ * Is Sorted By Arrival Implementation
+ */
+bool Workload::isSortedByArrival() const {
+    return sortedByArrival;
+}
+
+/**
+ * Get Arrival Order Implementation
+ */
+vector<ProcessHandle> Workload::getArrivalOrder() const {
+    vector<ProcessHandle> order(size());
+    iota(order.begin(), order.end(), 0);
+
+    if (!sortedByArrival) {
+        stable_sort(order.begin(), order.end(),
+                    [this](ProcessHandle a, ProcessHandle b) {
+                        return arrivalTime[a] < arrivalTime[b];
+                    });
+    }
+    return order;
+}
+
+// ========================================================================================
+// PROCESS TABLE IMPLEMENTATION
+// ========================================================================================
+
+/**
+ * Bind Workload Implementation
+ */
+void ProcessTable::bind(shared_ptr<const Workload> source, bool keepState) {
+    workload = std::move(source);
+    if (keepState) {
+        syncSize();
+        return;
+    }
+
+    remainingTime.clear();
+    state.clear();
+    startTime.clear();
+    completionTime.clear();
+    waitingTime.clear();
+    readyTime.clear();
+    lastCpu.clear();
+    blockAt.clear();
+    ioCursor.clear();
+    syncSize();
+}
+
+/**
+ * Sync Size Implementation
+ * New rows start in their initial NEW state
+ */
+void ProcessTable::syncSize() {
+    size_t oldSize = state.size();
+    size_t newSize = workload ? workload->size() : 0;
+
+    if (newSize < oldSize) {
+        remainingTime.resize(newSize);
+        state.resize(newSize);
+        startTime.resize(newSize);
+        completionTime.resize(newSize);
+        waitingTime.resize(newSize);
+        readyTime.resize(newSize);
+        lastCpu.resize(newSize);
+        if (newSize == 0 || !workload->hasIo()) {
+            blockAt.clear();
+            ioCursor.clear();
+        } else if (blockAt.size() > newSize) {
+            blockAt.resize(newSize);
+            ioCursor.resize(newSize);
+        }
+        return;
+    }
+
+    // The I/O columns appear with the first process that has I/O bursts
+    if (newSize > 0 && workload->hasIo() && blockAt.size() < newSize) {
+        size_t oldIoSize = blockAt.size();
+        blockAt.resize(newSize, 0);
+        ioCursor.resize(newSize, 0);
+        for (size_t i = oldIoSize; i < newSize; ++i) {
+            ProcessHandle handle = static_cast<ProcessHandle>(i);
+            if (workload->ioCount(handle) > 0) {
+                blockAt[i] = workload->burstTime[i] - workload->ioBurst(handle, 0).cpuBefore;
+            }
+        }
+    }
+
+    if (newSize <= oldSize) {
+        return;
+    }
+
+    remainingTime.resize(newSize);
+    state.resize(newSize, ProcessState::NEW);
+    startTime.resize(newSize, -1);
+    completionTime.resize(newSize, -1);
+    waitingTime.resize(newSize, 0);
+    readyTime.resize(newSize, -1);
+    lastCpu.resize(newSize, -1);
+
+    for (size_t i = oldSize; i < newSize; ++i) {
+        remainingTime[i] = workload->burstTime[i];
+    }
+}
+
+/**
+ * Reset Rows Implementation
+ */
+void ProcessTable::reset() {
+    syncSize();
+    if (workload) {
+        copy(workload->burstTime.begin(), workload->burstTime.begin() + size(), remainingTime.begin());
+    }
+    fill(state.begin(), state.end(), ProcessState::NEW);
+    fill(startTime.begin(), startTime.end(), -1);
+    fill(completionTime.begin(), completionTime.end(), -1);
+    fill(waitingTime.begin(), waitingTime.end(), 0);
+    fill(readyTime.begin(), readyTime.end(), -1);
+    fill(lastCpu.begin(), lastCpu.end(), -1);
+
+    if (!blockAt.empty()) {
+        for (ProcessHandle handle = 0; handle < blockAt.size(); ++handle) {
+            blockAt[handle] = workload->ioCount(handle) > 0
+                ? workload->burstTime[handle] - workload->ioBurst(handle, 0).cpuBefore : 0;
+        }
+        fill(ioCursor.begin(), ioCursor.end(), 0);
+    }
+}
+
+/**
+ * Reset Row Implementation
+ */
+void ProcessTable::resetRow(ProcessHandle handle) {
+    remainingTime[handle] = workload->burstTime[handle];
+    state[handle] = ProcessState::NEW;
+    startTime[handle] = -1;
+    completionTime[handle] = -1;
+    waitingTime[handle] = 0;
+    readyTime[handle] = -1;
+    lastCpu[handle] = -1;
+    if (handle < blockAt.size()) {
+        blockAt[handle] = workload->ioCount(handle) > 0
+            ? workload->burstTime[handle] - workload->ioBurst(handle, 0).cpuBefore : 0;
+        ioCursor[handle] = 0;
+    }
+}
+
+/**
+ * Advance I/O Implementation
+ */
+void ProcessTable::advanceIo(ProcessHandle handle) {
+    uint32_t next = ++ioCursor[handle];
+    blockAt[handle] = next < workload->ioCount(handle)
+        ? blockAt[handle] - workload->ioBurst(handle, next).cpuBefore : 0;
+}
+
+/**
+ * Get Process Count Implementation
+ */
+size_t ProcessTable::size() const {
+    return state.size();
+}
+
+/**
+ * Get Bound Workload Implementation
+ */
+const Workload& ProcessTable::getWorkload() const {
+    return *workload;
+}
+
+// ========================================================================================
+// PROCESS VIEW IMPLEMENTATION
+// ========================================================================================
+
+/**
+ * Process View Constructor Implementation
+ */
+ProcessView::ProcessView(const ProcessTable& processTable, ProcessHandle processHandle)
+    : table(&processTable), handle(processHandle) {}
+
+/**
+ * Check if Process is Complete Implementation
+ */
+bool ProcessView::isComplete() const {
+    return state() == ProcessState::TERMINATED || remainingTime() <= 0;
+}
+
+/**
+ * Print Current Process Status Implementation
+ */
+void ProcessView::printStatus() const {
+    cout << "PID: " << setw(3) << pid()
+         << " | Name: " << setw(10) << name()
+         << " | State: " << setw(9) << Process::stateToString(state())
+         << " | Priority: " << setw(6) << Process::priorityToString(priority())
+         << " | Remaining: " << setw(3) << remainingTime()
+         << " | Arrival: " << setw(3) << arrivalTime()
+         << " | Burst: " << setw(3) << burstTime() << endl;
+}
+
+/**
+ * Get Process Information Summary Implementation
+ */
+string ProcessView::getProcessInfo() const {
+    string info = "Process " + name() + " (PID: " + to_string(pid()) + ")\n";
+    info += "  State: " + Process::stateToString(state()) + "\n";
+    info += "  Priority: " + Process::priorityToString(priority()) + "\n";
+    info += "  Arrival Time: " + to_string(arrivalTime()) + "\n";
+    info += "  Burst Time: " + to_string(burstTime()) + "\n";
+    info += "  Remaining Time: " + to_string(remainingTime()) + "\n";
+
+    if (period() > 0) {
+        info += "  Period: " + to_string(period()) + "\n";
+    }
+    if (relativeDeadline() > 0) {
+        info += "  Relative Deadline: " + to_string(relativeDeadline()) + "\n";
+    }
+    if (table->group(handle) != 0) {
+        info += "  Group: " + string(table->getWorkload().groupPath(table->group(handle))) + "\n";
+    }
+
+    if (hasStarted()) {
+        info += "  Start Time: " + to_string(startTime()) + "\n";
+        info += "  Response Time: " + to_string(responseTime()) + "\n";
+    }
+
+    if (state() == ProcessState::TERMINATED) {
+        info += "  Waiting Time: " + to_string(waitingTime()) + "\n";
+        info += "  Turnaround Time: " + to_string(turnaroundTime()) + "\n";
+    }
+
+    return info;
+}
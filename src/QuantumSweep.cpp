@@ -0,0 +1,288 @@
+/**
+ * QuantumSweep.cpp - Round Robin Quantum Sweep Implementation File
+ *
+ * This source file contains the implementation of the parallel Round Robin
+ * quantum sweep with early stopping.
+ *
+ */
+
+#include "QuantumSweep.h"
+
+#include <atomic>       // For the shared best total
+#include <iomanip>      // For formatted output
+#include <iostream>     // For output operations
+#include <limits>       // For the initial best total
+#include <mutex>        // For the scheduler pool
+
+#include "ComparisonRunner.h"       // For runParallel
+#include "RoundRobinScheduler.h"    // For the swept policy
+
+// ========================================================================================
+// CONSTRUCTOR AND CONFIGURATION
+// ========================================================================================
+
+/**
+ * Quantum Sweep Constructor Implementation
+ */
+QuantumSweep::QuantumSweep(shared_ptr<const Workload> sharedWorkload,
+                           SchedulingMetric target, size_t threads)
+    : workload(std::move(sharedWorkload)),
+      objective(target),
+      earlyStop(true),
+      threadCount(threads),
+      cpuCount(1),
+      loadBalancing(LoadBalancing::GLOBAL_QUEUE),
+      balanceInterval(10),
+      bestIndex(-1) {}
+
+/**
+ * Add Quantum Implementation
+ */
+void QuantumSweep::addQuantum(int quantum) {
+    if (quantum <= 0) {
+        cerr << "Warning: Ignoring non-positive time quantum " << quantum << endl;
+        return;
+    }
+    quanta.push_back(quantum);
+}
+
+/**
+ * Add Quantum Range Implementation
+ */
+void QuantumSweep::addQuantumRange(int first, int last, int step) {
+    if (step <= 0) {
+        cerr << "Warning: Quantum range step must be positive. Using 1." << endl;
+        step = 1;
+    }
+    for (int quantum = first; quantum <= last; quantum += step) {
+        addQuantum(quantum);
+    }
+}
+
+/**
+ * Set Objective Implementation
+ */
+void QuantumSweep::setObjective(SchedulingMetric target) {
+    objective = target;
+}
+
+/**
+ * Set Early Stop Implementation
+ */
+void QuantumSweep::setEarlyStop(bool enabled) {
+    earlyStop = enabled;
+}
+
+/**
+ * Set Thread Count Implementation
+ */
+void QuantumSweep::setThreadCount(size_t threads) {
+    threadCount = threads;
+}
+
+/**
+ * Set Machine Implementation
+ */
+void QuantumSweep::setMachine(int cpus, LoadBalancing strategy, SimTime interval) {
+    cpuCount = cpus;
+    loadBalancing = strategy;
+    balanceInterval = interval;
+}
+
+/**
+ * Set Dispatch Costs Implementation
+ */
+void QuantumSweep::setDispatchCosts(const DispatchCosts& costs) {
+    dispatchCosts = costs;
+}
+
+// ========================================================================================
+// EXECUTION
+// ========================================================================================
+
+/**
+ * Run Sweep Implementation
+ *
+ * Algorithm flow:
+ * 1. Run the quanta on the worker pool. A run takes an idle Round Robin
+ *    scheduler from a shared pool (creating one only if all are busy), sets
+ *    its quantum and returns it afterwards, so at most one process table per
+ *    worker is allocated and later runs rewind it in place.
+ * 2. Each run starts with the best total found so far as its cutoff and
+ *    publishes its own total when it completes.
+ * 3. Pick the completed run with the smallest total (smaller quantum on ties).
+ */
+const vector<QuantumSweepResult>& QuantumSweep::run() {
+    results.assign(quanta.size(), QuantumSweepResult());
+    bestIndex = -1;
+
+    vector<unique_ptr<RoundRobinScheduler>> idle;
+    mutex poolMutex;
+    auto acquire = [&]() {
+        {
+            lock_guard<mutex> lock(poolMutex);
+            if (!idle.empty()) {
+                unique_ptr<RoundRobinScheduler> scheduler = std::move(idle.back());
+                idle.pop_back();
+                return scheduler;
+            }
+        }
+        auto scheduler = make_unique<RoundRobinScheduler>();
+        scheduler->setVerbosity(Verbosity::QUIET);
+        scheduler->setCpuCount(cpuCount);
+        scheduler->setLoadBalancing(loadBalancing, balanceInterval);
+        scheduler->setDispatchCosts(dispatchCosts);
+        scheduler->setWorkload(workload);
+        return scheduler;
+    };
+
+    atomic<double> bestTotal(numeric_limits<double>::infinity());
+
+    runParallel(quanta.size(), threadCount, [&](size_t index) {
+        unique_ptr<RoundRobinScheduler> pooled = acquire();
+        RoundRobinScheduler& scheduler = *pooled;
+        QuantumSweepResult& result = results[index];
+        result.quantum = quanta[index];
+        scheduler.setTimeQuantum(quanta[index]);
+
+        double limit = bestTotal.load(memory_order_relaxed);
+        if (earlyStop && limit < numeric_limits<double>::infinity()) {
+            scheduler.setCutoff(objective, limit);
+        } else {
+            scheduler.clearCutoff();
+        }
+
+        result.completed = scheduler.schedule();
+        result.pruned = scheduler.wasCutOff();
+        if (result.completed) {
+            result.averageWaitingTime = scheduler.getAverageWaitingTime();
+            result.averageTurnaroundTime = scheduler.getAverageTurnaroundTime();
+            result.averageResponseTime = scheduler.getAverageResponseTime();
+            result.contextSwitches = scheduler.getContextSwitchCount();
+            result.totalExecutionTime = scheduler.getTotalExecutionTime();
+            result.overheadTime = scheduler.getOverheadTime();
+
+            // Publish the total if it is a new best
+            double total = scheduler.getMetricTotal(objective);
+            double best = bestTotal.load(memory_order_relaxed);
+            while (total < best && !bestTotal.compare_exchange_weak(best, total, memory_order_relaxed)) {
+            }
+        }
+
+        lock_guard<mutex> lock(poolMutex);
+        idle.push_back(std::move(pooled));
+    });
+
+    // Deterministic winner regardless of which runs were pruned
+    auto objectiveValue = [this](const QuantumSweepResult& result) {
+        switch (objective) {
+            case SchedulingMetric::WAITING_TIME:
+                return result.averageWaitingTime;
+            case SchedulingMetric::TURNAROUND_TIME:
+                return result.averageTurnaroundTime;
+            case SchedulingMetric::RESPONSE_TIME:
+                return result.averageResponseTime;
+            case SchedulingMetric::CONTEXT_SWITCHES:
+                return static_cast<double>(result.contextSwitches);
+        }
+        return 0.0;
+    };
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        if (!results[i].completed) {
+            continue;
+        }
+        if (bestIndex < 0) {
+            bestIndex = static_cast<int>(i);
+            continue;
+        }
+        const QuantumSweepResult& best = results[bestIndex];
+        double value = objectiveValue(results[i]);
+        double bestValue = objectiveValue(best);
+        if (value < bestValue || (value == bestValue && results[i].quantum < best.quantum)) {
+            bestIndex = static_cast<int>(i);
+        }
+    }
+
+    return results;
+}
+
+/**
+ * Get Results Implementation
+ */
+const vector<QuantumSweepResult>& QuantumSweep::getResults() const {
+    return results;
+}
+
+/**
+ * Get Best Result Implementation
+ */
+const QuantumSweepResult* QuantumSweep::getBest() const {
+    return bestIndex >= 0 ? &results[bestIndex] : nullptr;
+}
+
+// ========================================================================================
+// REPORTING
+// ========================================================================================
+
+/**
+ * Print Sweep Results Implementation
+ */
+void QuantumSweep::printResults() const {
+    cout << "\n=== Round Robin Quantum Sweep (objective: "
+         << schedulingMetricToString(objective) << ") ===" << endl;
+    cout << setw(8) << "Quantum"
+         << setw(10) << "Waiting"
+         << setw(12) << "Turnaround"
+         << setw(10) << "Response"
+         << setw(10) << "Switches"
+         << setw(10) << "Makespan"
+         << setw(10) << "Overhead" << endl;
+    cout << string(70, '-') << endl;
+
+    for (const auto& result : results) {
+        cout << setw(8) << result.quantum;
+        if (!result.completed) {
+            cout << setw(62) << (result.pruned ? "pruned" : "FAILED") << endl;
+            continue;
+        }
+        cout << fixed << setprecision(2)
+             << setw(10) << result.averageWaitingTime
+             << setw(12) << result.averageTurnaroundTime
+             << setw(10) << result.averageResponseTime
+             << setw(10) << result.contextSwitches
+             << setw(10) << result.totalExecutionTime
+             << setw(10) << result.overheadTime << endl;
+    }
+
+    cout << string(70, '-') << endl;
+    const QuantumSweepResult* best = getBest();
+    if (best) {
+        cout << "Best quantum: " << best->quantum << endl;
+    } else {
+        cout << "No run completed" << endl;
+    }
+}
+
+/**
+ * Print Sweep CSV Implementation
+ */
+void QuantumSweep::printCsv() const {
+    const QuantumSweepResult* best = getBest();
+
+    cout << "quantum,completed,pruned,avg_waiting,avg_turnaround,avg_response,"
+         << "context_switches,makespan,overhead,best\n";
+    for (const auto& result : results) {
+        cout << result.quantum << ',' << (result.completed ? 1 : 0) << ','
+             << (result.pruned ? 1 : 0) << ','
+             << fixed << setprecision(4)
+             << result.averageWaitingTime << ','
+             << result.averageTurnaroundTime << ','
+             << result.averageResponseTime << ','
+             << result.contextSwitches << ','
+             << result.totalExecutionTime << ','
+             << result.overheadTime << ','
+             << (&result == best ? 1 : 0) << '\n';
+    }
+    cout.flush();
+}
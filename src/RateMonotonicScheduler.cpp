@@ -0,0 +1,21 @@
+#include "../include/RateMonotonicScheduler.h"
+#include "../include/SchedulingKernel.h"
+
+RateMonotonicScheduler::RateMonotonicScheduler()
+    : Scheduler("Rate Monotonic", true, ReadyQueueOrder::PERIOD) {}
+
+bool RateMonotonicScheduler::schedule() {
+    if (isTraceEnabled()) {
+        trace() << "\n=== " << algorithmName << " Scheduling Execution ===\n";
+    }
+
+    return runEventLoop<RateMonotonicScheduler>();
+}
+
+string RateMonotonicScheduler::getDispatchMessage(ProcessHandle process) const {
+    if (table.period(process) == 0) {
+        return "Process " + string(table.name(process)) + " (aperiodic) started";
+    }
+    return "Process " + string(table.name(process)) + " (Period " +
+           to_string(table.period(process)) + ") started";
+}
@@ -0,0 +1,517 @@
+/**
+ * ReadyQueue.cpp - Pluggable Ready Queue Implementation File
+ *
+ * This source file contains the FIFO, binary heap and pairing heap ready
+ * queues used by the Scheduler engine.
+ *
+ */
+
+#include "ReadyQueue.h"
+
+#include <algorithm>    // For sort
+
+#include "VectorKernels.h" // Include the vectorised argmin scan
+
+// ========================================================================================
+// PROCESS ORDERING IMPLEMENTATION
+// ========================================================================================
+
+/**
+ * Comparator Constructor Implementation
+ */
+ProcessOrdering::ProcessOrdering(ReadyQueueOrder queueOrder, const ProcessTable& processTable)
+    : order(queueOrder), table(&processTable) {}
+
+/**
+ * Compare Two Entries Implementation
+ * Primary key first, then arrival time, then PID
+ */
+bool ProcessOrdering::operator()(const ReadyQueueEntry& a, const ReadyQueueEntry& b) const {
+    ProcessHandle ha = a.handle;
+    ProcessHandle hb = b.handle;
+
+    switch (order) {
+        case ReadyQueueOrder::FIFO:
+            return a.sequence < b.sequence;
+        case ReadyQueueOrder::BURST_TIME:
+            if (table->burstTime(ha) != table->burstTime(hb)) {
+                return table->burstTime(ha) < table->burstTime(hb);
+            }
+            break;
+        case ReadyQueueOrder::PRIORITY:
+            if (table->priority(ha) != table->priority(hb)) {
+                return table->priority(ha) < table->priority(hb);
+            }
+            break;
+        case ReadyQueueOrder::REMAINING_TIME:
+            if (table->remainingTime[ha] != table->remainingTime[hb]) {
+                return table->remainingTime[ha] < table->remainingTime[hb];
+            }
+            break;
+        case ReadyQueueOrder::DEADLINE:
+            if (table->absoluteDeadline(ha) != table->absoluteDeadline(hb)) {
+                return table->absoluteDeadline(ha) < table->absoluteDeadline(hb);
+            }
+            break;
+        case ReadyQueueOrder::PERIOD:
+            if (periodKey(ha) != periodKey(hb)) {
+                return periodKey(ha) < periodKey(hb);
+            }
+            break;
+    }
+
+    if (table->arrivalTime(ha) != table->arrivalTime(hb)) {
+        return table->arrivalTime(ha) < table->arrivalTime(hb);
+    }
+    return table->pid(ha) < table->pid(hb);
+}
+
+/**
+ * Outranks Implementation
+ */
+bool ProcessOrdering::outranks(ProcessHandle a, ProcessHandle b) const {
+    switch (order) {
+        case ReadyQueueOrder::FIFO:
+            return false;
+        case ReadyQueueOrder::BURST_TIME:
+            return table->burstTime(a) < table->burstTime(b);
+        case ReadyQueueOrder::PRIORITY:
+            return table->priority(a) < table->priority(b);
+        case ReadyQueueOrder::REMAINING_TIME:
+            return table->remainingTime[a] < table->remainingTime[b];
+        case ReadyQueueOrder::DEADLINE:
+            return table->absoluteDeadline(a) < table->absoluteDeadline(b);
+        case ReadyQueueOrder::PERIOD:
+            return periodKey(a) < periodKey(b);
+    }
+    return false;
+}
+
+/**
+ * Get Ordering Key Implementation
+ */
+ReadyQueueOrder ProcessOrdering::getOrder() const {
+    return order;
+}
+
+/**
+ * Get Process Table Implementation
+ */
+const ProcessTable& ProcessOrdering::getTable() const {
+    return *table;
+}
+
+// ========================================================================================
+// ABSTRACT READY QUEUE IMPLEMENTATION
+// ========================================================================================
+
+ReadyQueue::ReadyQueue(ReadyQueueOrder order, const ProcessTable& table)
+    : ordering(order, table), nextSequence(0) {}
+
+bool ReadyQueue::empty() const {
+    return size() == 0;
+}
+
+bool ReadyQueue::outranks(ProcessHandle a, ProcessHandle b) const {
+    return ordering.outranks(a, b);
+}
+
+ReadyQueueOrder ReadyQueue::getOrder() const {
+    return ordering.getOrder();
+}
+
+// ========================================================================================
+// FIFO READY QUEUE IMPLEMENTATION
+// ========================================================================================
+
+FifoReadyQueue::FifoReadyQueue(const ProcessTable& table) : ReadyQueue(ReadyQueueOrder::FIFO, table) {}
+
+void FifoReadyQueue::push(ProcessHandle handle) {
+    entries.push_back(handle);
+}
+
+ProcessHandle FifoReadyQueue::top() const {
+    return entries.empty() ? INVALID_PROCESS : entries.front();
+}
+
+ProcessHandle FifoReadyQueue::pop() {
+    if (entries.empty()) {
+        return INVALID_PROCESS;
+    }
+
+    ProcessHandle handle = entries.front();
+    entries.pop_front();
+    return handle;
+}
+
+size_t FifoReadyQueue::size() const {
+    return entries.size();
+}
+
+void FifoReadyQueue::clear() {
+    entries.clear();
+}
+
+void FifoReadyQueue::collect(vector<ProcessHandle>& out) const {
+    for (size_t i = 0; i < entries.size(); ++i) {
+        out.push_back(entries[i]);
+    }
+}
+
+// ========================================================================================
+// BINARY HEAP READY QUEUE IMPLEMENTATION
+// ========================================================================================
+
+BinaryHeapReadyQueue::BinaryHeapReadyQueue(ReadyQueueOrder order, const ProcessTable& table)
+    : ReadyQueue(order, table) {}
+
+/**
+ * Sift Up Implementation
+ * Moves an entry towards the root until the heap property holds
+ */
+void BinaryHeapReadyQueue::siftUp(size_t index) {
+    ReadyQueueEntry entry = heap[index];
+
+    while (index > 0) {
+        size_t parent = (index - 1) / 2;
+        if (!ordering(entry, heap[parent])) break;
+        heap[index] = heap[parent];
+        index = parent;
+    }
+
+    heap[index] = entry;
+}
+
+/**
+ * Sift Down Implementation
+ * Moves an entry towards the leaves until the heap property holds
+ */
+void BinaryHeapReadyQueue::siftDown(size_t index) {
+    size_t n = heap.size();
+    ReadyQueueEntry entry = heap[index];
+
+    while (true) {
+        size_t best = 2 * index + 1;
+        if (best >= n) break;
+        if (best + 1 < n && ordering(heap[best + 1], heap[best])) best++;
+        if (!ordering(heap[best], entry)) break;
+        heap[index] = heap[best];
+        index = best;
+    }
+
+    heap[index] = entry;
+}
+
+void BinaryHeapReadyQueue::push(ProcessHandle handle) {
+    heap.push_back({handle, nextSequence++});
+    siftUp(heap.size() - 1);
+}
+
+ProcessHandle BinaryHeapReadyQueue::top() const {
+    return heap.empty() ? INVALID_PROCESS : heap.front().handle;
+}
+
+ProcessHandle BinaryHeapReadyQueue::pop() {
+    if (heap.empty()) {
+        return INVALID_PROCESS;
+    }
+
+    ProcessHandle handle = heap.front().handle;
+    heap.front() = heap.back();
+    heap.pop_back();
+    if (!heap.empty()) {
+        siftDown(0);
+    }
+    return handle;
+}
+
+size_t BinaryHeapReadyQueue::size() const {
+    return heap.size();
+}
+
+void BinaryHeapReadyQueue::clear() {
+    heap.clear();
+}
+
+/**
+ * Collect Implementation
+ * The ordering is total, so sorting a copy of the heap gives the pop order
+ */
+void BinaryHeapReadyQueue::collect(vector<ProcessHandle>& out) const {
+    vector<ReadyQueueEntry> sorted(heap);
+    sort(sorted.begin(), sorted.end(), ordering);
+    for (const ReadyQueueEntry& entry : sorted) {
+        out.push_back(entry.handle);
+    }
+}
+
+// ========================================================================================
+// PAIRING HEAP READY QUEUE IMPLEMENTATION
+// ========================================================================================
+
+PairingHeapReadyQueue::PairingHeapReadyQueue(ReadyQueueOrder order, const ProcessTable& table)
+    : ReadyQueue(order, table), root(-1), count(0) {}
+
+/**
+ * Meld Implementation
+ * Links two heap roots, making the worse one the first child of the better one
+ */
+int PairingHeapReadyQueue::meld(int a, int b) {
+    if (a < 0) return b;
+    if (b < 0) return a;
+
+    if (ordering(nodes[b].entry, nodes[a].entry)) {
+        swap(a, b);
+    }
+
+    nodes[b].sibling = nodes[a].child;
+    nodes[a].child = b;
+    return a;
+}
+
+/**
+ * Merge Pairs Implementation
+ * Standard two-pass merge: meld siblings pairwise left to right,
+ * then meld the results right to left
+ */
+int PairingHeapReadyQueue::mergePairs(int firstSibling) {
+    mergeBuffer.clear();
+
+    int current = firstSibling;
+    while (current >= 0) {
+        int first = current;
+        int second = nodes[first].sibling;
+        int next = (second >= 0) ? nodes[second].sibling : -1;
+
+        nodes[first].sibling = -1;
+        if (second >= 0) {
+            nodes[second].sibling = -1;
+        }
+
+        mergeBuffer.push_back(meld(first, second));
+        current = next;
+    }
+
+    int result = -1;
+    for (auto it = mergeBuffer.rbegin(); it != mergeBuffer.rend(); ++it) {
+        result = meld(*it, result);
+    }
+    return result;
+}
+
+void PairingHeapReadyQueue::push(ProcessHandle handle) {
+    int index;
+    if (!freeNodes.empty()) {
+        index = freeNodes.back();
+        freeNodes.pop_back();
+        nodes[index] = {{handle, nextSequence++}, -1, -1};
+    } else {
+        index = static_cast<int>(nodes.size());
+        nodes.push_back({{handle, nextSequence++}, -1, -1});
+    }
+
+    root = meld(root, index);
+    count++;
+}
+
+ProcessHandle PairingHeapReadyQueue::top() const {
+    return root < 0 ? INVALID_PROCESS : nodes[root].entry.handle;
+}
+
+ProcessHandle PairingHeapReadyQueue::pop() {
+    if (root < 0) {
+        return INVALID_PROCESS;
+    }
+
+    int oldRoot = root;
+    ProcessHandle handle = nodes[oldRoot].entry.handle;
+    root = mergePairs(nodes[oldRoot].child);
+    freeNodes.push_back(oldRoot);
+    count--;
+    return handle;
+}
+
+size_t PairingHeapReadyQueue::size() const {
+    return count;
+}
+
+void PairingHeapReadyQueue::clear() {
+    nodes.clear();
+    freeNodes.clear();
+    root = -1;
+    count = 0;
+}
+
+/**
+ * Collect Implementation
+ * Walks the tree from the root, then sorts the entries into pop order
+ */
+void PairingHeapReadyQueue::collect(vector<ProcessHandle>& out) const {
+    vector<ReadyQueueEntry> sorted;
+    sorted.reserve(count);
+    vector<int> pending;
+    if (root >= 0) pending.push_back(root);
+    while (!pending.empty()) {
+        int index = pending.back();
+        pending.pop_back();
+        sorted.push_back(nodes[index].entry);
+        for (int child = nodes[index].child; child >= 0; child = nodes[child].sibling) {
+            pending.push_back(child);
+        }
+    }
+    sort(sorted.begin(), sorted.end(), ordering);
+    for (const ReadyQueueEntry& entry : sorted) {
+        out.push_back(entry.handle);
+    }
+}
+
+// ========================================================================================
+// LINEAR SCAN READY QUEUE IMPLEMENTATION
+// ========================================================================================
+
+LinearScanReadyQueue::LinearScanReadyQueue(ReadyQueueOrder order, const ProcessTable& table)
+    : ReadyQueue(order, table), best(0), bestKnown(false) {}
+
+/**
+ * Append Keys Implementation
+ * Packs (primary key, arrival, PID) into two words that compare the way
+ * ProcessOrdering does: the 32-bit primary key and the upper half of the
+ * (non-negative) arrival form the high word, the lower half of the arrival
+ * and the PID the low word. Keys of queued processes do not change while
+ * they wait, so they are computed once on push.
+ */
+void LinearScanReadyQueue::appendKeys(const ReadyQueueEntry& entry) {
+    const ProcessTable& processes = ordering.getTable();
+    int64_t primary;
+    switch (ordering.getOrder()) {
+        case ReadyQueueOrder::BURST_TIME:
+            primary = processes.burstTime(entry.handle);
+            break;
+        case ReadyQueueOrder::PRIORITY:
+            primary = static_cast<int64_t>(processes.priority(entry.handle));
+            break;
+        case ReadyQueueOrder::REMAINING_TIME:
+            primary = processes.remainingTime[entry.handle];
+            break;
+        case ReadyQueueOrder::PERIOD:
+            primary = processes.period(entry.handle) > 0 ? processes.period(entry.handle) : INT32_MAX;
+            break;
+        case ReadyQueueOrder::FIFO:
+        default:
+            highKeys.push_back(entry.sequence);
+            lowKeys.push_back(0);
+            return;
+    }
+
+    uint64_t arrival = static_cast<uint64_t>(processes.arrivalTime(entry.handle));
+    uint64_t pid = static_cast<uint32_t>(processes.pid(entry.handle)) ^ 0x80000000u;
+    highKeys.push_back(primary * (int64_t(1) << 32) + static_cast<int64_t>(arrival >> 32));
+    // Flipping the top bit makes the signed comparison order the unsigned words
+    lowKeys.push_back(static_cast<int64_t>(((arrival << 32) | pid) ^ (uint64_t(1) << 63)));
+}
+
+void LinearScanReadyQueue::push(ProcessHandle handle) {
+    ReadyQueueEntry entry = {handle, nextSequence++};
+    appendKeys(entry);
+    entries.push_back(entry);
+    size_t added = entries.size() - 1;
+    if (bestKnown && (highKeys[added] < highKeys[best] ||
+                      (highKeys[added] == highKeys[best] && lowKeys[added] < lowKeys[best]))) {
+        best = added;
+    }
+}
+
+ProcessHandle LinearScanReadyQueue::top() const {
+    if (entries.empty()) {
+        return INVALID_PROCESS;
+    }
+    if (!bestKnown) {
+        best = findMinimum(highKeys.data(), lowKeys.data(), entries.size());
+        bestKnown = true;
+    }
+    return entries[best].handle;
+}
+
+ProcessHandle LinearScanReadyQueue::pop() {
+    ProcessHandle handle = top();
+    if (handle == INVALID_PROCESS) {
+        return INVALID_PROCESS;
+    }
+
+    // Move the last entry into the gap
+    highKeys[best] = highKeys.back();
+    lowKeys[best] = lowKeys.back();
+    entries[best] = entries.back();
+    highKeys.pop_back();
+    lowKeys.pop_back();
+    entries.pop_back();
+    bestKnown = false;
+    return handle;
+}
+
+size_t LinearScanReadyQueue::size() const {
+    return entries.size();
+}
+
+void LinearScanReadyQueue::clear() {
+    highKeys.clear();
+    lowKeys.clear();
+    entries.clear();
+    bestKnown = false;
+}
+
+void LinearScanReadyQueue::collect(vector<ProcessHandle>& out) const {
+    vector<ReadyQueueEntry> sorted(entries);
+    sort(sorted.begin(), sorted.end(), ordering);
+    for (const ReadyQueueEntry& entry : sorted) {
+        out.push_back(entry.handle);
+    }
+}
+
+// ========================================================================================
+// FACTORY IMPLEMENTATION
+// ========================================================================================
+
+/**
+ * Create Ready Queue Implementation
+ * A FIFO container cannot honour a keyed ordering, so keyed orderings
+ * requested with the FIFO kind fall back to a binary heap
+ */
+unique_ptr<ReadyQueue> createReadyQueue(ReadyQueueKind kind, ReadyQueueOrder order,
+                                        const ProcessTable& table) {
+    switch (kind) {
+        case ReadyQueueKind::PAIRING_HEAP:
+            return make_unique<PairingHeapReadyQueue>(order, table);
+        case ReadyQueueKind::BINARY_HEAP:
+            return make_unique<BinaryHeapReadyQueue>(order, table);
+        case ReadyQueueKind::LINEAR_SCAN:
+            if (order == ReadyQueueOrder::DEADLINE) {
+                return make_unique<BinaryHeapReadyQueue>(order, table);
+            }
+            return make_unique<LinearScanReadyQueue>(order, table);
+        case ReadyQueueKind::FIFO:
+        default:
+            if (order == ReadyQueueOrder::FIFO) {
+                return make_unique<FifoReadyQueue>(table);
+            }
+            return make_unique<BinaryHeapReadyQueue>(order, table);
+    }
+}
+
+/**
+ * Get Ready Queue Kind Name Implementation
+ */
+string readyQueueKindToString(ReadyQueueKind kind) {
+    switch (kind) {
+        case ReadyQueueKind::FIFO:
+            return "FIFO";
+        case ReadyQueueKind::BINARY_HEAP:
+            return "Binary Heap";
+        case ReadyQueueKind::PAIRING_HEAP:
+            return "Pairing Heap";
+        case ReadyQueueKind::LINEAR_SCAN:
+            return "Linear Scan";
+        default:
+            return "UNKNOWN";
+    }
+}
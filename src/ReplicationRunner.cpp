@@ -0,0 +1,487 @@
+/**
+ * ReplicationRunner.cpp - Monte Carlo Replication Runner Implementation File
+ *
+ * This source file contains the confidence interval arithmetic and the
+ * parallel replication runner with its deterministic stopping rule.
+ *
+ */
+
+#include "ReplicationRunner.h"
+
+#include <atomic>       // For the replication limit
+#include <cmath>        // For sqrt, atan and the interval arithmetic
+#include <iomanip>      // For formatted output
+#include <iostream>     // For output operations
+#include <limits>       // For infinite half-widths
+#include <mutex>        // For the scheduler pool and the fold
+
+// ========================================================================================
+// REPORTED METRICS
+// ========================================================================================
+
+namespace {
+
+/**
+ * Replicated Metric
+ * One row of the report: how to read the metric from a replication
+ */
+struct ReplicatedMetric {
+    const char* name;                               // Row label
+    double (*read)(const ComparisonResult&);        // Value of one replication
+    int precision;                                  // Decimals shown
+    bool stopping;                                  // Checked against the target width
+    bool optional;                                  // Hidden when it is 0 in every replication
+};
+
+template <SchedulingMetric Metric, int Percentile>
+double readPercentile(const ComparisonResult& result) {
+    return static_cast<double>(result.statistics.get(Metric).getPercentile(Percentile / 10.0));
+}
+
+const ReplicatedMetric METRICS[] = {
+    {"Avg waiting", [](const ComparisonResult& r) { return r.averageWaitingTime; }, 2, true, false},
+    {"Avg turnaround", [](const ComparisonResult& r) { return r.averageTurnaroundTime; }, 2, true, false},
+    {"Avg response", [](const ComparisonResult& r) { return r.averageResponseTime; }, 2, true, false},
+    {"Makespan", [](const ComparisonResult& r) { return static_cast<double>(r.totalExecutionTime); }, 2, false, false},
+    {"Context switches", [](const ComparisonResult& r) { return static_cast<double>(r.contextSwitches); }, 2, false, false},
+    {"Throughput", [](const ComparisonResult& r) { return r.throughput; }, 4, false, false},
+    {"Utilisation", [](const ComparisonResult& r) { return r.utilisation; }, 4, false, false},
+    {"Migrations", [](const ComparisonResult& r) { return static_cast<double>(r.migrations); }, 2, false, true},
+    {"Overhead", [](const ComparisonResult& r) { return static_cast<double>(r.overheadTime); }, 2, false, true},
+    {"Waiting p50", readPercentile<SchedulingMetric::WAITING_TIME, 500>, 2, false, false},
+    {"Waiting p90", readPercentile<SchedulingMetric::WAITING_TIME, 900>, 2, false, false},
+    {"Waiting p99", readPercentile<SchedulingMetric::WAITING_TIME, 990>, 2, false, false},
+    {"Waiting p99.9", readPercentile<SchedulingMetric::WAITING_TIME, 999>, 2, false, false},
+    {"Turnaround p50", readPercentile<SchedulingMetric::TURNAROUND_TIME, 500>, 2, false, false},
+    {"Turnaround p90", readPercentile<SchedulingMetric::TURNAROUND_TIME, 900>, 2, false, false},
+    {"Turnaround p99", readPercentile<SchedulingMetric::TURNAROUND_TIME, 990>, 2, false, false},
+    {"Turnaround p99.9", readPercentile<SchedulingMetric::TURNAROUND_TIME, 999>, 2, false, false},
+    {"Response p50", readPercentile<SchedulingMetric::RESPONSE_TIME, 500>, 2, false, false},
+    {"Response p90", readPercentile<SchedulingMetric::RESPONSE_TIME, 900>, 2, false, false},
+    {"Response p99", readPercentile<SchedulingMetric::RESPONSE_TIME, 990>, 2, false, false},
+    {"Response p99.9", readPercentile<SchedulingMetric::RESPONSE_TIME, 999>, 2, false, false},
+};
+
+const size_t METRIC_COUNT = sizeof(METRICS) / sizeof(METRICS[0]);
+
+/**
+ * Compute Interval
+ * Mean, sample standard deviation and t-based half-width of the samples
+ */
+ConfidenceInterval computeInterval(const char* name, const vector<double>& values, double confidence) {
+    ConfidenceInterval interval;
+    interval.metric = name;
+    size_t n = values.size();
+    if (n == 0) {
+        return interval;
+    }
+
+    double sum = 0.0;
+    for (double value : values) sum += value;
+    interval.mean = sum / static_cast<double>(n);
+    if (n < 2) {
+        interval.halfWidth = numeric_limits<double>::infinity();
+        return interval;
+    }
+
+    double squares = 0.0;
+    for (double value : values) squares += (value - interval.mean) * (value - interval.mean);
+    interval.standardDeviation = sqrt(squares / static_cast<double>(n - 1));
+    interval.halfWidth = studentTQuantile(confidence, n - 1) * interval.standardDeviation / sqrt(static_cast<double>(n));
+    return interval;
+}
+
+/**
+ * Student t Central Probability
+ * P(|T| <= t) for integer degrees of freedom, from the closed-form series
+ * (Abramowitz & Stegun 26.7.3 and 26.7.4)
+ */
+double studentTCentral(double t, size_t degreesOfFreedom) {
+    const double pi = 3.14159265358979323846;
+    double theta = atan(t / sqrt(static_cast<double>(degreesOfFreedom)));
+    double c2 = cos(theta) * cos(theta);
+    double s = sin(theta);
+
+    double term = 1.0;
+    double series = 1.0;
+    if (degreesOfFreedom % 2 == 0) {
+        for (size_t k = 2; k + 2 <= degreesOfFreedom; k += 2) {
+            term *= c2 * static_cast<double>(k - 1) / static_cast<double>(k);
+            series += term;
+        }
+        return s * series;
+    }
+    if (degreesOfFreedom == 1) {
+        return 2.0 * theta / pi;
+    }
+    double c = cos(theta);
+    for (size_t k = 3; k + 2 <= degreesOfFreedom; k += 2) {
+        term *= c2 * static_cast<double>(k - 1) / static_cast<double>(k);
+        series += term;
+    }
+    return 2.0 / pi * (theta + s * c * series);
+}
+
+/**
+ * Split Mix
+ * One step of the SplitMix64 generator, used to derive replication seeds
+ */
+uint64_t splitMix(uint64_t value) {
+    value += 0x9E3779B97F4A7C15ull;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31);
+}
+
+} // namespace
+
+// ========================================================================================
+// CONFIDENCE INTERVALS IMPLEMENTATION
+// ========================================================================================
+
+/**
+ * Get Relative Half-Width Implementation
+ */
+double ConfidenceInterval::getRelativeHalfWidth() const {
+    if (halfWidth == 0.0) {
+        return 0.0;
+    }
+    return mean != 0.0 ? halfWidth / fabs(mean) : numeric_limits<double>::infinity();
+}
+
+/**
+ * Student t Quantile Implementation
+ * Bisection on the central probability, which grows with t
+ */
+double studentTQuantile(double confidence, size_t degreesOfFreedom) {
+    if (degreesOfFreedom == 0 || confidence <= 0.0) {
+        return degreesOfFreedom == 0 ? numeric_limits<double>::infinity() : 0.0;
+    }
+    if (confidence >= 1.0) {
+        return numeric_limits<double>::infinity();
+    }
+
+    double low = 0.0;
+    double high = 1.0;
+    while (studentTCentral(high, degreesOfFreedom) < confidence) {
+        low = high;
+        high *= 2.0;
+    }
+    for (int iteration = 0; iteration < 100 && high - low > 1e-12 * high; ++iteration) {
+        double middle = 0.5 * (low + high);
+        if (studentTCentral(middle, degreesOfFreedom) < confidence) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+    return 0.5 * (low + high);
+}
+
+// ========================================================================================
+// CONSTRUCTOR AND CONFIGURATION
+// ========================================================================================
+
+/**
+ * Replication Runner Constructor Implementation
+ */
+ReplicationRunner::ReplicationRunner(function<unique_ptr<Scheduler>()> factory,
+                                     const WorkloadGeneratorOptions& workloadShape, size_t threads)
+    : createScheduler(std::move(factory)),
+      shape(workloadShape),
+      minReplications(DEFAULT_MIN_REPLICATIONS),
+      maxReplications(30),
+      targetWidth(0.0),
+      confidence(0.95),
+      threadCount(threads),
+      processCount(0),
+      converged(false),
+      failed(false) {}
+
+/**
+ * Set Replications Implementation
+ */
+void ReplicationRunner::setReplications(size_t minimum, size_t maximum) {
+    if (maximum == 0) {
+        cerr << "Warning: At least one replication is needed. Using 1." << endl;
+        maximum = 1;
+    }
+    if (minimum < 2) {
+        minimum = 2;
+    }
+    minReplications = minimum;
+    maxReplications = maximum;
+}
+
+/**
+ * Set Target Width Implementation
+ */
+void ReplicationRunner::setTargetWidth(double relativeHalfWidth) {
+    if (relativeHalfWidth < 0.0) {
+        cerr << "Warning: Ignoring negative target width " << relativeHalfWidth << endl;
+        return;
+    }
+    targetWidth = relativeHalfWidth;
+}
+
+/**
+ * Set Confidence Implementation
+ */
+void ReplicationRunner::setConfidence(double level) {
+    if (level <= 0.0 || level >= 1.0) {
+        cerr << "Warning: Confidence level must be between 0 and 1. Using 0.95." << endl;
+        level = 0.95;
+    }
+    confidence = level;
+}
+
+/**
+ * Set Label Implementation
+ */
+void ReplicationRunner::setLabel(const string& name) {
+    label = name;
+}
+
+/**
+ * Get Replication Seed Implementation
+ */
+uint64_t ReplicationRunner::getReplicationSeed(uint64_t seed, size_t index) {
+    return index == 0 ? seed : splitMix(seed ^ splitMix(static_cast<uint64_t>(index)));
+}
+
+// ========================================================================================
+// EXECUTION
+// ========================================================================================
+
+/**
+ * Fold Replication Implementation
+ */
+void ReplicationRunner::fold(const ComparisonResult& result) {
+    if (!result.success) {
+        failed = true;
+        return;
+    }
+    for (size_t metric = 0; metric < METRIC_COUNT; ++metric) {
+        samples[metric].push_back(METRICS[metric].read(result));
+    }
+    pooled.merge(result.statistics);
+    processCount += result.processCount;
+}
+
+/**
+ * Is Precise Implementation
+ */
+bool ReplicationRunner::isPrecise() const {
+    for (size_t metric = 0; metric < METRIC_COUNT; ++metric) {
+        if (!METRICS[metric].stopping) continue;
+        ConfidenceInterval interval = computeInterval(METRICS[metric].name, samples[metric], confidence);
+        if (samples[metric].size() < 2 || interval.getRelativeHalfWidth() > targetWidth) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Run Replications Implementation
+ *
+ * Algorithm flow:
+ * 1. Workers claim replication indices from the pool's shared counter; an
+ *    index at or past the current limit is skipped without running.
+ * 2. A replication takes an idle scheduler from the pool (creating one only
+ *    if all are busy), streams its own seeded workload and stores its result.
+ * 3. Under the lock, finished replications are folded in index order; once
+ *    the folded prefix is precise enough, the limit drops to its length.
+ */
+bool ReplicationRunner::run() {
+    samples.assign(METRIC_COUNT, vector<double>());
+    pooled.clear();
+    processCount = 0;
+    converged = false;
+    failed = false;
+
+    vector<ComparisonResult> results(maxReplications);
+    vector<bool> done(maxReplications, false);
+    size_t folded = 0;
+    atomic<size_t> limit(maxReplications);
+
+    vector<unique_ptr<Scheduler>> idle;
+    mutex poolMutex;
+    auto acquire = [&]() {
+        {
+            lock_guard<mutex> lock(poolMutex);
+            if (!idle.empty()) {
+                unique_ptr<Scheduler> scheduler = std::move(idle.back());
+                idle.pop_back();
+                return scheduler;
+            }
+        }
+        unique_ptr<Scheduler> scheduler = createScheduler();
+        scheduler->setVerbosity(Verbosity::QUIET);
+        scheduler->setWorkload(make_shared<Workload>());
+        lock_guard<mutex> lock(poolMutex);
+        if (label.empty()) {
+            label = scheduler->getAlgorithmName();
+        }
+        return scheduler;
+    };
+
+    runParallel(maxReplications, threadCount, [&](size_t index) {
+        if (index >= limit.load(memory_order_relaxed)) {
+            return;
+        }
+
+        unique_ptr<Scheduler> pooledScheduler = acquire();
+        Scheduler& scheduler = *pooledScheduler;
+        WorkloadGeneratorOptions replicaShape = shape;
+        replicaShape.seed = getReplicationSeed(shape.seed, index);
+        scheduler.setArrivalSource(make_unique<WorkloadGenerator>(replicaShape), false);
+
+        ComparisonResult result;
+        try {
+            result.success = scheduler.schedule();
+        } catch (const exception& e) {
+            cerr << "Error: Replication " << index << " failed: " << e.what() << endl;
+            result.success = false;
+        }
+        if (result.success) {
+            collectResult(scheduler, result);
+        }
+
+        lock_guard<mutex> lock(poolMutex);
+        idle.push_back(std::move(pooledScheduler));
+        results[index] = std::move(result);
+        done[index] = true;
+        while (folded < limit.load(memory_order_relaxed) && done[folded]) {
+            fold(results[folded]);
+            results[folded] = ComparisonResult();
+            folded++;
+            if (targetWidth > 0.0 && folded >= minReplications && isPrecise()) {
+                converged = true;
+                limit.store(folded, memory_order_relaxed);
+            }
+        }
+    });
+
+    return !failed && folded > 0;
+}
+
+/**
+ * Get Replication Count Implementation
+ */
+size_t ReplicationRunner::getReplicationCount() const {
+    return samples.empty() ? 0 : samples[0].size();
+}
+
+/**
+ * Has Converged Implementation
+ */
+bool ReplicationRunner::hasConverged() const {
+    return converged;
+}
+
+/**
+ * Get Intervals Implementation
+ */
+vector<ConfidenceInterval> ReplicationRunner::getIntervals() const {
+    vector<ConfidenceInterval> intervals;
+    for (size_t metric = 0; metric < METRIC_COUNT && metric < samples.size(); ++metric) {
+        intervals.push_back(computeInterval(METRICS[metric].name, samples[metric], confidence));
+    }
+    return intervals;
+}
+
+/**
+ * Get Pooled Statistics Implementation
+ */
+const RunStatistics& ReplicationRunner::getPooledStatistics() const {
+    return pooled;
+}
+
+// ========================================================================================
+// REPORTING
+// ========================================================================================
+
+/**
+ * Print Replication Results Implementation
+ */
+void ReplicationRunner::printResults() const {
+    size_t count = getReplicationCount();
+    cout << "\n=== " << label << ": " << count << " replications, "
+         << fixed << setprecision(0) << confidence * 100.0 << "% confidence intervals ===" << endl;
+    if (targetWidth > 0.0) {
+        cout << (converged ? "Reached" : "Did not reach") << " the target half-width of "
+             << setprecision(2) << targetWidth * 100.0 << "% of the mean";
+        cout << (converged ? "" : " within the replication limit") << endl;
+    }
+
+    cout << left << setw(20) << "Metric" << right
+         << setw(14) << "Mean" << setw(14) << "+/-"
+         << setw(14) << "Low" << setw(14) << "High" << setw(10) << "+/- %" << endl;
+    cout << string(86, '-') << endl;
+
+    vector<ConfidenceInterval> intervals = getIntervals();
+    for (size_t metric = 0; metric < intervals.size(); ++metric) {
+        const ConfidenceInterval& interval = intervals[metric];
+        if (METRICS[metric].optional && interval.mean == 0.0 && interval.standardDeviation == 0.0) {
+            continue;
+        }
+        cout << left << setw(20) << interval.metric << right << fixed << setprecision(METRICS[metric].precision)
+             << setw(14) << interval.mean;
+        if (isfinite(interval.halfWidth)) {
+            cout << setw(14) << interval.halfWidth << setw(14) << interval.getLow()
+                 << setw(14) << interval.getHigh();
+        } else {
+            cout << setw(14) << "-" << setw(14) << "-" << setw(14) << "-";
+        }
+        double relative = interval.getRelativeHalfWidth();
+        if (isfinite(relative)) {
+            cout << setw(10) << setprecision(2) << relative * 100.0;
+        } else {
+            cout << setw(10) << "-";
+        }
+        cout << endl;
+    }
+    cout << string(86, '-') << endl;
+
+    // Distribution of every process of every replication, from the merged sketches
+    cout << "Pooled over " << count << " replications (" << processCount << " processes):" << endl;
+    cout << left << setw(12) << "Metric" << right
+         << setw(12) << "Count" << setw(10) << "Mean"
+         << setw(8) << "p50" << setw(8) << "p90" << setw(8) << "p99"
+         << setw(8) << "p99.9" << setw(8) << "Max" << endl;
+    for (SchedulingMetric metric : {SchedulingMetric::WAITING_TIME, SchedulingMetric::TURNAROUND_TIME,
+                                    SchedulingMetric::RESPONSE_TIME}) {
+        LogHistogram histogram = pooled.get(metric);
+        cout << left << setw(12) << schedulingMetricToString(metric) << right
+             << setw(12) << histogram.getCount()
+             << setw(10) << fixed << setprecision(2) << histogram.getMean()
+             << setw(8) << histogram.getPercentile(50)
+             << setw(8) << histogram.getPercentile(90)
+             << setw(8) << histogram.getPercentile(99)
+             << setw(8) << histogram.getPercentile(99.9)
+             << setw(8) << histogram.getMax() << endl;
+    }
+}
+
+/**
+ * Print Replication CSV Implementation
+ */
+void ReplicationRunner::printCsv(bool header) const {
+    if (header) {
+        cout << "algorithm,metric,replications,mean,half_width,low,high,std_dev,confidence,converged\n";
+    }
+    size_t count = getReplicationCount();
+    for (const ConfidenceInterval& interval : getIntervals()) {
+        cout << quoteCsvField(label) << ',' << interval.metric << ',' << count << ','
+             << fixed << setprecision(6) << interval.mean << ',';
+        if (isfinite(interval.halfWidth)) {
+            cout << interval.halfWidth << ',' << interval.getLow() << ',' << interval.getHigh() << ',';
+        } else {
+            cout << ",,,";
+        }
+        cout << interval.standardDeviation << ',' << setprecision(4) << confidence << ','
+             << (converged ? 1 : 0) << '\n';
+    }
+    cout.flush();
+}
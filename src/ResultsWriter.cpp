@@ -0,0 +1,491 @@
+/**
+ * ResultsWriter.cpp - Per-Process Results Export Implementation File
+ *
+ * This source file contains the background results writer, the CSV and
+ * columnar encodings and the columnar reader.
+ *
+ */
+
+#include "ResultsWriter.h"
+
+#include <charconv>     // For locale-free integer formatting
+#include <cstring>      // For memcmp / memcpy
+#include <initializer_list> // For the CSV row fields
+#include <iostream>     // For error output
+
+#include "Instrumentation.h" // Include hot-path profiling counters
+
+// ========================================================================================
+// FILE FORMAT
+// ========================================================================================
+
+namespace {
+
+const char RESULTS_MAGIC[8] = {'O', 'S', 'S', 'R', 'S', 'L', 'T', 'S'};
+const uint32_t RESULTS_VERSION = 1;
+const uint32_t FLAG_DELTA = 1;          // Columns are zigzag varint deltas
+
+const size_t COLUMN_COUNT = 7;
+const char* const COLUMN_NAMES[COLUMN_COUNT] = {
+    "pid", "arrival", "start", "completion", "waiting", "turnaround", "response"
+};
+
+/**
+ * Results File Header
+ * Followed by the column names
+ */
+struct ResultsHeader {
+    char magic[8];              // RESULTS_MAGIC
+    uint32_t version;           // RESULTS_VERSION
+    uint32_t flags;             // FLAG_DELTA or 0
+    uint32_t columnCount;       // COLUMN_COUNT
+};
+
+/**
+ * Get Column Value
+ *
+ * @param row - Result row
+ * @param column - Column index in COLUMN_NAMES order
+ * @return The column's value, widened
+ */
+inline int64_t columnValue(const ProcessResult& row, size_t column) {
+    switch (column) {
+        case 0: return row.pid;
+        case 1: return row.arrival;
+        case 2: return row.start;
+        case 3: return row.completion;
+        case 4: return row.waiting;
+        case 5: return row.turnaround;
+        default: return row.response;
+    }
+}
+
+/**
+ * Set Column Value
+ *
+ * @param row - Result row
+ * @param column - Column index in COLUMN_NAMES order
+ * @param value - Value to store
+ */
+inline void setColumnValue(ProcessResult& row, size_t column, int64_t value) {
+    switch (column) {
+        case 0: row.pid = static_cast<int32_t>(value); break;
+        case 1: row.arrival = value; break;
+        case 2: row.start = value; break;
+        case 3: row.completion = value; break;
+        case 4: row.waiting = value; break;
+        case 5: row.turnaround = value; break;
+        default: row.response = value; break;
+    }
+}
+
+/**
+ * Append Raw Value
+ */
+template <class T>
+inline void appendRaw(string& buffer, T value) {
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+/**
+ * Append Zigzag Varint
+ * Small magnitudes of either sign take few bytes
+ */
+inline void appendVarint(string& buffer, int64_t value) {
+    uint64_t bits = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    while (bits >= 0x80) {
+        buffer.push_back(static_cast<char>((bits & 0x7f) | 0x80));
+        bits >>= 7;
+    }
+    buffer.push_back(static_cast<char>(bits));
+}
+
+/**
+ * Read Zigzag Varint
+ *
+ * @param cursor - Read position, advanced past the value
+ * @param end - End of the column data
+ * @param value - Receives the value
+ * @return False if the data ends inside the value
+ */
+inline bool readVarint(const char*& cursor, const char* end, int64_t& value) {
+    uint64_t bits = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        if (cursor == end) return false;
+        uint8_t byte = static_cast<uint8_t>(*cursor++);
+        bits |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if (byte < 0x80) {
+            value = static_cast<int64_t>(bits >> 1) ^ -static_cast<int64_t>(bits & 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Append CSV Row
+ */
+inline void appendCsvRow(string& buffer, const ProcessResult& row) {
+    char text[8 * 24];
+    char* const end = text + sizeof(text);
+    char* cursor = to_chars(text, end, row.pid).ptr;
+    for (int64_t value : {row.arrival, row.start, row.completion, row.waiting, row.turnaround, row.response}) {
+        *cursor++ = ',';
+        cursor = to_chars(cursor, end, value).ptr;
+    }
+    *cursor++ = '\n';
+    buffer.append(text, static_cast<size_t>(cursor - text));
+}
+
+} // namespace
+
+/**
+ * Get Results Format Name Implementation
+ */
+string resultsFormatToString(ResultsFormat format) {
+    switch (format) {
+        case ResultsFormat::CSV:
+            return "csv";
+        case ResultsFormat::COLUMNAR:
+            return "columnar";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+// ========================================================================================
+// RESULTS WRITER
+// ========================================================================================
+
+/**
+ * Results Writer Constructor Implementation
+ * The whole chunk pool is allocated up front
+ */
+ResultsWriter::ResultsWriter(size_t chunkRows)
+    : used(0), submitted(0), stopping(false), failed(false), format(ResultsFormat::CSV),
+      compressed(false), capacity(chunkRows > 0 ? chunkRows : 1)
+{
+    filling = make_unique<Chunk>();
+    filling->rows.resize(capacity);
+    for (size_t i = 1; i < POOL_SIZE; ++i) {
+        spare.push_back(make_unique<Chunk>());
+        spare.back()->rows.resize(capacity);
+    }
+}
+
+/**
+ * Destructor Implementation
+ */
+ResultsWriter::~ResultsWriter() {
+    close();
+}
+
+/**
+ * Get Format From Path Implementation
+ */
+ResultsFormat ResultsWriter::formatFromPath(const string& filePath) {
+    const string extension = ".csv";
+    bool csv = filePath.size() >= extension.size() &&
+               filePath.compare(filePath.size() - extension.size(), extension.size(), extension) == 0;
+    return csv ? ResultsFormat::CSV : ResultsFormat::COLUMNAR;
+}
+
+/**
+ * Open Results File Implementation
+ */
+bool ResultsWriter::open(const string& filePath, ResultsFormat fileFormat, bool compress) {
+    close();
+
+    output.open(filePath, ios::binary | ios::trunc);
+    if (!output) {
+        cerr << "Error: Cannot create results file " << filePath << endl;
+        return false;
+    }
+    path = filePath;
+    format = fileFormat;
+    compressed = compress && fileFormat == ResultsFormat::COLUMNAR;
+    used = 0;
+    submitted = 0;
+    stopping = false;
+    failed = false;
+
+    if (format == ResultsFormat::CSV) {
+        for (size_t column = 0; column < COLUMN_COUNT; ++column) {
+            output << (column > 0 ? "," : "") << COLUMN_NAMES[column];
+        }
+        output << '\n';
+    } else {
+        ResultsHeader header;
+        memcpy(header.magic, RESULTS_MAGIC, sizeof(RESULTS_MAGIC));
+        header.version = RESULTS_VERSION;
+        header.flags = compressed ? FLAG_DELTA : 0;
+        header.columnCount = COLUMN_COUNT;
+        output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        for (const char* name : COLUMN_NAMES) {
+            uint8_t length = static_cast<uint8_t>(strlen(name));
+            output.put(static_cast<char>(length));
+            output.write(name, length);
+        }
+    }
+
+    writer = thread(&ResultsWriter::writeChunks, this);
+    return true;
+}
+
+/**
+ * Close Results File Implementation
+ */
+bool ResultsWriter::close() {
+    if (!writer.joinable()) {
+        return !failed;
+    }
+
+    submitChunk();
+    {
+        lock_guard<mutex> guard(lock);
+        stopping = true;
+    }
+    changed.notify_all();
+    writer.join();
+
+    output.close();
+    if (!output || failed) {
+        cerr << "Error: Failed to write results file " << path << endl;
+        failed = true;
+    }
+    return !failed;
+}
+
+/**
+ * Submit Chunk Implementation
+ * Waits for a spare chunk only when the background thread is a whole pool behind
+ */
+void ResultsWriter::submitChunk() {
+    if (used == 0) return;
+    PROFILE_SCOPE(ProfilePhase::OUTPUT);
+
+    submitted += used;
+    filling->count = used;
+    used = 0;
+    if (!writer.joinable()) {
+        return;
+    }
+
+    unique_lock<mutex> guard(lock);
+    full.push_back(std::move(filling));
+    changed.notify_all();
+    changed.wait(guard, [this]() { return !spare.empty(); });
+    filling = std::move(spare.back());
+    spare.pop_back();
+}
+
+/**
+ * Write Chunks Implementation
+ *
+ * Algorithm flow:
+ * 1. Wait for a full chunk, or for close() once every chunk is written.
+ * 2. Encode and write the chunk without holding the lock, so the simulation
+ *    keeps filling the next chunk meanwhile.
+ * 3. Return the chunk to the spare pool and wake a waiting record().
+ */
+void ResultsWriter::writeChunks() {
+    unique_lock<mutex> guard(lock);
+    while (true) {
+        changed.wait(guard, [this]() { return !full.empty() || stopping; });
+        if (full.empty()) {
+            break;
+        }
+        unique_ptr<Chunk> chunk = std::move(full.front());
+        full.pop_front();
+        guard.unlock();
+
+        encoded.clear();
+        encodeChunk(*chunk);
+        output.write(encoded.data(), static_cast<streamsize>(encoded.size()));
+        bool writeFailed = !output;
+
+        guard.lock();
+        failed = failed || writeFailed;
+        spare.push_back(std::move(chunk));
+        changed.notify_all();
+    }
+}
+
+/**
+ * Encode Chunk Implementation
+ * A columnar chunk becomes one row group; the byte length of each column is
+ * patched in once the column is encoded
+ */
+void ResultsWriter::encodeChunk(const Chunk& chunk) {
+    const size_t count = chunk.count;
+    if (format == ResultsFormat::CSV) {
+        encoded.reserve(count * 48);
+        for (size_t i = 0; i < count; ++i) {
+            appendCsvRow(encoded, chunk.rows[i]);
+        }
+        return;
+    }
+
+    appendRaw(encoded, static_cast<uint32_t>(count));
+    for (size_t column = 0; column < COLUMN_COUNT; ++column) {
+        size_t lengthAt = encoded.size();
+        appendRaw(encoded, uint64_t(0));
+        if (compressed) {
+            int64_t previous = 0;
+            for (size_t i = 0; i < count; ++i) {
+                int64_t value = columnValue(chunk.rows[i], column);
+                appendVarint(encoded, value - previous);
+                previous = value;
+            }
+        } else if (column == 0) {
+            for (size_t i = 0; i < count; ++i) {
+                appendRaw(encoded, chunk.rows[i].pid);
+            }
+        } else {
+            for (size_t i = 0; i < count; ++i) {
+                appendRaw(encoded, columnValue(chunk.rows[i], column));
+            }
+        }
+        uint64_t length = encoded.size() - lengthAt - sizeof(uint64_t);
+        memcpy(&encoded[lengthAt], &length, sizeof(length));
+    }
+}
+
+// ========================================================================================
+// RESULTS READER
+// ========================================================================================
+
+/**
+ * Read Columnar Results Implementation
+ */
+bool ResultsReader::readColumnar(const string& path, vector<ProcessResult>& rows) {
+    rows.clear();
+
+    ifstream input(path, ios::binary | ios::ate);
+    if (!input) {
+        cerr << "Error: Cannot open results file " << path << endl;
+        return false;
+    }
+    streamoff fileSize = input.tellg();
+    string data(static_cast<size_t>(fileSize > 0 ? fileSize : 0), '\0');
+    input.seekg(0);
+    if (!input.read(&data[0], static_cast<streamsize>(data.size()))) {
+        cerr << "Error: Failed to read results file " << path << endl;
+        return false;
+    }
+
+    // Header and schema
+    ResultsHeader header;
+    if (data.size() < sizeof(header)) {
+        cerr << "Error: " << path << " is not a results file" << endl;
+        return false;
+    }
+    memcpy(&header, data.data(), sizeof(header));
+    if (memcmp(header.magic, RESULTS_MAGIC, sizeof(RESULTS_MAGIC)) != 0) {
+        cerr << "Error: " << path << " is not a results file" << endl;
+        return false;
+    }
+    if (header.version != RESULTS_VERSION || header.columnCount != COLUMN_COUNT) {
+        cerr << "Error: Unsupported results file version " << header.version << " in " << path << endl;
+        return false;
+    }
+    const bool delta = (header.flags & FLAG_DELTA) != 0;
+    const char* cursor = data.data() + sizeof(header);
+    const char* end = data.data() + data.size();
+    for (const char* name : COLUMN_NAMES) {
+        size_t length = cursor < end ? static_cast<uint8_t>(*cursor++) : 0;
+        if (length != strlen(name) || static_cast<size_t>(end - cursor) < length ||
+            memcmp(cursor, name, length) != 0) {
+            cerr << "Error: Unexpected columns in results file " << path << endl;
+            return false;
+        }
+        cursor += length;
+    }
+
+    // Row groups
+    while (cursor < end) {
+        uint32_t count;
+        if (static_cast<size_t>(end - cursor) < sizeof(count)) break;
+        memcpy(&count, cursor, sizeof(count));
+        cursor += sizeof(count);
+
+        // The group must fit in what is left before its rows are allocated:
+        // every row takes at least one byte per varint column, or the fixed
+        // record width without delta compression
+        const size_t rowBytes = delta ? COLUMN_COUNT : sizeof(int32_t) + (COLUMN_COUNT - 1) * sizeof(int64_t);
+        const size_t remaining = static_cast<size_t>(end - cursor);
+        if (remaining < COLUMN_COUNT * sizeof(uint64_t) ||
+            count > (remaining - COLUMN_COUNT * sizeof(uint64_t)) / rowBytes) {
+            cerr << "Error: Truncated or corrupt row group in results file " << path << endl;
+            return false;
+        }
+        size_t first = rows.size();
+        rows.resize(first + count);
+
+        for (size_t column = 0; column < COLUMN_COUNT; ++column) {
+            uint64_t length;
+            if (static_cast<size_t>(end - cursor) < sizeof(length)) {
+                cerr << "Error: Truncated results file " << path << endl;
+                return false;
+            }
+            memcpy(&length, cursor, sizeof(length));
+            cursor += sizeof(length);
+            if (static_cast<uint64_t>(end - cursor) < length) {
+                cerr << "Error: Truncated results file " << path << endl;
+                return false;
+            }
+            const char* columnEnd = cursor + length;
+
+            bool valid = true;
+            if (delta) {
+                int64_t value = 0;
+                for (size_t i = first; i < rows.size() && valid; ++i) {
+                    int64_t difference = 0;
+                    valid = readVarint(cursor, columnEnd, difference);
+                    value += difference;
+                    setColumnValue(rows[i], column, value);
+                }
+            } else {
+                size_t width = column == 0 ? sizeof(int32_t) : sizeof(int64_t);
+                valid = length == width * count;
+                for (size_t i = first; i < rows.size() && valid; ++i, cursor += width) {
+                    if (column == 0) {
+                        memcpy(&rows[i].pid, cursor, width);
+                    } else {
+                        int64_t value;
+                        memcpy(&value, cursor, width);
+                        setColumnValue(rows[i], column, value);
+                    }
+                }
+            }
+            if (!valid || cursor != columnEnd) {
+                cerr << "Error: Corrupt column " << COLUMN_NAMES[column] << " in results file " << path << endl;
+                return false;
+            }
+        }
+    }
+    if (cursor != end) {
+        cerr << "Error: Truncated results file " << path << endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Convert to CSV Implementation
+ */
+bool ResultsReader::convertToCsv(const string& inputPath, const string& outputPath) {
+    vector<ProcessResult> rows;
+    if (!readColumnar(inputPath, rows)) {
+        return false;
+    }
+
+    ResultsWriter writer;
+    if (!writer.open(outputPath, ResultsFormat::CSV)) {
+        return false;
+    }
+    for (const ProcessResult& row : rows) {
+        writer.record(row);
+    }
+    return writer.close();
+}
@@ -0,0 +1,403 @@
+/**
+ * RunStatistics.cpp - Streaming Run Statistics Implementation File
+ *
+ * This source file contains the log-linear histogram, the throughput series
+ * and the per-class run statistics.
+ *
+ */
+
+#include "RunStatistics.h"
+
+#include <algorithm>    // For fill, min and max
+#include <cmath>        // For ceil
+#include <cstring>      // For memcpy
+
+// ========================================================================================
+// SCHEDULING METRIC IMPLEMENTATION
+// ========================================================================================
+
+/**
+ * Get Scheduling Metric Name Implementation
+ */
+string schedulingMetricToString(SchedulingMetric metric) {
+    switch (metric) {
+        case SchedulingMetric::WAITING_TIME:
+            return "waiting";
+        case SchedulingMetric::TURNAROUND_TIME:
+            return "turnaround";
+        case SchedulingMetric::RESPONSE_TIME:
+            return "response";
+        case SchedulingMetric::CONTEXT_SWITCHES:
+            return "context switches";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+// ========================================================================================
+// LOG-LINEAR HISTOGRAM IMPLEMENTATION
+// ========================================================================================
+
+namespace {
+
+constexpr int64_t HALF_BUCKETS = LogHistogram::LINEAR_LIMIT / 2;   // Sub-buckets per power of two
+constexpr size_t MAX_BUCKETS = 1 << 13;             // Above the bucket of any 64-bit value
+constexpr size_t MAX_WINDOWS = 1 << 24;             // Sanity limit of a deserialized series
+
+/**
+ * Append Value
+ * Raw bytes in native byte order
+ */
+template <class T>
+void appendValue(string& buffer, T value) {
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+/**
+ * Read Value
+ *
+ * @return False if fewer than sizeof(T) bytes are left
+ */
+template <class T>
+bool readValue(const char*& cursor, const char* end, T& value) {
+    if (static_cast<size_t>(end - cursor) < sizeof(value)) return false;
+    memcpy(&value, cursor, sizeof(value));
+    cursor += sizeof(value);
+    return true;
+}
+
+} // namespace
+
+LogHistogram::LogHistogram() : total(0), sum(0.0), minValue(0), maxValue(0) {}
+
+/**
+ * Bucket Of Implementation
+ * Values from 2^e on keep their top SUB_BUCKET_BITS bits: the leading one
+ * selects the power-of-two group, the rest the sub-bucket inside it
+ */
+size_t LogHistogram::bucketOf(int64_t value) {
+    if (value < LINEAR_LIMIT) {
+        return static_cast<size_t>(value);
+    }
+    int exponent = 63 - __builtin_clzll(static_cast<uint64_t>(value));
+    int64_t mantissa = value >> (exponent - SUB_BUCKET_BITS + 1);
+    return static_cast<size_t>(LINEAR_LIMIT + (exponent - SUB_BUCKET_BITS) * HALF_BUCKETS +
+                               (mantissa - HALF_BUCKETS));
+}
+
+/**
+ * Bucket High Implementation
+ * Largest value that falls into a bucket
+ */
+int64_t LogHistogram::bucketHigh(size_t bucket) {
+    int64_t index = static_cast<int64_t>(bucket);
+    if (index < LINEAR_LIMIT) {
+        return index;
+    }
+    int64_t group = (index - LINEAR_LIMIT) / HALF_BUCKETS;
+    int64_t mantissa = HALF_BUCKETS + (index - LINEAR_LIMIT) % HALF_BUCKETS;
+    int shift = static_cast<int>(group) + 1;
+    return static_cast<int64_t>((static_cast<uint64_t>(mantissa + 1) << shift) - 1);
+}
+
+/**
+ * Merge Implementation
+ */
+void LogHistogram::merge(const LogHistogram& other) {
+    if (other.total == 0) {
+        return;
+    }
+    if (other.counts.size() > counts.size()) {
+        counts.resize(other.counts.size(), 0);
+    }
+    for (size_t bucket = 0; bucket < other.counts.size(); ++bucket) {
+        counts[bucket] += other.counts[bucket];
+    }
+    minValue = total > 0 ? min(minValue, other.minValue) : other.minValue;
+    maxValue = max(maxValue, other.maxValue);
+    total += other.total;
+    sum += other.sum;
+}
+
+/**
+ * Serialize Implementation
+ * Only the non-empty buckets are written, as (bucket, count) pairs
+ */
+void LogHistogram::serialize(string& buffer) const {
+    appendValue(buffer, total);
+    appendValue(buffer, sum);
+    appendValue(buffer, minValue);
+    appendValue(buffer, maxValue);
+    uint32_t used = 0;
+    for (uint64_t count : counts) {
+        used += count > 0 ? 1 : 0;
+    }
+    appendValue(buffer, used);
+    for (size_t bucket = 0; bucket < counts.size(); ++bucket) {
+        if (counts[bucket] == 0) continue;
+        appendValue(buffer, static_cast<uint32_t>(bucket));
+        appendValue(buffer, counts[bucket]);
+    }
+}
+
+/**
+ * Deserialize Implementation
+ */
+bool LogHistogram::deserialize(const char*& cursor, const char* end) {
+    clear();
+    uint32_t used;
+    if (!readValue(cursor, end, total) || !readValue(cursor, end, sum) || !readValue(cursor, end, minValue) ||
+        !readValue(cursor, end, maxValue) || !readValue(cursor, end, used)) {
+        return false;
+    }
+    uint64_t counted = 0;
+    for (uint32_t i = 0; i < used; ++i) {
+        uint32_t bucket;
+        uint64_t count;
+        if (!readValue(cursor, end, bucket) || !readValue(cursor, end, count) || bucket >= MAX_BUCKETS) {
+            return false;
+        }
+        if (bucket >= counts.size()) {
+            counts.resize(bucket + 1, 0);
+        }
+        counts[bucket] += count;
+        counted += count;
+    }
+    return counted == total;
+}
+
+/**
+ * Clear Implementation
+ * Keeps the bucket storage for the next run
+ */
+void LogHistogram::clear() {
+    fill(counts.begin(), counts.end(), 0);
+    total = 0;
+    sum = 0.0;
+    minValue = 0;
+    maxValue = 0;
+}
+
+/**
+ * Get Percentile Implementation
+ * Walks the buckets up to the sample of rank ceil(percentile% of the count)
+ */
+int64_t LogHistogram::getPercentile(double percentile) const {
+    if (total == 0) {
+        return 0;
+    }
+    percentile = min(max(percentile, 0.0), 100.0);
+    uint64_t rank = static_cast<uint64_t>(ceil(percentile / 100.0 * static_cast<double>(total)));
+    rank = max<uint64_t>(rank, 1);
+
+    uint64_t seen = 0;
+    for (size_t bucket = 0; bucket < counts.size(); ++bucket) {
+        seen += counts[bucket];
+        if (seen >= rank) {
+            return min(max(bucketHigh(bucket), minValue), maxValue);
+        }
+    }
+    return maxValue;
+}
+
+// ========================================================================================
+// THROUGHPUT SERIES IMPLEMENTATION
+// ========================================================================================
+
+ThroughputSeries::ThroughputSeries(SimTime windowWidth, size_t limit)
+    : initialWidth(windowWidth > 0 ? windowWidth : 1),
+      width(initialWidth),
+      windowLimit(limit > 1 ? limit : 2) {}
+
+/**
+ * Coarsen Implementation
+ */
+void ThroughputSeries::coarsen() {
+    size_t merged = (windows.size() + 1) / 2;
+    for (size_t window = 0; window < merged; ++window) {
+        uint64_t count = windows[2 * window];
+        if (2 * window + 1 < windows.size()) {
+            count += windows[2 * window + 1];
+        }
+        windows[window] = count;
+    }
+    windows.resize(merged);
+    width *= 2;
+}
+
+/**
+ * Merge Implementation
+ * Both widths are the common initial width times a power of two, so every
+ * window of the finer series lies inside one window of the coarser one
+ */
+void ThroughputSeries::merge(const ThroughputSeries& other) {
+    while (width < other.width) {
+        coarsen();
+    }
+    for (size_t window = 0; window < other.windows.size(); ++window) {
+        if (other.windows[window] == 0) continue;
+        SimTime start = static_cast<SimTime>(window) * other.width;
+        while (static_cast<size_t>(start / width) >= windowLimit) {
+            coarsen();
+        }
+        size_t target = static_cast<size_t>(start / width);
+        if (target >= windows.size()) {
+            windows.resize(target + 1, 0);
+        }
+        windows[target] += other.windows[window];
+    }
+}
+
+/**
+ * Serialize Implementation
+ */
+void ThroughputSeries::serialize(string& buffer) const {
+    appendValue(buffer, initialWidth);
+    appendValue(buffer, width);
+    appendValue(buffer, static_cast<uint64_t>(windowLimit));
+    appendValue(buffer, static_cast<uint64_t>(windows.size()));
+    buffer.append(reinterpret_cast<const char*>(windows.data()), windows.size() * sizeof(uint64_t));
+}
+
+/**
+ * Deserialize Implementation
+ */
+bool ThroughputSeries::deserialize(const char*& cursor, const char* end) {
+    uint64_t limit;
+    uint64_t size;
+    if (!readValue(cursor, end, initialWidth) || !readValue(cursor, end, width) ||
+        !readValue(cursor, end, limit) || !readValue(cursor, end, size)) {
+        return false;
+    }
+    if (initialWidth <= 0 || width < initialWidth || limit < 2 || limit > MAX_WINDOWS || size > limit ||
+        static_cast<uint64_t>(end - cursor) < size * sizeof(uint64_t)) {
+        return false;
+    }
+    windowLimit = static_cast<size_t>(limit);
+    windows.resize(static_cast<size_t>(size));
+    memcpy(windows.data(), cursor, windows.size() * sizeof(uint64_t));
+    cursor += windows.size() * sizeof(uint64_t);
+    return true;
+}
+
+/**
+ * Clear Implementation
+ */
+void ThroughputSeries::clear() {
+    windows.clear();
+    width = initialWidth;
+}
+
+/**
+ * Set Window Width Implementation
+ */
+void ThroughputSeries::setWindowWidth(SimTime windowWidth) {
+    initialWidth = windowWidth > 0 ? windowWidth : 1;
+    clear();
+}
+
+// ========================================================================================
+// RUN STATISTICS IMPLEMENTATION
+// ========================================================================================
+
+int RunStatistics::metricIndex(SchedulingMetric metric) {
+    switch (metric) {
+        case SchedulingMetric::WAITING_TIME:
+            return 0;
+        case SchedulingMetric::TURNAROUND_TIME:
+            return 1;
+        case SchedulingMetric::RESPONSE_TIME:
+            return 2;
+        default:
+            return -1;
+    }
+}
+
+/**
+ * Merge Implementation
+ */
+void RunStatistics::merge(const RunStatistics& other) {
+    for (int row = 0; row < PRIORITY_CLASSES; ++row) {
+        for (int metric = 0; metric < METRICS; ++metric) {
+            histograms[row][metric].merge(other.histograms[row][metric]);
+        }
+    }
+    throughput.merge(other.throughput);
+    tardiness.merge(other.tardiness);
+    slack.merge(other.slack);
+}
+
+/**
+ * Serialize Implementation
+ */
+void RunStatistics::serialize(string& buffer) const {
+    for (const auto& row : histograms) {
+        for (const LogHistogram& histogram : row) {
+            histogram.serialize(buffer);
+        }
+    }
+    throughput.serialize(buffer);
+    tardiness.serialize(buffer);
+    slack.serialize(buffer);
+}
+
+/**
+ * Deserialize Implementation
+ */
+bool RunStatistics::deserialize(const char*& cursor, const char* end) {
+    for (auto& row : histograms) {
+        for (LogHistogram& histogram : row) {
+            if (!histogram.deserialize(cursor, end)) return false;
+        }
+    }
+    return throughput.deserialize(cursor, end) && tardiness.deserialize(cursor, end) &&
+           slack.deserialize(cursor, end);
+}
+
+/**
+ * Clear Implementation
+ */
+void RunStatistics::clear() {
+    for (auto& row : histograms) {
+        for (LogHistogram& histogram : row) {
+            histogram.clear();
+        }
+    }
+    throughput.clear();
+    tardiness.clear();
+    slack.clear();
+}
+
+/**
+ * Get Mean Lateness Implementation
+ */
+double RunStatistics::getMeanLateness() const {
+    uint64_t count = getDeadlineCount();
+    if (count == 0) {
+        return 0.0;
+    }
+    return (tardiness.getMean() * static_cast<double>(tardiness.getCount()) -
+            slack.getMean() * static_cast<double>(slack.getCount())) / static_cast<double>(count);
+}
+
+/**
+ * Get Histogram Implementation
+ */
+LogHistogram RunStatistics::get(SchedulingMetric metric) const {
+    LogHistogram overall;
+    int index = metricIndex(metric);
+    if (index >= 0) {
+        for (const auto& row : histograms) {
+            overall.merge(row[index]);
+        }
+    }
+    return overall;
+}
+
+/**
+ * Get Histogram of a Priority Class Implementation
+ */
+const LogHistogram& RunStatistics::get(SchedulingMetric metric, Priority priority) const {
+    int index = metricIndex(metric);
+    return index >= 0 ? histograms[static_cast<int>(priority) - 1][index] : empty;
+}
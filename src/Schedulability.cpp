@@ -0,0 +1,229 @@
+/**
+ * Schedulability.cpp - Real-Time Schedulability Analysis Implementation File
+ *
+ * This source file contains the utilisation bounds, the rate monotonic
+ * response-time analysis and the report output.
+ *
+ */
+
+#include "Schedulability.h"
+
+#include <algorithm>    // For sort and max
+#include <cmath>        // For pow
+#include <iomanip>      // For formatted output
+#include <iostream>     // For output operations
+#include <numeric>      // For gcd
+
+/**
+ * Get Schedulability Verdict Name Implementation
+ */
+string schedulabilityVerdictToString(SchedulabilityVerdict verdict) {
+    switch (verdict) {
+        case SchedulabilityVerdict::SCHEDULABLE:
+            return "schedulable";
+        case SchedulabilityVerdict::NOT_SCHEDULABLE:
+            return "not schedulable";
+        case SchedulabilityVerdict::UNKNOWN:
+            return "unknown";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+// ========================================================================================
+// ANALYSIS IMPLEMENTATION
+// ========================================================================================
+
+/**
+ * Get Hyperperiod Implementation
+ */
+SimTime getHyperperiod(const Workload& workload, SimTime limit) {
+    SimTime hyperperiod = 0;
+    for (int period : workload.period) {
+        if (period <= 0) continue;
+        if (hyperperiod == 0) {
+            hyperperiod = period;
+            continue;
+        }
+        SimTime reduced = hyperperiod / gcd(hyperperiod, static_cast<SimTime>(period));
+        if (reduced > limit / period) {
+            return 0;
+        }
+        hyperperiod = reduced * period;
+    }
+    return hyperperiod <= limit ? hyperperiod : 0;
+}
+
+/**
+ * Analyse Schedulability Implementation
+ *
+ * Algorithm flow:
+ * 1. Collect the periodic processes with their utilisation and density, in
+ *    rate monotonic priority order (period, then arrival, then PID, as the
+ *    PERIOD ready queue ordering breaks ties).
+ * 2. EDF: a utilisation above the CPU count can never be met. On one CPU,
+ *    U <= 1 is exact unless a deadline is shorter than its period, when the
+ *    density test is sufficient; on several CPUs the GFB bound
+ *    density <= m - (m - 1) * max density is sufficient.
+ * 3. Rate monotonic on one CPU: response-time analysis iterates
+ *    R = C + sum over higher-priority processes of ceil(R / T) * C up to a
+ *    fixed point. It is exact for synchronous first releases and deadlines
+ *    up to the period; otherwise the Liu & Layland bound is sufficient. On
+ *    several CPUs the ABJ bound U <= m^2 / (3m - 2), with every utilisation
+ *    at most m / (3m - 2), is sufficient for implicit deadlines.
+ */
+SchedulabilityReport analyseSchedulability(const Workload& workload, int cpus) {
+    SchedulabilityReport report;
+    report.cpuCount = max(cpus, 1);
+    const double m = report.cpuCount;
+
+    double maxDensity = 0.0;
+    bool synchronous = true;
+    bool longDeadlines = false;
+    for (ProcessHandle process = 0; process < workload.relativeDeadline.size(); ++process) {
+        int period = workload.periodOf(process);
+        int deadline = workload.deadlineOf(process);
+        if (period == 0) {
+            report.aperiodicDeadlines += deadline > 0 ? 1 : 0;
+            continue;
+        }
+
+        double burst = workload.burstTime[process];
+        double utilisation = burst / period;
+        double density = burst / min(deadline, period);
+        report.utilisation += utilisation;
+        report.density += density;
+        report.maxUtilisation = max(report.maxUtilisation, utilisation);
+        maxDensity = max(maxDensity, density);
+        report.constrainedDeadlines = report.constrainedDeadlines || deadline < period;
+        longDeadlines = longDeadlines || deadline > period;
+        if (!report.tasks.empty() && workload.arrivalTime[process] != workload.arrivalTime[report.tasks[0].process]) {
+            synchronous = false;
+        }
+
+        TaskAnalysis task;
+        task.process = process;
+        report.tasks.push_back(task);
+    }
+    if (report.tasks.empty()) {
+        return report;
+    }
+
+    sort(report.tasks.begin(), report.tasks.end(), [&workload](const TaskAnalysis& a, const TaskAnalysis& b) {
+        if (workload.periodOf(a.process) != workload.periodOf(b.process)) {
+            return workload.periodOf(a.process) < workload.periodOf(b.process);
+        }
+        if (workload.arrivalTime[a.process] != workload.arrivalTime[b.process]) {
+            return workload.arrivalTime[a.process] < workload.arrivalTime[b.process];
+        }
+        return workload.pid[a.process] < workload.pid[b.process];
+    });
+    report.hyperperiod = getHyperperiod(workload, INT64_MAX / 2);
+
+    // EDF
+    const bool overloaded = report.utilisation > m || report.maxUtilisation > 1.0;
+    if (overloaded) {
+        report.edf = SchedulabilityVerdict::NOT_SCHEDULABLE;
+        report.edfTest = "utilisation above the CPU count";
+    } else if (report.cpuCount == 1) {
+        bool densityMet = report.density <= 1.0;
+        report.edf = !report.constrainedDeadlines || densityMet ? SchedulabilityVerdict::SCHEDULABLE
+                                                                : SchedulabilityVerdict::UNKNOWN;
+        report.edfTest = report.constrainedDeadlines ? "density test" : "utilisation test (exact)";
+    } else {
+        bool bound = report.density <= m - (m - 1.0) * maxDensity;
+        report.edf = bound ? SchedulabilityVerdict::SCHEDULABLE : SchedulabilityVerdict::UNKNOWN;
+        report.edfTest = "GFB bound";
+    }
+
+    // Rate monotonic
+    const double n = static_cast<double>(report.tasks.size());
+    if (report.cpuCount == 1) {
+        report.rateMonotonicBound = n * (pow(2.0, 1.0 / n) - 1.0);
+    } else {
+        report.rateMonotonicBound = m * m / (3.0 * m - 2.0);
+    }
+
+    if (overloaded) {
+        report.rateMonotonic = SchedulabilityVerdict::NOT_SCHEDULABLE;
+        report.rateMonotonicTest = "utilisation above the CPU count";
+    } else if (report.cpuCount == 1 && !longDeadlines) {
+        report.responseTimesAnalysed = true;
+        bool allMet = true;
+        for (size_t i = 0; i < report.tasks.size(); ++i) {
+            TaskAnalysis& task = report.tasks[i];
+            const int deadline = workload.deadlineOf(task.process);
+            SimTime response = 0;
+            for (size_t j = 0; j <= i; ++j) {
+                response += workload.burstTime[report.tasks[j].process];
+            }
+            while (response <= deadline) {
+                SimTime next = workload.burstTime[task.process];
+                for (size_t j = 0; j < i; ++j) {
+                    ProcessHandle higher = report.tasks[j].process;
+                    SimTime period = workload.periodOf(higher);
+                    next += (response + period - 1) / period * workload.burstTime[higher];
+                }
+                if (next == response) break;
+                response = next;
+            }
+            task.meetsDeadline = response <= deadline;
+            task.worstResponse = task.meetsDeadline ? response : -1;
+            allMet = allMet && task.meetsDeadline;
+        }
+        report.rateMonotonic = allMet ? SchedulabilityVerdict::SCHEDULABLE
+                             : synchronous ? SchedulabilityVerdict::NOT_SCHEDULABLE
+                                           : SchedulabilityVerdict::UNKNOWN;
+        report.rateMonotonicTest = synchronous ? "response-time analysis (exact)" : "response-time analysis";
+    } else {
+        bool bound = !report.constrainedDeadlines && report.utilisation <= report.rateMonotonicBound &&
+                     (report.cpuCount == 1 || report.maxUtilisation <= m / (3.0 * m - 2.0));
+        report.rateMonotonic = bound ? SchedulabilityVerdict::SCHEDULABLE : SchedulabilityVerdict::UNKNOWN;
+        report.rateMonotonicTest = report.cpuCount == 1 ? "Liu & Layland bound" : "ABJ bound";
+    }
+
+    return report;
+}
+
+// ========================================================================================
+// REPORTING
+// ========================================================================================
+
+/**
+ * Print Schedulability Report Implementation
+ */
+void printSchedulability(const SchedulabilityReport& report, const Workload& workload) {
+    cout << "\n=== Schedulability Analysis (" << report.tasks.size() << " periodic processes, "
+         << report.cpuCount << (report.cpuCount == 1 ? " CPU" : " CPUs") << ") ===" << endl;
+    cout << "Utilisation: " << fixed << setprecision(4) << report.utilisation
+         << " (density " << report.density << ")" << endl;
+    if (report.hyperperiod > 0) {
+        cout << "Hyperperiod: " << report.hyperperiod << " time units" << endl;
+    }
+    cout << "EDF: " << schedulabilityVerdictToString(report.edf) << " (" << report.edfTest << ")" << endl;
+    cout << "Rate monotonic: " << schedulabilityVerdictToString(report.rateMonotonic)
+         << " (" << report.rateMonotonicTest << ", bound " << setprecision(4) << report.rateMonotonicBound << ")"
+         << endl;
+    if (report.aperiodicDeadlines > 0) {
+        cout << report.aperiodicDeadlines << " aperiodic processes with deadlines are not analysed" << endl;
+    }
+
+    if (!report.responseTimesAnalysed) {
+        return;
+    }
+
+    cout << setw(12) << "Name" << setw(8) << "Period" << setw(10) << "Deadline"
+         << setw(8) << "Burst" << setw(14) << "WC response" << endl;
+    cout << string(52, '-') << endl;
+    for (const TaskAnalysis& task : report.tasks) {
+        cout << setw(12) << workload.name(task.process)
+             << setw(8) << workload.periodOf(task.process)
+             << setw(10) << workload.deadlineOf(task.process)
+             << setw(8) << workload.burstTime[task.process];
+        if (task.meetsDeadline) {
+            cout << setw(14) << task.worstResponse << endl;
+        } else {
+            cout << setw(14) << "> deadline" << endl;
+        }
+    }
+}
@@ -7,6 +7,38 @@
  */
 
 #include "Scheduler.h"
+#include "SchedulingKernel.h"
+#include "Schedulability.h"
+#include "VectorKernels.h"
+
+// ========================================================================================
+// LOAD BALANCING IMPLEMENTATION
+// ========================================================================================
+
+/**
+ * Get Load Balancing Name Implementation
+ */
+string loadBalancingToString(LoadBalancing strategy) {
+    switch (strategy) {
+        case LoadBalancing::GLOBAL_QUEUE:
+            return "global queue";
+        case LoadBalancing::PERIODIC:
+            return "periodic balancing";
+        case LoadBalancing::WORK_STEALING:
+            return "work stealing";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+Verbosity Scheduler::defaultVerbosity = Verbosity::TRACE;
+
+namespace {
+
+// Last process of a CPU whose row was reused: differs from every live handle
+constexpr ProcessHandle RETIRED_PROCESS = INVALID_PROCESS - 1;
+
+} // namespace
 
 // ========================================================================================
 // CONSTRUCTOR AND DESTRUCTOR IMPLEMENTATIONS
@@ -16,23 +48,53 @@
  * Scheduler Constructor Implementation
  * Initializes the base scheduler with algorithm name and settings
  */
-Scheduler::Scheduler(const string& name, bool preemptive)
-    : currentProcess(nullptr),
+Scheduler::Scheduler(const string& name, bool preemptive, ReadyQueueOrder order)
+    : readyQueueKind(order == ReadyQueueOrder::FIFO ? ReadyQueueKind::FIFO : ReadyQueueKind::BINARY_HEAP),
       currentTime(0),
       algorithmName(name),
       isPreemptive(preemptive),
+      verbosity(defaultVerbosity),
+      eventSequence(0),
+      deviceCount(0),
+      cpus(1),
+      loadBalancing(LoadBalancing::GLOBAL_QUEUE),
+      balanceInterval(10),
+      balancePending(false),
+      timerPending(false),
+      busyCpus(0),
+      nextPlacementCpu(0),
+      arrivalOrderValid(true),
+      arrivalCursor(0),
+      liveArrivals(false),
+      retainStreamed(true),
+      transientRows(0),
+      transientArrivals(0),
+      releaseHorizon(0),
+      activeHorizon(0),
+      pendingReleases(0),
       totalProcesses(0),
       completedProcesses(0),
       totalWaitingTime(0.0),
       totalTurnaroundTime(0.0),
-      totalResponseTime(0.0)
+      totalResponseTime(0.0),
+      contextSwitches(0),
+      migrations(0),
+      overheadTime(0),
+      pauseTime(-1),
+      paused(false),
+      cutoffEnabled(false),
+      cutoffMetric(SchedulingMetric::WAITING_TIME),
+      cutoffLimit(0.0),
+      cutOff(false)
 {
-    // Initialize the ready queue (already empty by default)
-    // Clear any existing processes
-    processes.clear();
+    // Initialize the ready queue with the ordering required by the policy
+    readyQueue = createReadyQueue(readyQueueKind, order, table);
+    rebuildCpus();
     
-    cout << "Initialized " << algorithmName << " Scheduler" 
-         << (isPreemptive ? " (Preemptive)" : " (Non-preemptive)") << endl;
+    if (verbosity >= Verbosity::NORMAL) {
+        cout << "Initialized " << algorithmName << " Scheduler" 
+             << (isPreemptive ? " (Preemptive)" : " (Non-preemptive)") << endl;
+    }
 }
 
 // ========================================================================================
@@ -50,22 +112,40 @@ bool Scheduler::addProcess(shared_ptr<Process> process) {
         return false;
     }
     
-    // Check for duplicate PIDs (shouldn't happen with proper Process class)
-    for (const auto& existingProcess : processes) {
-        if (existingProcess->pid == process->pid) {
-            cerr << "Warning: Process with PID " << process->pid << " already exists" << endl;
-            return false;
-        }
+    // Copy the process attributes into the process table (duplicate PIDs are rejected)
+    ProcessSpec spec;
+    spec.name = process->name;
+    spec.arrivalTime = process->arrivalTime;
+    spec.burstTime = process->burstTime;
+    spec.priority = process->priority;
+    spec.pid = process->pid;
+    spec.ioBursts = process->ioBursts;
+    spec.period = process->period;
+    spec.relativeDeadline = process->relativeDeadline;
+    
+    return addProcess(spec) != INVALID_PROCESS;
+}
+
+/**
+ * Add Process from Specification Implementation
+ */
+ProcessHandle Scheduler::addProcess(const ProcessSpec& spec) {
+    releaseTransientRows();
+    Workload& target = getMutableWorkload();
+    ProcessHandle handle = target.add(spec);
+    if (handle == INVALID_PROCESS) {
+        return INVALID_PROCESS;
     }
     
-    // Add process to system
-    processes.push_back(process);
     totalProcesses++;
+    arrivalOrderValid = false;
     
-    cout << "Added process " << process->name << " (PID: " << process->pid 
-         << ") to " << algorithmName << " scheduler" << endl;
+    if (verbosity >= Verbosity::NORMAL) {
+        cout << "Added process " << target.name(handle) << " (PID: " << target.pid[handle]
+             << ") to " << algorithmName << " scheduler" << endl;
+    }
     
-    return true;
+    return handle;
 }
 
 /**
@@ -81,15 +161,62 @@ int Scheduler::addProcesses(const vector<shared_ptr<Process>>& processList) {
         }
     }
     
-    cout << "Successfully added " << successCount << " out of " 
-         << processList.size() << " processes" << endl;
+    if (verbosity >= Verbosity::NORMAL) {
+        cout << "Successfully added " << successCount << " out of " 
+             << processList.size() << " processes" << endl;
+    }
     
     return successCount;
 }
 
+/**
+ * Set Arrival Source Implementation
+ */
+void Scheduler::setArrivalSource(unique_ptr<ArrivalSource> source, bool retain) {
+    releaseTransientRows();
+    arrivalSource = std::move(source);
+    liveArrivals = arrivalSource && arrivalSource->isLive();
+    retainStreamed = retain;
+}
+
+/**
+ * Set Workload Implementation
+ */
+void Scheduler::setWorkload(shared_ptr<const Workload> source) {
+    workload = std::move(source);
+    localWorkload.reset();
+    transientRows = 0;
+    freeRows.clear();
+    totalProcesses = workload ? static_cast<long long>(workload->size()) : 0;
+    arrivalOrderValid = false;
+    table.bind(workload);
+}
+
+/**
+ * Get Workload Implementation
+ */
+shared_ptr<const Workload> Scheduler::getWorkload() const {
+    return workload;
+}
+
+/**
+ * Get Process Table Implementation
+ */
+const ProcessTable& Scheduler::getProcessTable() const {
+    return table;
+}
+
+/**
+ * Get Process View Implementation
+ */
+ProcessView Scheduler::getProcess(ProcessHandle handle) const {
+    return ProcessView(table, handle);
+}
+
 /**
  * Run Scheduling Simulation Implementation
- * Main simulation driver that calls the specific scheduling algorithm
+ * Main simulation driver that calls the specific scheduling algorithm.
+ * The verbose flag selects TRACE or QUIET for the duration of the run.
  */
 bool Scheduler::runSimulation(bool verbose) {
     // Validate process set before starting
@@ -98,17 +225,18 @@ bool Scheduler::runSimulation(bool verbose) {
         return false;
     }
     
-    // Reset scheduler state for fresh simulation
-    reset();
+    Verbosity previousVerbosity = verbosity;
+    verbosity = verbose ? Verbosity::TRACE : Verbosity::QUIET;
     
     if (verbose) {
-        cout << "\n=== Starting " << algorithmName << " Scheduling Simulation ===" << endl;
-        cout << "Total processes: " << totalProcesses << endl;
-        cout << "Algorithm type: " << (isPreemptive ? "Preemptive" : "Non-preemptive") << endl;
-        cout << string(60, '=') << endl;
+        trace() << "\n=== Starting " << algorithmName << " Scheduling Simulation ===\n";
+        trace() << "Total processes: " << static_cast<int64_t>(totalProcesses) << '\n';
+        trace() << "Algorithm type: " << (isPreemptive ? "Preemptive" : "Non-preemptive") << '\n';
+        trace() << string(60, '=') << '\n';
     }
     
-    // Call the specific scheduling algorithm (implemented by derived classes)
+    // Call the specific scheduling algorithm (implemented by derived classes);
+    // the shared event loop starts from a fresh reset()
     bool success = schedule();
     
     if (success) {
@@ -116,15 +244,17 @@ bool Scheduler::runSimulation(bool verbose) {
         calculateStatistics();
         
         if (verbose) {
-            cout << string(60, '=') << endl;
-            cout << "=== " << algorithmName << " Simulation Completed ===" << endl;
-            cout << "Total execution time: " << currentTime << " time units" << endl;
-            cout << "All " << completedProcesses << " processes completed successfully" << endl;
+            trace() << string(60, '=') << '\n';
+            trace() << "=== " << algorithmName << " Simulation Completed ===\n";
+            trace() << "Total execution time: " << currentTime << " time units\n";
+            trace() << "All " << static_cast<int64_t>(completedProcesses) << " processes completed successfully\n";
+            trace().flush();
         }
     } else {
         cerr << "Error: Simulation failed for " << algorithmName << " scheduler" << endl;
     }
     
+    verbosity = previousVerbosity;
     return success;
 }
 
@@ -137,19 +267,30 @@ void Scheduler::printStatistics() const {
     
     printStatisticsHeader();
     
-    // Print individual process statistics
-    for (const auto& process : processes) {
-        cout << setw(5) << process->pid 
-             << setw(12) << process->name
-             << setw(8) << process->arrivalTime
-             << setw(8) << process->burstTime
-             << setw(8) << process->startTime
-             << setw(10) << process->waitingTime
-             << setw(12) << process->turnaroundTime
-             << setw(10) << process->responseTime << endl;
+    // Print individual process statistics in arrival order
+    for (ProcessHandle process : arrivalOrder) {
+        cout << setw(5) << table.pid(process) 
+             << setw(12) << table.name(process)
+             << setw(8) << table.arrivalTime(process)
+             << setw(8) << table.burstTime(process)
+             << setw(8) << table.startTime[process]
+             << setw(10) << table.waitingTime[process]
+             << setw(12) << table.turnaroundTime(process)
+             << setw(10) << table.responseTime(process) << endl;
     }
     
     printStatisticsFooter();
+    printPercentileStatistics();
+    if (runStatistics.getDeadlineCount() > 0) {
+        printDeadlineStatistics();
+    }
+    
+    if (cpus.size() > 1) {
+        printCpuStatistics();
+    }
+    if (deviceCount > 0) {
+        printDeviceStatistics();
+    }
 }
 
 /**
@@ -165,10 +306,18 @@ void Scheduler::printDetailedStatistics() const {
     cout << "Algorithm: " << algorithmName 
          << (isPreemptive ? " (Preemptive)" : " (Non-preemptive)") << endl;
     cout << "Total execution time: " << getTotalExecutionTime() << " time units" << endl;
+    SimTime busyTime = 0;
+    for (const CpuState& cpu : cpus) {
+        busyTime += cpu.stats.busyTime;
+    }
     cout << "CPU utilization: " << fixed << setprecision(2) 
          << (getTotalExecutionTime() > 0 ? 
-             (double)(totalProcesses * 100) / getTotalExecutionTime() : 0.0) 
+             100.0 * busyTime / (static_cast<double>(getTotalExecutionTime()) * cpus.size()) : 0.0) 
          << "%" << endl;
+    cout << "Context switches: " << contextSwitches << endl;
+    cout << "Dispatch overhead: " << overheadTime << " time units ("
+         << fixed << setprecision(2)
+         << (busyTime > 0 ? 100.0 * overheadTime / busyTime : 0.0) << "% of busy time)" << endl;
     cout << "Throughput: " << fixed << setprecision(2)
          << (getTotalExecutionTime() > 0 ? 
              (double)completedProcesses / getTotalExecutionTime() : 0.0)
@@ -176,11 +325,10 @@ void Scheduler::printDetailedStatistics() const {
     
     // Process completion order
     cout << "\nProcess completion order:" << endl;
-    vector<pair<int, string>> completionOrder;
-    for (const auto& process : processes) {
-        if (process->isComplete()) {
-            int completionTime = process->startTime + process->burstTime;
-            completionOrder.push_back({completionTime, process->name});
+    vector<pair<SimTime, string>> completionOrder;
+    for (ProcessHandle process = 0; process < table.size(); ++process) {
+        if (table.state[process] == ProcessState::TERMINATED) {
+            completionOrder.push_back({table.completionTime[process], string(table.name(process))});
         }
     }
     
@@ -201,7 +349,7 @@ string Scheduler::getAlgorithmName() const {
 /**
  * Get Total Execution Time Implementation
  */
-int Scheduler::getTotalExecutionTime() const {
+SimTime Scheduler::getTotalExecutionTime() const {
     return currentTime;
 }
 
@@ -227,293 +375,1623 @@ double Scheduler::getAverageResponseTime() const {
 }
 
 /**
- * Reset Scheduler State Implementation
- * Prepares scheduler for a fresh simulation run
+ * Get Context Switch Count Implementation
  */
-void Scheduler::reset() {
-    // Reset timing
-    currentTime = 0;
-    currentProcess = nullptr;
-    
-    // Clear ready queue
-    while (!readyQueue.empty()) {
-        readyQueue.pop();
-    }
-    
-    // Reset statistics
-    completedProcesses = 0;
-    totalWaitingTime = 0.0;
-    totalTurnaroundTime = 0.0;
-    totalResponseTime = 0.0;
-    
-    // Reset all process states
-    resetProcessStates();
-    
-    cout << "Scheduler state reset for " << algorithmName << endl;
+long long Scheduler::getContextSwitchCount() const {
+    return contextSwitches;
 }
 
 /**
- * Clear All Processes Implementation
+ * Get Migration Count Implementation
  */
-void Scheduler::clearProcesses() {
-    processes.clear();
-    totalProcesses = 0;
-    reset();
-    cout << "All processes cleared from " << algorithmName << " scheduler" << endl;
+long long Scheduler::getMigrationCount() const {
+    return migrations;
 }
 
 /**
- * Get Process Count Implementation
+ * Get Overhead Time Implementation
  */
-size_t Scheduler::getProcessCount() const {
-    return processes.size();
+SimTime Scheduler::getOverheadTime() const {
+    return overheadTime;
 }
 
 /**
- * Is Preemptive Algorithm Implementation
+ * Get Event Count Implementation
  */
-bool Scheduler::isPreemptiveAlgorithm() const {
-    return isPreemptive;
+long long Scheduler::getEventCount() const {
+    return eventSequence + static_cast<long long>(arrivalCursor) + transientArrivals;
 }
 
-// ========================================================================================
-// PROTECTED HELPER METHOD IMPLEMENTATIONS
-// ========================================================================================
+/**
+ * Get Run Statistics Implementation
+ */
+const RunStatistics& Scheduler::getRunStatistics() const {
+    return runStatistics;
+}
 
 /**
- * Update Waiting Times Implementation
- * Increments waiting time for all processes in READY state
+ * Get Profile Implementation
  */
-void Scheduler::updateWaitingTimes() {
-    for (auto& process : processes) {
-        if (process->state == ProcessState::READY) {
-            process->waitingTime++;
-        }
+const ProfileCounters& Scheduler::getProfile() const {
+    return profile;
+}
+
+/**
+ * Set Throughput Window Implementation
+ */
+void Scheduler::setThroughputWindow(SimTime width) {
+    if (width <= 0) {
+        cerr << "Warning: Throughput window must be positive. Using 1." << endl;
+        width = 1;
     }
+    runStatistics.setThroughputWindow(width);
 }
 
 /**
- * Check for Process Arrivals Implementation
- * Moves newly arrived processes to ready queue
+ * Print Percentile Statistics Implementation
  */
-void Scheduler::checkArrivals() {
-    for (auto& process : processes) {
-        if (process->state == ProcessState::NEW && process->arrivalTime <= currentTime) {
-            process->state = ProcessState::READY;
-            readyQueue.push(process);
+void Scheduler::printPercentileStatistics() const {
+    const SchedulingMetric metrics[] = {SchedulingMetric::WAITING_TIME,
+                                        SchedulingMetric::TURNAROUND_TIME,
+                                        SchedulingMetric::RESPONSE_TIME};
+    const Priority classes[] = {Priority::HIGH, Priority::MEDIUM, Priority::LOW};
+    
+    int classesRun = 0;
+    for (Priority priority : classes) {
+        if (runStatistics.get(SchedulingMetric::WAITING_TIME, priority).getCount() > 0) classesRun++;
+    }
+    
+    auto printRow = [](const string& metric, const string& group, const LogHistogram& histogram) {
+        cout << left << setw(12) << metric << setw(8) << group << right
+             << setw(10) << histogram.getCount()
+             << setw(10) << fixed << setprecision(2) << histogram.getMean()
+             << setw(8) << histogram.getPercentile(50)
+             << setw(8) << histogram.getPercentile(90)
+             << setw(8) << histogram.getPercentile(99)
+             << setw(8) << histogram.getPercentile(99.9)
+             << setw(8) << histogram.getMax() << endl;
+    };
+    
+    cout << "=== " << algorithmName << " Percentiles ===" << endl;
+    cout << left << setw(12) << "Metric" << setw(8) << "Class" << right
+         << setw(10) << "Count" << setw(10) << "Mean"
+         << setw(8) << "p50" << setw(8) << "p90" << setw(8) << "p99"
+         << setw(8) << "p99.9" << setw(8) << "Max" << endl;
+    cout << string(80, '-') << endl;
+    for (SchedulingMetric metric : metrics) {
+        printRow(schedulingMetricToString(metric), "all", runStatistics.get(metric));
+        if (classesRun < 2) continue;
+        for (Priority priority : classes) {
+            const LogHistogram& histogram = runStatistics.get(metric, priority);
+            if (histogram.getCount() > 0) {
+                printRow("", Process::priorityToString(priority), histogram);
+            }
         }
     }
+    cout << string(80, '-') << endl;
+    
+    // Throughput over time, from the windowed completion counts
+    const ThroughputSeries& series = runStatistics.getThroughput();
+    if (!series.getWindows().empty()) {
+        size_t peak = 0;
+        for (size_t window = 1; window < series.getWindows().size(); ++window) {
+            if (series.getWindows()[window] > series.getWindows()[peak]) peak = window;
+        }
+        cout << "Peak throughput: " << fixed << setprecision(2) << series.getRate(peak)
+             << " processes/time unit in [" << peak * series.getWindowWidth() << ", "
+             << (peak + 1) * series.getWindowWidth() << ") ("
+             << series.getWindows().size() << " windows of " << series.getWindowWidth()
+             << " time units)" << endl;
+    }
 }
 
 /**
- * Check All Processes Completed Implementation
+ * Set Release Horizon Implementation
  */
-bool Scheduler::allProcessesCompleted() const {
-    for (const auto& process : processes) {
-        if (process->state != ProcessState::TERMINATED) {
-            return false;
-        }
+void Scheduler::setReleaseHorizon(SimTime horizon) {
+    if (horizon < 0) {
+        cerr << "Warning: Release horizon cannot be negative. Using the automatic horizon." << endl;
+        horizon = 0;
     }
-    return true;
+    releaseHorizon = horizon;
 }
 
 /**
- * Get Next Ready Process Implementation
+ * Get Release Horizon Implementation
  */
-shared_ptr<Process> Scheduler::getNextReadyProcess() const {
-    return readyQueue.empty() ? nullptr : readyQueue.front();
+SimTime Scheduler::getReleaseHorizon() const {
+    return releaseHorizon;
 }
 
 /**
- * Remove Process from Ready Queue Implementation
+ * Print Deadline Statistics Implementation
  */
-shared_ptr<Process> Scheduler::removeFromReadyQueue() {
-    if (readyQueue.empty()) {
-        return nullptr;
-    }
+void Scheduler::printDeadlineStatistics() const {
+    const LogHistogram& tardiness = runStatistics.getTardiness();
+    const LogHistogram& slack = runStatistics.getSlack();
+    uint64_t jobs = runStatistics.getDeadlineCount();
+    uint64_t misses = runStatistics.getDeadlineMisses();
+    
+    cout << "=== " << algorithmName << " Deadline Statistics ===" << endl;
+    cout << "Jobs with deadlines: " << jobs << endl;
+    cout << "Deadline misses: " << misses << " (" << fixed << setprecision(2)
+         << 100.0 * misses / jobs << "%)" << endl;
+    cout << "Mean lateness: " << runStatistics.getMeanLateness() << " time units" << endl;
+    cout << "Max lateness: " << runStatistics.getMaxLateness() << " time units" << endl;
     
-    auto process = readyQueue.front();
-    readyQueue.pop();
-    return process;
+    cout << left << setw(12) << "Metric" << right << setw(10) << "Count" << setw(10) << "Mean"
+         << setw(8) << "p50" << setw(8) << "p90" << setw(8) << "p99" << setw(8) << "Max" << endl;
+    cout << string(64, '-') << endl;
+    auto printRow = [](const string& metric, const LogHistogram& histogram) {
+        cout << left << setw(12) << metric << right
+             << setw(10) << histogram.getCount()
+             << setw(10) << fixed << setprecision(2) << histogram.getMean()
+             << setw(8) << histogram.getPercentile(50)
+             << setw(8) << histogram.getPercentile(90)
+             << setw(8) << histogram.getPercentile(99)
+             << setw(8) << histogram.getMax() << endl;
+    };
+    if (tardiness.getCount() > 0) printRow("Tardiness", tardiness);
+    if (slack.getCount() > 0) printRow("Slack", slack);
 }
 
 /**
- * Add Process to Ready Queue Implementation
+ * Get Metric Total Implementation
  */
-void Scheduler::addToReadyQueue(shared_ptr<Process> process) {
-    if (process && process->state != ProcessState::TERMINATED) {
-        process->state = ProcessState::READY;
-        readyQueue.push(process);
+double Scheduler::getMetricTotal(SchedulingMetric metric) const {
+    switch (metric) {
+        case SchedulingMetric::WAITING_TIME:
+            return totalWaitingTime;
+        case SchedulingMetric::TURNAROUND_TIME:
+            return totalTurnaroundTime;
+        case SchedulingMetric::RESPONSE_TIME:
+            return totalResponseTime;
+        case SchedulingMetric::CONTEXT_SWITCHES:
+            return contextSwitches;
     }
+    return 0.0;
 }
 
 /**
- * Start Process Execution Implementation
+ * Set Cutoff Implementation
  */
-void Scheduler::startProcessExecution(shared_ptr<Process> process) {
-    if (!process) return;
-    
-    currentProcess = process;
-    currentProcess->state = ProcessState::RUNNING;
-    
-    // Record start time and response time if first execution
-    if (!currentProcess->hasStarted) {
-        currentProcess->startTime = currentTime;
-        currentProcess->responseTime = currentTime - currentProcess->arrivalTime;
-        currentProcess->hasStarted = true;
-    }
+void Scheduler::setCutoff(SchedulingMetric metric, double limit) {
+    cutoffEnabled = true;
+    cutoffMetric = metric;
+    cutoffLimit = limit;
 }
 
 /**
- * Complete Process Execution Implementation
+ * Clear Cutoff Implementation
  */
-void Scheduler::completeProcessExecution(shared_ptr<Process> process) {
-    if (!process) return;
-    
-    process->state = ProcessState::TERMINATED;
-    process->remainingTime = 0;
-    process->updateStatistics(currentTime);
-    completedProcesses++;
-    
-    // Clear current process if it's the completed one
-    if (currentProcess == process) {
-        currentProcess = nullptr;
-    }
+void Scheduler::clearCutoff() {
+    cutoffEnabled = false;
 }
 
 /**
- * Preempt Current Process Implementation
+ * Was Cut Off Implementation
  */
-void Scheduler::preemptCurrentProcess(const string& reason) {
-    if (currentProcess && currentProcess->remainingTime > 0) {
-        currentProcess->state = ProcessState::READY;
-        readyQueue.push(currentProcess);
-        currentProcess = nullptr;
-    }
+bool Scheduler::wasCutOff() const {
+    return cutOff;
 }
 
+// ========================================================================================
+// SNAPSHOTS
+// ========================================================================================
+
 /**
- * Execute Time Slice Implementation
+ * Run Until Implementation
  */
-bool Scheduler::executeTimeSlice() {
-    if (!currentProcess) return false;
-    
-    // Execute for one time unit
-    currentProcess->remainingTime--;
+bool Scheduler::runUntil(SimTime time) {
+    if (time < 0) {
+        cerr << "Error: Pause time must not be negative" << endl;
+        return false;
+    }
     
-    // Check if process completed
-    if (currentProcess->remainingTime <= 0) {
-        completeProcessExecution(currentProcess);
-        return true;  // Process completed
+    pauseTime = time;
+    bool completed = schedule();
+    pauseTime = -1;
+    return completed || paused;
+}
+
+/**
+ * Is Paused Implementation
+ */
+bool Scheduler::isPaused() const {
+    return paused;
+}
+
+/**
+ * Resume Implementation
+ */
+bool Scheduler::resume() {
+    if (!paused) {
+        cerr << "Error: " << algorithmName << " has no paused run to resume" << endl;
+        return false;
     }
     
-    return false;  // Process still running
+    paused = false;
+    return runKernel<Scheduler>();
 }
 
 /**
- * Print Execution Step Implementation
+ * Take Snapshot Implementation
+ * The event queue is copied and drained, so events are kept in firing order
  */
-void Scheduler::printExecutionStep(const string& action) const {
-    cout << "Time " << setw(3) << currentTime << ": " << action;
+shared_ptr<const SchedulerSnapshot> Scheduler::snapshot() {
+    if (arrivalSource) {
+        cerr << "Error: Cannot snapshot " << algorithmName << ": streamed arrivals are not captured" << endl;
+        return nullptr;
+    }
+    if (processGroups) {
+        cerr << "Error: Cannot snapshot " << algorithmName << ": process group state is not captured" << endl;
+        return nullptr;
+    }
+    
+    // Detach an owned workload, so later additions copy it instead of changing the snapshot
+    localWorkload.reset();
     
-    if (currentProcess) {
-        cout << " (Process " << currentProcess->name 
-             << ", remaining: " << currentProcess->remainingTime << ")";
+    auto result = make_shared<SchedulerSnapshot>();
+    result->algorithm = algorithmName;
+    result->time = currentTime;
+    result->workload = workload;
+    result->table = table;
+    result->loadBalancing = loadBalancing;
+    
+    result->cpus.resize(cpus.size());
+    for (size_t cpu = 0; cpu < cpus.size(); ++cpu) {
+        const CpuState& state = cpus[cpu];
+        SchedulerSnapshot::Cpu& saved = result->cpus[cpu];
+        saved.current = state.current;
+        saved.lastDispatched = state.lastDispatched;
+        saved.sliceStart = state.sliceStart;
+        saved.overheadEnd = state.overheadEnd;
+        saved.sliceEvent = state.sliceEvent;
+        saved.stats = state.stats;
+    }
+    const size_t queueCount = loadBalancing == LoadBalancing::GLOBAL_QUEUE ? 1 : cpus.size();
+    result->queues.resize(queueCount);
+    for (size_t queue = 0; queue < queueCount; ++queue) {
+        getRunQueue(static_cast<int>(queue)).collect(result->queues[queue]);
     }
     
-    cout << endl;
+    result->devices.resize(deviceCount);
+    for (size_t device = 0; device < deviceCount; ++device) {
+        const IoDevice& state = devices[device];
+        SchedulerSnapshot::Device& saved = result->devices[device];
+        saved.current = state.current;
+        for (size_t i = 0; i < state.queue.size(); ++i) {
+            saved.queue.push_back(state.queue[i]);
+        }
+        saved.stats = state.stats;
+    }
+    
+    auto pending = eventQueue;
+    result->events.reserve(pending.size());
+    while (!pending.empty()) {
+        result->events.push_back(pending.top());
+        pending.pop();
+    }
+    result->eventSequence = eventSequence;
+    result->balancePending = balancePending;
+    result->timerPending = timerPending;
+    result->busyCpus = busyCpus;
+    result->nextPlacementCpu = nextPlacementCpu;
+    result->arrivalCursor = arrivalCursor;
+    result->transientRows = transientRows;
+    result->freeRows = freeRows;
+    result->periodicTasks = periodicTasks;
+    result->releaseHorizon = activeHorizon;
+    result->totalProcesses = totalProcesses;
+    
+    result->completedProcesses = completedProcesses;
+    result->totalWaitingTime = totalWaitingTime;
+    result->totalTurnaroundTime = totalTurnaroundTime;
+    result->totalResponseTime = totalResponseTime;
+    result->contextSwitches = contextSwitches;
+    result->migrations = migrations;
+    result->overheadTime = overheadTime;
+    result->statistics = runStatistics;
+    savePolicyState(result->policyState);
+    return result;
 }
 
 /**
- * Validate Process Set Implementation
+ * Restore Snapshot Implementation
+ *
+ * Algorithm flow:
+ * 1. Adopt the snapshot's workload and start from a clean reset().
+ * 2. Copy the process table, CPU, device, event and statistics state.
+ * 3. Refill the ready queues in dispatch order and let the policy restore
+ *    (or rebuild) its own state.
+ * 4. Under another algorithm, give every running process a fresh slice of
+ *    the new policy and check for preemption at the snapshot time.
  */
-bool Scheduler::validateProcessSet() const {
-    if (processes.empty()) {
-        cerr << "Error: No processes to schedule" << endl;
+bool Scheduler::restore(const SchedulerSnapshot& source) {
+    if (source.cpus.size() != cpus.size() || source.loadBalancing != loadBalancing) {
+        cerr << "Error: A snapshot of " << source.cpus.size() << " CPUs ("
+             << loadBalancingToString(source.loadBalancing) << ") cannot be restored into "
+             << algorithmName << " with " << cpus.size() << " CPUs ("
+             << loadBalancingToString(loadBalancing) << ")" << endl;
+        return false;
+    }
+    if (arrivalSource) {
+        cerr << "Error: Cannot restore a snapshot into " << algorithmName << " while it streams arrivals" << endl;
+        return false;
+    }
+    if (processGroups) {
+        cerr << "Error: Cannot restore a snapshot into " << algorithmName << " with process groups" << endl;
         return false;
     }
     
-    // Check each process for validity
-    for (const auto& process : processes) {
-        if (!process) {
-            cerr << "Error: Null process found in process set" << endl;
-            return false;
+    const bool samePolicy = source.algorithm == algorithmName;
+    setWorkload(source.workload);
+    reset();
+    
+    table = source.table;
+    currentTime = source.time;
+    for (size_t cpu = 0; cpu < cpus.size(); ++cpu) {
+        const SchedulerSnapshot::Cpu& saved = source.cpus[cpu];
+        CpuState& state = cpus[cpu];
+        state.current = saved.current;
+        state.lastDispatched = saved.lastDispatched;
+        state.sliceStart = saved.sliceStart;
+        state.overheadEnd = saved.overheadEnd;
+        state.sliceEvent = saved.sliceEvent;
+        state.stats = saved.stats;
+    }
+    
+    if (devices.size() < source.devices.size()) {
+        devices.resize(source.devices.size());
+    }
+    for (size_t device = 0; device < source.devices.size(); ++device) {
+        const SchedulerSnapshot::Device& saved = source.devices[device];
+        devices[device].current = saved.current;
+        for (const auto& request : saved.queue) {
+            devices[device].queue.push_back(request);
         }
-        
-        if (process->burstTime <= 0) {
-            cerr << "Error: Process " << process->name << " has invalid burst time" << endl;
-            return false;
+        devices[device].stats = saved.stats;
+    }
+    deviceCount = source.devices.size();
+    
+    // Policy timers only make sense to the policy that set them
+    for (const SimulationEvent& event : source.events) {
+        if (event.type != EventType::TIMER || samePolicy) {
+            eventQueue.push(event);
         }
-        
-        if (process->arrivalTime < 0) {
-            cerr << "Error: Process " << process->name << " has negative arrival time" << endl;
-            return false;
+        if (event.type == EventType::RELEASE) {
+            pendingReleases++;
+        }
+    }
+    eventSequence = source.eventSequence;
+    balancePending = source.balancePending;
+    timerPending = samePolicy && source.timerPending;
+    busyCpus = source.busyCpus;
+    nextPlacementCpu = source.nextPlacementCpu;
+    arrivalCursor = source.arrivalCursor;
+    
+    // Released jobs live in transient rows, not in the arrival order
+    if (source.transientRows > 0) {
+        ProcessHandle firstJob = static_cast<ProcessHandle>(workload->size() - source.transientRows);
+        arrivalOrder.erase(remove_if(arrivalOrder.begin(), arrivalOrder.end(),
+                                     [firstJob](ProcessHandle process) { return process >= firstJob; }),
+                           arrivalOrder.end());
+    }
+    transientRows = source.transientRows;
+    freeRows = source.freeRows;
+    periodicTasks = source.periodicTasks;
+    activeHorizon = source.releaseHorizon;
+    totalProcesses = source.totalProcesses;
+    
+    completedProcesses = source.completedProcesses;
+    totalWaitingTime = source.totalWaitingTime;
+    totalTurnaroundTime = source.totalTurnaroundTime;
+    totalResponseTime = source.totalResponseTime;
+    contextSwitches = source.contextSwitches;
+    migrations = source.migrations;
+    overheadTime = source.overheadTime;
+    runStatistics = source.statistics;
+    
+    for (size_t queue = 0; queue < source.queues.size(); ++queue) {
+        ReadyQueue& target = getRunQueue(static_cast<int>(queue));
+        for (ProcessHandle process : source.queues[queue]) {
+            target.push(process);
+        }
+    }
+    restorePolicyState(source, samePolicy);
+    
+    if (!samePolicy) {
+        for (int cpu = 0; cpu < static_cast<int>(cpus.size()); ++cpu) {
+            if (cpus[cpu].current == INVALID_PROCESS) continue;
+            accountRunningTime(cpu);
+            beginTimeSlice(cpu);
+        }
+        if (isPreemptive && busyCpus > 0) {
+            checkPreemption();
         }
     }
     
+    paused = true;
+    if (isTraceEnabled()) {
+        trace() << "Time " << currentTime << ": " << algorithmName << " continues from a snapshot of "
+                << source.algorithm << '\n';
+    }
     return true;
 }
 
 /**
- * Calculate Statistics Implementation
+ * Reset Scheduler State Implementation
+ * Prepares scheduler for a fresh simulation run
  */
-void Scheduler::calculateStatistics() {
+void Scheduler::reset() {
+    // Reset timing
+    currentTime = 0;
+    
+    // Clear ready queues and CPUs
+    readyQueue->clear();
+    for (CpuState& cpu : cpus) {
+        cpu.current = INVALID_PROCESS;
+        cpu.lastDispatched = INVALID_PROCESS;
+        cpu.sliceStart = 0;
+        cpu.overheadEnd = 0;
+        cpu.sliceEvent = -1;
+        cpu.stats = CpuStatistics();
+        if (cpu.runQueue) {
+            cpu.runQueue->clear();
+        }
+    }
+    if (processGroups) {
+        processGroups->reset(static_cast<int>(cpus.size()));
+    }
+    busyCpus = 0;
+    nextPlacementCpu = 0;
+    paused = false;
+    profile.clear();
+    for (IoDevice& device : devices) {
+        device.current = INVALID_PROCESS;
+        device.queue.clear();
+        device.stats = IoDeviceStatistics();
+    }
+    deviceCount = 0;
+    
+    // Clear pending events
+    while (!eventQueue.empty()) {
+        eventQueue.pop();
+    }
+    eventSequence = 0;
+    balancePending = false;
+    timerPending = false;
+    arrivalCursor = 0;
+    periodicTasks.clear();
+    pendingReleases = 0;
+    
+    // Streamed processes that were not retained leave with their run; the
+    // source starts over so the run can be repeated
+    releaseTransientRows();
+    transientArrivals = 0;
+    if (arrivalSource && !retainStreamed) {
+        arrivalSource->rewind();
+    }
+    
+    // Make sure the arrival order covers every process
+    if (!arrivalOrderValid) {
+        sortProcessesByArrivalTime();
+    }
+    
+    // Periodic processes release jobs for one hyperperiod unless told otherwise
+    activeHorizon = releaseHorizon;
+    if (activeHorizon == 0 && workload && workload->hasDeadlines()) {
+        SimTime latestRelease = 0;
+        SimTime longestPeriod = 0;
+        for (ProcessHandle process = 0; process < workload->period.size(); ++process) {
+            if (workload->period[process] == 0) continue;
+            latestRelease = max(latestRelease, workload->arrivalTime[process]);
+            longestPeriod = max<SimTime>(longestPeriod, workload->period[process]);
+        }
+        if (longestPeriod > 0) {
+            SimTime limit = AUTOMATIC_HORIZON_PERIODS * longestPeriod;
+            SimTime hyperperiod = getHyperperiod(*workload, limit);
+            activeHorizon = latestRelease + (hyperperiod > 0 ? hyperperiod : limit);
+        }
+    }
+    
+    // Reset statistics
+    completedProcesses = 0;
     totalWaitingTime = 0.0;
     totalTurnaroundTime = 0.0;
     totalResponseTime = 0.0;
+    contextSwitches = 0;
+    migrations = 0;
+    overheadTime = 0;
+    cutOff = false;
+    runStatistics.clear();
     
-    for (const auto& process : processes) {
-        totalWaitingTime += process->waitingTime;
-        totalTurnaroundTime += process->turnaroundTime;
-        totalResponseTime += process->responseTime;
+    // Reset all process states
+    resetProcessStates();
+    
+    if (isTraceEnabled()) {
+        trace() << "Scheduler state reset for " << algorithmName << '\n';
     }
 }
 
 /**
- * Reset Process States Implementation
+ * Clear All Processes Implementation
  */
-void Scheduler::resetProcessStates() {
-    for (auto& process : processes) {
-        process->reset();
+void Scheduler::clearProcesses() {
+    workload.reset();
+    localWorkload.reset();
+    table.bind(nullptr);
+    transientRows = 0;
+    freeRows.clear();
+    arrivalOrder.clear();
+    arrivalOrderValid = true;
+    totalProcesses = 0;
+    reset();
+    if (verbosity >= Verbosity::NORMAL) {
+        cout << "All processes cleared from " << algorithmName << " scheduler" << endl;
     }
 }
 
 /**
- * Sort Processes by Arrival Time Implementation
+ * Get Process Count Implementation
  */
-void Scheduler::sortProcessesByArrivalTime() {
-    sort(processes.begin(), processes.end(), 
-         [](const shared_ptr<Process>& a, const shared_ptr<Process>& b) {
-             return a->arrivalTime < b->arrivalTime;
-         });
+size_t Scheduler::getProcessCount() const {
+    return workload ? workload->size() : 0;
 }
 
 /**
- * Get Ready Queue Size Implementation
+ * Is Preemptive Algorithm Implementation
  */
-size_t Scheduler::getReadyQueueSize() const {
-    return readyQueue.size();
+bool Scheduler::isPreemptiveAlgorithm() const {
+    return isPreemptive;
 }
 
 /**
- * Is System Idle Implementation
+ * Set Ready Queue Kind Implementation
  */
-bool Scheduler::isSystemIdle() const {
-    return (!currentProcess && readyQueue.empty());
+void Scheduler::setReadyQueueKind(ReadyQueueKind kind) {
+    readyQueueKind = kind;
+    rebuildReadyQueues();
 }
 
-// ========================================================================================
-// PRIVATE UTILITY METHOD IMPLEMENTATIONS
-// ========================================================================================
+/**
+ * Get Ready Queue Kind Implementation
+ */
+ReadyQueueKind Scheduler::getReadyQueueKind() const {
+    return readyQueueKind;
+}
 
 /**
- * Initialize Statistics Implementation
+ * Set CPU Count Implementation
  */
-void Scheduler::initializeStatistics() {
-    totalWaitingTime = 0.0;
-    totalTurnaroundTime = 0.0;
-    totalResponseTime = 0.0;
-    completedProcesses = 0;
+void Scheduler::setCpuCount(int count) {
+    if (count < 1 || count > 256) {
+        cerr << "Warning: CPU count must be between 1 and 256. Using "
+             << (count < 1 ? 1 : 256) << "." << endl;
+        count = count < 1 ? 1 : 256;
+    }
+    cpus.resize(static_cast<size_t>(count));
+    rebuildCpus();
+}
+
+/**
+ * Get CPU Count Implementation
+ */
+int Scheduler::getCpuCount() const {
+    return static_cast<int>(cpus.size());
+}
+
+/**
+ * Set Load Balancing Implementation
+ */
+void Scheduler::setLoadBalancing(LoadBalancing strategy, SimTime interval) {
+    if (interval <= 0) {
+        cerr << "Warning: Balancing interval must be positive. Using 10." << endl;
+        interval = 10;
+    }
+    loadBalancing = strategy;
+    balanceInterval = interval;
+    rebuildCpus();
+}
+
+/**
+ * Get Load Balancing Implementation
+ */
+LoadBalancing Scheduler::getLoadBalancing() const {
+    return loadBalancing;
+}
+
+/**
+ * Set Dispatch Costs Implementation
+ */
+void Scheduler::setDispatchCosts(const DispatchCosts& costs) {
+    dispatchCosts = costs;
+    for (SimTime* cost : {&dispatchCosts.contextSwitch, &dispatchCosts.cacheWarmup, &dispatchCosts.migration}) {
+        if (*cost < 0) {
+            cerr << "Warning: Dispatch cost " << *cost << " is negative. Using 0." << endl;
+            *cost = 0;
+        }
+    }
+}
+
+/**
+ * Get Dispatch Costs Implementation
+ */
+const DispatchCosts& Scheduler::getDispatchCosts() const {
+    return dispatchCosts;
+}
+
+/**
+ * Get CPU Statistics Implementation
+ */
+vector<CpuStatistics> Scheduler::getCpuStatistics() const {
+    vector<CpuStatistics> result;
+    result.reserve(cpus.size());
+    for (const CpuState& cpu : cpus) {
+        CpuStatistics stats = cpu.stats;
+        stats.utilisation = currentTime > 0 ? static_cast<double>(stats.busyTime) / currentTime : 0.0;
+        result.push_back(stats);
+    }
+    return result;
+}
+
+/**
+ * Print CPU Statistics Implementation
+ */
+void Scheduler::printCpuStatistics() const {
+    cout << "\n=== " << algorithmName << " CPU Statistics (" << cpus.size() << " CPUs, "
+         << loadBalancingToString(loadBalancing) << ") ===" << endl;
+    cout << setw(5) << "CPU"
+         << setw(10) << "Busy"
+         << setw(13) << "Utilisation"
+         << setw(12) << "Dispatches"
+         << setw(10) << "Switches"
+         << setw(12) << "Migrations"
+         << setw(10) << "Overhead" << endl;
+    cout << string(72, '-') << endl;
+    
+    vector<CpuStatistics> stats = getCpuStatistics();
+    for (size_t i = 0; i < stats.size(); ++i) {
+        cout << setw(5) << i
+             << setw(10) << stats[i].busyTime
+             << setw(12) << fixed << setprecision(1) << stats[i].utilisation * 100.0 << "%"
+             << setw(12) << stats[i].dispatches
+             << setw(10) << stats[i].contextSwitches
+             << setw(12) << stats[i].migrations
+             << setw(10) << stats[i].overheadTime << endl;
+    }
+    cout << string(72, '-') << endl;
+    cout << "Total migrations: " << migrations << endl;
+}
+
+/**
+ * Get I/O Device Statistics Implementation
+ */
+vector<IoDeviceStatistics> Scheduler::getDeviceStatistics() const {
+    vector<IoDeviceStatistics> result;
+    result.reserve(deviceCount);
+    for (size_t index = 0; index < deviceCount; ++index) {
+        IoDeviceStatistics stats = devices[index].stats;
+        stats.utilisation = currentTime > 0 ? static_cast<double>(stats.busyTime) / currentTime : 0.0;
+        result.push_back(stats);
+    }
+    return result;
+}
+
+/**
+ * Print I/O Device Statistics Implementation
+ */
+void Scheduler::printDeviceStatistics() const {
+    cout << "\n=== " << algorithmName << " I/O Device Statistics (" << deviceCount
+         << (deviceCount == 1 ? " device" : " devices") << ") ===" << endl;
+    cout << setw(7) << "Device"
+         << setw(10) << "Busy"
+         << setw(13) << "Utilisation"
+         << setw(10) << "Requests"
+         << setw(12) << "Avg Queue"
+         << setw(10) << "Max Queue" << endl;
+    cout << string(62, '-') << endl;
+    
+    vector<IoDeviceStatistics> stats = getDeviceStatistics();
+    for (size_t i = 0; i < stats.size(); ++i) {
+        cout << setw(7) << i
+             << setw(10) << stats[i].busyTime
+             << setw(12) << fixed << setprecision(1) << stats[i].utilisation * 100.0 << "%"
+             << setw(10) << stats[i].requests
+             << setw(12) << setprecision(2)
+             << (stats[i].requests > 0 ? static_cast<double>(stats[i].queueingTime) / stats[i].requests : 0.0)
+             << setw(10) << stats[i].maxQueueLength << endl;
+    }
+    cout << string(62, '-') << endl;
+}
+
+/**
+ * Set Verbosity Implementation
+ */
+void Scheduler::setVerbosity(Verbosity level) {
+    verbosity = level;
+}
+
+/**
+ * Get Verbosity Implementation
+ */
+Verbosity Scheduler::getVerbosity() const {
+    return verbosity;
+}
+
+/**
+ * Set Default Verbosity Implementation
+ */
+void Scheduler::setDefaultVerbosity(Verbosity level) {
+    defaultVerbosity = level;
+}
+
+/**
+ * Set Trace Sink Implementation
+ */
+void Scheduler::setTraceSink(shared_ptr<TraceSink> sink) {
+    traceSink = std::move(sink);
+}
+
+/**
+ * Set Trace Recorder Implementation
+ */
+void Scheduler::setTraceRecorder(shared_ptr<TraceRecorder> recorder) {
+    traceRecorder = std::move(recorder);
+}
+
+/**
+ * Get Trace Recorder Implementation
+ */
+shared_ptr<TraceRecorder> Scheduler::getTraceRecorder() const {
+    return traceRecorder;
+}
+
+/**
+ * Set Results Writer Implementation
+ */
+void Scheduler::setResultsWriter(shared_ptr<ResultsWriter> writer) {
+    resultsWriter = std::move(writer);
+}
+
+/**
+ * Get Results Writer Implementation
+ */
+shared_ptr<ResultsWriter> Scheduler::getResultsWriter() const {
+    return resultsWriter;
+}
+
+/**
+ * Set Process Groups Implementation
+ * The old group tree stays alive until the queues registered with it are gone
+ */
+void Scheduler::setProcessGroups(shared_ptr<const GroupHierarchy> hierarchy) {
+    unique_ptr<ProcessGroups> previous = std::move(processGroups);
+    if (hierarchy) {
+        processGroups = make_unique<ProcessGroups>(std::move(hierarchy), table, currentTime);
+        processGroups->setRefillCallback([this](SimTime time, uint32_t node) {
+            scheduleEvent(time, EventType::REFILL, INVALID_PROCESS, static_cast<int>(node));
+        });
+    }
+    rebuildReadyQueues();
+}
+
+/**
+ * Get Process Groups Implementation
+ */
+shared_ptr<const GroupHierarchy> Scheduler::getProcessGroups() const {
+    return processGroups ? processGroups->getHierarchy() : nullptr;
+}
+
+/**
+ * Get Group Statistics Implementation
+ */
+vector<GroupStatistics> Scheduler::getGroupStatistics() const {
+    if (!processGroups) {
+        return {};
+    }
+    return processGroups->getStatistics(getTotalExecutionTime(), static_cast<int>(cpus.size()));
+}
+
+/**
+ * Print Group Statistics Implementation
+ */
+void Scheduler::printGroupStatistics() const {
+    vector<GroupStatistics> groups = getGroupStatistics();
+    if (groups.empty()) {
+        return;
+    }
+    
+    cout << "=== " << algorithmName << " Group Statistics ===" << endl;
+    cout << left << setw(20) << "Group" << right << setw(8) << "Weight" << setw(12) << "Quota"
+         << setw(10) << "CPU Time" << setw(8) << "Util%" << setw(11) << "Throttled"
+         << setw(10) << "Throttles" << setw(7) << "Done" << setw(10) << "Avg Wait"
+         << setw(8) << "p99" << setw(10) << "Avg Resp" << setw(8) << "p99" << endl;
+    cout << string(122, '-') << endl;
+    for (const GroupStatistics& group : groups) {
+        string name = group.path.empty() ? string("(root)")
+                                         : string(2 * (group.depth - 1), ' ') +
+                                           group.path.substr(group.path.rfind('/') + 1);
+        string quota = group.quota > 0 ? to_string(group.quota) + "/" + to_string(group.period) : "-";
+        cout << left << setw(20) << name << right
+             << setw(8) << group.weight
+             << setw(12) << quota
+             << setw(10) << group.runTime
+             << setw(8) << fixed << setprecision(1) << 100.0 * group.utilisation
+             << setw(11) << group.throttledTime
+             << setw(10) << group.throttles
+             << setw(7) << group.waiting.getCount()
+             << setw(10) << setprecision(2) << group.waiting.getMean()
+             << setw(8) << group.waiting.getPercentile(99)
+             << setw(10) << group.response.getMean()
+             << setw(8) << group.response.getPercentile(99) << endl;
+    }
+}
+
+/**
+ * Get Trace Sink Implementation
+ */
+TraceSink& Scheduler::trace() {
+    if (!traceSink) {
+        traceSink = make_shared<TraceSink>(cout);
+    }
+    return *traceSink;
+}
+
+/**
+ * Trace Event Prefix Implementation
+ */
+TraceSink& Scheduler::traceEvent(int cpu) {
+    TraceSink& sink = trace();
+    sink << "Time " << currentTime << ": ";
+    if (cpus.size() > 1) {
+        sink << "[CPU " << cpu << "] ";
+    }
+    return sink;
+}
+
+// ========================================================================================
+// PROTECTED HELPER METHOD IMPLEMENTATIONS
+// ========================================================================================
+
+/**
+ * Check for Process Arrivals Implementation
+ * Advances the arrival cursor over the sorted handles, merging in due
+ * processes from the streaming source (if any) in arrival order
+ */
+void Scheduler::checkArrivals() {
+    while (true) {
+        bool preloadedDue = arrivalCursor < arrivalOrder.size() &&
+                            table.arrivalTime(arrivalOrder[arrivalCursor]) <= currentTime;
+        bool streamedDue = arrivalSource && arrivalSource->hasNext() &&
+                           arrivalSource->peekArrivalTime() <= currentTime;
+        
+        ProcessHandle arrived;
+        if (streamedDue && (!preloadedDue ||
+                            arrivalSource->peekArrivalTime() < table.arrivalTime(arrivalOrder[arrivalCursor]))) {
+            ProcessSpec spec;
+            arrivalSource->next(spec);
+            
+            if (retainStreamed) {
+                ProcessHandle handle = getMutableWorkload().add(spec);
+                if (handle == INVALID_PROCESS) {
+                    continue;
+                }
+                
+                // Streamed processes are retained at the cursor so the order stays
+                // sorted and later runs replay them like preloaded ones
+                table.syncSize();
+                arrivalOrder.insert(arrivalOrder.begin() + arrivalCursor, handle);
+                totalProcesses++;
+                arrived = arrivalOrder[arrivalCursor++];
+            } else {
+                arrived = admitTransientProcess(spec);
+                if (arrived == INVALID_PROCESS) {
+                    continue;
+                }
+                transientArrivals++;
+            }
+        } else if (preloadedDue) {
+            arrived = arrivalOrder[arrivalCursor++];
+        } else {
+            break;
+        }
+        PROFILE_COUNT(ProfileCounter::ARRIVALS);
+        
+        if (traceRecorder) {
+            traceRecorder->record(table.arrivalTime(arrived), table.pid(arrived), TraceEventType::ARRIVAL);
+        }
+        if (table.period(arrived) > 0) {
+            admitPeriodicTask(arrived);
+        }
+        addToReadyQueue(arrived);
+    }
+}
+
+/**
+ * Admit Periodic Task Implementation
+ * The template is copied out of the row, which may be reused once the
+ * process terminates
+ */
+void Scheduler::admitPeriodicTask(ProcessHandle process) {
+    SimTime nextRelease = table.arrivalTime(process) + table.period(process);
+    if (nextRelease >= activeHorizon) {
+        return;
+    }
+    
+    ProcessSpec job;
+    job.name = string(table.name(process));
+    job.burstTime = table.burstTime(process);
+    job.priority = table.priority(process);
+    job.period = table.period(process);
+    job.relativeDeadline = table.relativeDeadline(process);
+    job.group = string(workload->groupPath(table.group(process)));
+    for (size_t i = 0; i < workload->ioCount(process); ++i) {
+        job.ioBursts.push_back(workload->ioBurst(process, i));
+    }
+    periodicTasks.push_back(std::move(job));
+    scheduleEvent(nextRelease, EventType::RELEASE, INVALID_PROCESS, static_cast<int>(periodicTasks.size() - 1));
+    pendingReleases++;
+}
+
+/**
+ * Release Job Implementation
+ */
+void Scheduler::releaseJob(int task) {
+    pendingReleases--;
+    ProcessSpec& job = periodicTasks[task];
+    job.arrivalTime = currentTime;
+    ProcessHandle released = admitTransientProcess(job);
+    if (released != INVALID_PROCESS) {
+        PROFILE_COUNT(ProfileCounter::ARRIVALS);
+        if (traceRecorder) {
+            traceRecorder->record(currentTime, table.pid(released), TraceEventType::ARRIVAL);
+        }
+        addToReadyQueue(released);
+    }
+    
+    SimTime nextRelease = currentTime + job.period;
+    if (nextRelease < activeHorizon) {
+        scheduleEvent(nextRelease, EventType::RELEASE, INVALID_PROCESS, task);
+        pendingReleases++;
+    }
+}
+
+/**
+ * Has Pending Arrivals Implementation
+ */
+bool Scheduler::hasPendingArrivals() const {
+    return arrivalCursor < arrivalOrder.size() || (arrivalSource && arrivalSource->hasNext());
+}
+
+/**
+ * Get Next Arrival Time Implementation
+ */
+SimTime Scheduler::getNextArrivalTime() const {
+    bool hasPreloaded = arrivalCursor < arrivalOrder.size();
+    bool hasStreamed = arrivalSource && arrivalSource->hasNext();
+    
+    if (hasPreloaded && hasStreamed) {
+        return min(table.arrivalTime(arrivalOrder[arrivalCursor]), arrivalSource->peekArrivalTime());
+    }
+    if (hasPreloaded) {
+        return table.arrivalTime(arrivalOrder[arrivalCursor]);
+    }
+    return hasStreamed ? arrivalSource->peekArrivalTime() : currentTime;
+}
+
+/**
+ * Check All Processes Completed Implementation
+ */
+bool Scheduler::allProcessesCompleted() const {
+    return !hasPendingArrivals() && pendingReleases == 0 && completedProcesses >= totalProcesses;
+}
+
+/**
+ * Get Run Queue Implementation
+ */
+ReadyQueue& Scheduler::getRunQueue(int cpu) {
+    return *cpus[cpu].queue;
+}
+
+const ReadyQueue& Scheduler::getRunQueue(int cpu) const {
+    return *cpus[cpu].queue;
+}
+
+/**
+ * Get Policy Queue Implementation
+ */
+ReadyQueue& Scheduler::getPolicyQueue(int cpu) {
+    if (!processGroups) {
+        return *cpus[cpu].queue;
+    }
+    return static_cast<GroupReadyQueue*>(cpus[cpu].queue)->getSelectedQueue();
+}
+
+ReadyQueue& Scheduler::getPolicyQueue(int cpu, ProcessHandle process) const {
+    if (!processGroups) {
+        return *cpus[cpu].queue;
+    }
+    return static_cast<GroupReadyQueue*>(cpus[cpu].queue)->getGroupQueue(process);
+}
+
+/**
+ * For Each Policy Queue Implementation
+ */
+void Scheduler::forEachPolicyQueue(int cpu, const function<void(ReadyQueue&)>& visit) {
+    if (!processGroups) {
+        visit(*cpus[cpu].queue);
+        return;
+    }
+    static_cast<GroupReadyQueue*>(cpus[cpu].queue)->forEachGroupQueue(visit);
+}
+
+/**
+ * Get Next Ready Process Implementation
+ */
+ProcessHandle Scheduler::getNextReadyProcess(int cpu) const {
+    return getRunQueue(cpu).top();
+}
+
+/**
+ * Remove Process from Ready Queue Implementation
+ */
+ProcessHandle Scheduler::removeFromReadyQueue(int cpu) {
+    return getRunQueue(cpu).pop();
+}
+
+/**
+ * Add Process to Ready Queue Implementation
+ * Processes without a CPU are placed on the CPUs in turn (all CPUs share
+ * one queue under GLOBAL_QUEUE)
+ */
+void Scheduler::addToReadyQueue(ProcessHandle process, int cpu) {
+    if (process != INVALID_PROCESS && table.state[process] != ProcessState::TERMINATED) {
+        table.state[process] = ProcessState::READY;
+        table.readyTime[process] = currentTime;
+        if (cpu < 0) {
+            cpu = nextPlacementCpu;
+            if (++nextPlacementCpu == static_cast<int>(cpus.size())) {
+                nextPlacementCpu = 0;
+            }
+        }
+        cpus[cpu].queue->push(process);
+        PROFILE_HIGH_WATER(readyQueueHighWater, cpus[cpu].queue->size());
+    }
+}
+
+/**
+ * Start Process Execution Implementation
+ */
+void Scheduler::startProcessExecution(ProcessHandle process, int cpu) {
+    if (process == INVALID_PROCESS) return;
+    
+    CpuState& state = cpus[cpu];
+    state.current = process;
+    state.stats.dispatches++;
+    busyCpus++;
+    table.state[process] = ProcessState::RUNNING;
+    
+    // Migrations only exist on multiprocessors; a uniprocessor skips the extra column
+    if (cpus.size() > 1) {
+        if (table.lastCpu[process] >= 0 && table.lastCpu[process] != cpu) {
+            state.stats.migrations++;
+            migrations++;
+        }
+        table.lastCpu[process] = static_cast<int16_t>(cpu);
+    }
+    if (traceRecorder) {
+        traceRecorder->record(currentTime, table.pid(process), TraceEventType::DISPATCH,
+                              static_cast<uint8_t>(cpu));
+    }
+    
+    // Lazy waiting time: charge the whole stay in the ready queue at once
+    if (table.readyTime[process] >= 0) {
+        SimTime waited = currentTime - table.readyTime[process];
+        table.waitingTime[process] += waited;
+        table.readyTime[process] = -1;
+        totalWaitingTime += waited;
+    }
+    
+    // Record start time (response time follows from it) if first execution
+    if (!table.hasStarted(process)) {
+        table.startTime[process] = currentTime;
+        totalResponseTime += table.responseTime(process);
+    }
+}
+
+/**
+ * Complete Process Execution Implementation
+ */
+void Scheduler::completeProcessExecution(ProcessHandle process) {
+    if (process == INVALID_PROCESS) return;
+    PROFILE_SCOPE(ProfilePhase::STATISTICS);
+    
+    table.state[process] = ProcessState::TERMINATED;
+    table.remainingTime[process] = 0;
+    table.completionTime[process] = currentTime;
+    completedProcesses++;
+    runStatistics.recordCompletion(table.priority(process), currentTime, table.waitingTime[process],
+                                   table.turnaroundTime(process), table.responseTime(process));
+    if (table.relativeDeadline(process) > 0) {
+        runStatistics.recordDeadline(currentTime - table.absoluteDeadline(process));
+    }
+    if (processGroups) {
+        processGroups->recordCompletion(process, table.waitingTime[process], table.responseTime(process),
+                                        table.turnaroundTime(process));
+    }
+    if (resultsWriter) {
+        resultsWriter->record({table.pid(process), table.arrivalTime(process), table.startTime[process],
+                               currentTime, table.waitingTime[process], table.turnaroundTime(process),
+                               table.responseTime(process)});
+    }
+    int cpu = cpus.size() > 1 && table.lastCpu[process] >= 0 ? table.lastCpu[process] : 0;
+    if (traceRecorder) {
+        traceRecorder->record(currentTime, table.pid(process), TraceEventType::COMPLETE,
+                              static_cast<uint8_t>(cpu));
+    }
+    totalTurnaroundTime += table.turnaroundTime(process);
+    
+    // Free the CPU if the completed process was running on it
+    if (cpus[cpu].current == process) {
+        if (processGroups) {
+            processGroups->release(cpu);
+        }
+        cpus[cpu].current = INVALID_PROCESS;
+        busyCpus--;
+    }
+    
+    // A non-retained streamed process hands its row to a later arrival; CPUs it
+    // ran on last must still see the row's next process as a different one
+    if (transientRows > 0 && process >= table.size() - transientRows && workload->ioCount(process) == 0) {
+        freeRows.push_back(process);
+        for (CpuState& state : cpus) {
+            if (state.lastDispatched == process) {
+                state.lastDispatched = RETIRED_PROCESS;
+            }
+        }
+    }
+}
+
+/**
+ * Preempt Current Process Implementation
+ */
+void Scheduler::preemptCurrentProcess(int cpu) {
+    ProcessHandle process = cpus[cpu].current;
+    if (process != INVALID_PROCESS && table.remainingTime[process] > 0) {
+        if (traceRecorder) {
+            traceRecorder->record(currentTime, table.pid(process), TraceEventType::PREEMPT,
+                                  static_cast<uint8_t>(cpu));
+        }
+        if (processGroups) {
+            processGroups->release(cpu);
+        }
+        cpus[cpu].current = INVALID_PROCESS;
+        cpus[cpu].sliceEvent = -1;
+        busyCpus--;
+        addToReadyQueue(process, cpu);
+    }
+}
+
+/**
+ * Execute Time Slice Implementation
+ */
+bool Scheduler::executeTimeSlice() {
+    ProcessHandle currentProcess = cpus[0].current;
+    if (currentProcess == INVALID_PROCESS) return false;
+    
+    // Execute for one time unit
+    table.remainingTime[currentProcess]--;
+    cpus[0].stats.busyTime++;
+    
+    // Check if process completed
+    if (table.remainingTime[currentProcess] <= 0) {
+        completeProcessExecution(currentProcess);
+        return true;  // Process completed
+    }
+    
+    return false;  // Process still running
+}
+
+/**
+ * Print Execution Step Implementation
+ */
+void Scheduler::printExecutionStep(const string& action) {
+    if (!isTraceEnabled()) return;
+    
+    string time = to_string(currentTime);
+    trace() << "Time " << string(time.size() < 3 ? 3 - time.size() : 0, ' ') << time << ": " << action;
+    
+    ProcessHandle currentProcess = cpus[0].current;
+    if (currentProcess != INVALID_PROCESS) {
+        trace() << " (Process " << table.name(currentProcess) 
+                << ", remaining: " << table.remainingTime[currentProcess] << ")";
+    }
+    
+    trace() << '\n';
+}
+
+/**
+ * Validate Process Set Implementation
+ */
+bool Scheduler::validateProcessSet() const {
+    if (getProcessCount() == 0 && !(arrivalSource && arrivalSource->hasNext())) {
+        cerr << "Error: No processes to schedule" << endl;
+        return false;
+    }
+    
+    // Check every process for validity in one pass over the columns
+    size_t count = getProcessCount();
+    size_t process = count > 0 ? findInvalidProcess(workload->arrivalTime.data(), workload->burstTime.data(), count) : 0;
+    if (process < count) {
+        if (workload->burstTime[process] <= 0) {
+            cerr << "Error: Process " << workload->name(process) << " has invalid burst time" << endl;
+        } else {
+            cerr << "Error: Process " << workload->name(process) << " has negative arrival time" << endl;
+        }
+        return false;
+    }
+    
+    return true;
+}
+
+/**
+ * Calculate Statistics Implementation
+ */
+void Scheduler::calculateStatistics() {
+    // Reused rows no longer hold every process; the running totals do
+    if (transientRows > 0) {
+        return;
+    }
+    
+    // Exact integer sums over the columns, so the result does not depend on the
+    // order the vector lanes add up in
+    ProcessMetricTotals totals;
+    if (table.size() > 0) {
+        totals = sumProcessMetrics(workload->arrivalTime.data(), table.startTime.data(),
+                                   table.completionTime.data(), table.waitingTime.data(), table.size());
+    }
+    totalWaitingTime = static_cast<double>(totals.waiting);
+    totalTurnaroundTime = static_cast<double>(totals.turnaround);
+    totalResponseTime = static_cast<double>(totals.response);
+}
+
+/**
+ * Reset Process States Implementation
+ */
+void Scheduler::resetProcessStates() {
+    table.reset();
+}
+
+// ========================================================================================
+// DISCRETE-EVENT ENGINE IMPLEMENTATION
+// ========================================================================================
+
+/**
+ * Select Next Process Implementation
+ * Default selection: the best process according to the ready queue ordering
+ */
+ProcessHandle Scheduler::selectNextProcess(int cpu) {
+    return removeFromReadyQueue(cpu);
+}
+
+/**
+ * Get Time Slice Implementation
+ * Non-preemptive default: run the remaining burst to completion
+ */
+int Scheduler::getTimeSlice(ProcessHandle process) const {
+    return table.remainingTime[process];
+}
+
+/**
+ * Get Dispatch Message Implementation
+ */
+string Scheduler::getDispatchMessage(ProcessHandle process) const {
+    return "Process " + string(table.name(process)) + " started";
+}
+
+/**
+ * Should Preempt Implementation
+ * With process groups only the group's policy queue knows the order; the
+ * shared group queue of per-CPU strategies never holds processes
+ */
+bool Scheduler::shouldPreempt(ProcessHandle running, ProcessHandle candidate, int cpu) const {
+    return getPolicyQueue(cpu, running).outranks(candidate, running);
+}
+
+/**
+ * On Quantum Expired Implementation
+ */
+void Scheduler::onQuantumExpired(ProcessHandle, int) {}
+
+/**
+ * On Process Blocked Implementation
+ */
+void Scheduler::onProcessBlocked(ProcessHandle, int) {}
+
+/**
+ * On Process Recycled Implementation
+ */
+void Scheduler::onProcessRecycled(ProcessHandle) {}
+
+/**
+ * Get Timer Interval Implementation
+ */
+SimTime Scheduler::getTimerInterval() const {
+    return 0;
+}
+
+/**
+ * On Timer Implementation
+ */
+void Scheduler::onTimer() {}
+
+/**
+ * Create Run Queue Implementation
+ */
+unique_ptr<ReadyQueue> Scheduler::createRunQueue(ReadyQueueOrder order) {
+    return createReadyQueue(readyQueueKind, order, table);
+}
+
+/**
+ * Save Policy State Implementation
+ * Policies without state of their own save nothing
+ */
+void Scheduler::savePolicyState(vector<int64_t>&) const {}
+
+/**
+ * Restore Policy State Implementation
+ */
+void Scheduler::restorePolicyState(const SchedulerSnapshot&, bool) {}
+
+/**
+ * Rebuild Ready Queues Implementation
+ */
+void Scheduler::rebuildReadyQueues() {
+    readyQueue = makeRunQueue(readyQueue->getOrder());
+    rebuildCpus();
+}
+
+/**
+ * Schedule Event Implementation
+ */
+void Scheduler::scheduleEvent(SimTime time, EventType type, ProcessHandle process, int cpu) {
+    eventQueue.push({time, type, process, cpu, eventSequence++});
+    PROFILE_HIGH_WATER(eventQueueHighWater, eventQueue.size());
+}
+
+/**
+ * Account Running Time Implementation
+ */
+void Scheduler::accountRunningTime(int cpu) {
+    CpuState& state = cpus[cpu];
+    if (state.current == INVALID_PROCESS) return;
+    
+    // Overhead still ahead of the slice start is busy time without progress
+    if (state.overheadEnd > state.sliceStart) {
+        SimTime overhead = min(currentTime, state.overheadEnd) - state.sliceStart;
+        state.stats.busyTime += overhead;
+        state.stats.overheadTime += overhead;
+        overheadTime += overhead;
+        state.sliceStart += overhead;
+    }
+    
+    SimTime elapsed = currentTime - state.sliceStart;
+    table.remainingTime[state.current] -= static_cast<int>(elapsed);
+    state.stats.busyTime += elapsed;
+    state.sliceStart = currentTime;
+    
+    // Groups pay for the time in virtual runtime and quota
+    if (processGroups && elapsed > 0) {
+        processGroups->charge(cpu, state.current, elapsed);
+        static_cast<GroupReadyQueue*>(state.queue)->charge(state.current, elapsed);
+    }
+}
+
+/**
+ * Complete I/O Implementation
+ * The process returns to the run queue of the CPU it last ran on
+ */
+void Scheduler::completeIo(int deviceIndex) {
+    IoDevice& device = devices[deviceIndex];
+    ProcessHandle process = device.current;
+    device.current = INVALID_PROCESS;
+    
+    table.advanceIo(process);
+    if (isTraceEnabled()) {
+        trace() << "Time " << currentTime << ": Process " << table.name(process)
+                << " finished I/O on device " << deviceIndex << '\n';
+    }
+    if (traceRecorder) {
+        traceRecorder->record(currentTime, table.pid(process), TraceEventType::WAKEUP,
+                              static_cast<uint8_t>(deviceIndex));
+    }
+    addToReadyQueue(process, cpus.size() > 1 ? table.lastCpu[process] : 0);
+    
+    if (!device.queue.empty()) {
+        auto [next, joined] = device.queue.front();
+        device.queue.pop_front();
+        device.stats.queueingTime += currentTime - joined;
+        startIo(deviceIndex, next);
+    }
+}
+
+/**
+ * Start I/O Implementation
+ */
+void Scheduler::startIo(int deviceIndex, ProcessHandle process) {
+    IoDevice& device = devices[deviceIndex];
+    int duration = workload->ioBurst(process, table.ioCursor[process]).duration;
+    device.current = process;
+    device.stats.requests++;
+    device.stats.busyTime += duration;
+    scheduleEvent(currentTime + duration, EventType::IO_COMPLETION, process, deviceIndex);
+}
+
+/**
+ * Balance Run Queues Implementation
+ * Load is the run queue length plus the running process. Moved processes keep
+ * their ready-enter stamp, so the move does not change their waiting time.
+ */
+void Scheduler::balanceRunQueues() {
+    auto load = [this](const CpuState& cpu) {
+        return cpu.runQueue->size() + (cpu.current != INVALID_PROCESS ? 1 : 0);
+    };
+    
+    while (true) {
+        size_t busiest = 0;
+        size_t idlest = 0;
+        for (size_t cpu = 1; cpu < cpus.size(); ++cpu) {
+            if (load(cpus[cpu]) > load(cpus[busiest])) busiest = cpu;
+            if (load(cpus[cpu]) < load(cpus[idlest])) idlest = cpu;
+        }
+        if (load(cpus[busiest]) <= load(cpus[idlest]) + 1 || cpus[busiest].runQueue->empty()) {
+            return;
+        }
+        cpus[idlest].runQueue->push(cpus[busiest].runQueue->pop());
+    }
+}
+
+/**
+ * Steal Work Implementation
+ */
+bool Scheduler::stealWork(int cpu) {
+    size_t victim = 0;
+    for (size_t other = 1; other < cpus.size(); ++other) {
+        if (cpus[other].runQueue->size() > cpus[victim].runQueue->size()) victim = other;
+    }
+    if (cpus[victim].runQueue->empty()) {
+        return false;
+    }
+    cpus[cpu].runQueue->push(cpus[victim].runQueue->pop());
+    return true;
+}
+
+/**
+ * Sort Processes by Arrival Time Implementation
+ */
+void Scheduler::sortProcessesByArrivalTime() {
+    arrivalOrder = workload ? workload->getArrivalOrder() : vector<ProcessHandle>();
+    arrivalOrderValid = true;
+    arrivalCursor = 0;
+    table.syncSize();
+}
+
+/**
+ * Get Ready Queue Size Implementation
+ */
+size_t Scheduler::getReadyQueueSize() const {
+    if (loadBalancing == LoadBalancing::GLOBAL_QUEUE) {
+        return readyQueue->size();
+    }
+    size_t total = 0;
+    for (const CpuState& cpu : cpus) {
+        total += cpu.runQueue->size();
+    }
+    return total;
+}
+
+/**
+ * Is System Idle Implementation
+ */
+bool Scheduler::isSystemIdle() const {
+    return busyCpus == 0 && getReadyQueueSize() == 0;
+}
+
+// ========================================================================================
+// PRIVATE UTILITY METHOD IMPLEMENTATIONS
+// ========================================================================================
+
+/**
+ * Initialize Statistics Implementation
+ */
+void Scheduler::initializeStatistics() {
+    totalWaitingTime = 0.0;
+    totalTurnaroundTime = 0.0;
+    totalResponseTime = 0.0;
+    completedProcesses = 0;
+}
+
+/**
+ * Rebuild CPUs Implementation
+ */
+void Scheduler::rebuildCpus() {
+    bool perCpu = loadBalancing != LoadBalancing::GLOBAL_QUEUE;
+    for (CpuState& cpu : cpus) {
+        cpu.current = INVALID_PROCESS;
+        cpu.runQueue = perCpu ? makeRunQueue(readyQueue->getOrder()) : nullptr;
+        cpu.queue = perCpu ? cpu.runQueue.get() : readyQueue.get();
+    }
+    busyCpus = 0;
+}
+
+/**
+ * Make Run Queue Implementation
+ */
+unique_ptr<ReadyQueue> Scheduler::makeRunQueue(ReadyQueueOrder order) {
+    if (!processGroups) {
+        return createRunQueue(order);
+    }
+    return make_unique<GroupReadyQueue>(*processGroups, order, table,
+                                        [this, order]() { return createRunQueue(order); });
+}
+
+/**
+ * Get Mutable Workload Implementation
+ * Copy-on-write: a workload set through setWorkload() may be shared with other
+ * schedulers, so the first append works on a private copy
+ */
+Workload& Scheduler::getMutableWorkload() {
+    if (!localWorkload) {
+        localWorkload = workload ? make_shared<Workload>(*workload) : make_shared<Workload>();
+        workload = localWorkload;
+        table.bind(workload, true);
+    }
+    return *localWorkload;
+}
+
+/**
+ * Admit Transient Process Implementation
+ * Free rows are reused most recently freed first, while they are still in cache
+ */
+ProcessHandle Scheduler::admitTransientProcess(const ProcessSpec& spec) {
+    Workload& target = getMutableWorkload();
+    ProcessHandle handle;
+    
+    if (spec.ioBursts.empty() && !freeRows.empty()) {
+        handle = freeRows.back();
+        freeRows.pop_back();
+        target.assign(handle, spec);
+        table.resetRow(handle);
+        onProcessRecycled(handle);
+    } else {
+        handle = target.add(spec);
+        if (handle == INVALID_PROCESS) {
+            return INVALID_PROCESS;
+        }
+        table.syncSize();
+        transientRows++;
+    }
+    
+    totalProcesses++;
+    return handle;
+}
+
+/**
+ * Release Transient Rows Implementation
+ */
+void Scheduler::releaseTransientRows() {
+    freeRows.clear();
+    if (transientRows == 0) {
+        return;
+    }
+    
+    // A snapshot may have detached the rows, so they are truncated on a private copy
+    Workload& target = getMutableWorkload();
+    target.truncate(target.size() - transientRows);
+    transientRows = 0;
+    table.syncSize();
+    totalProcesses = static_cast<long long>(target.size());
 }
 
 /**
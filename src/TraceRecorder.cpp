@@ -0,0 +1,370 @@
+/**
+ * TraceRecorder.cpp - Binary Execution Trace Recorder Implementation File
+ *
+ * This source file contains the implementation of the binary trace recorder
+ * and of the Gantt chart exporter.
+ *
+ */
+
+#include "TraceRecorder.h"
+
+#include <cstring>      // For memcmp / memcpy
+#include <iostream>     // For error output
+#include <string_view>  // For process names
+#include <unordered_map> // For PID to name lookup
+
+#include "Instrumentation.h" // Include hot-path profiling counters
+
+// ========================================================================================
+// FILE FORMAT
+// ========================================================================================
+
+namespace {
+
+const char TRACE_MAGIC[8] = {'O', 'S', 'S', 'T', 'R', 'A', 'C', 'E'};
+const uint32_t TRACE_VERSION = 1;
+
+/**
+ * Trace File Header
+ */
+struct TraceHeader {
+    char magic[8];              // TRACE_MAGIC
+    uint32_t version;           // TRACE_VERSION
+    uint32_t recordSize;        // sizeof(TraceRecord)
+};
+
+/**
+ * Name Lookup
+ * Maps PIDs to workload names (falls back to "PID <n>")
+ */
+class NameLookup {
+private:
+    unordered_map<int, string_view> names;
+
+public:
+    explicit NameLookup(const Workload* workload) {
+        if (!workload) return;
+        names.reserve(workload->size());
+        for (ProcessHandle handle = 0; handle < workload->size(); ++handle) {
+            names.emplace(workload->pid[handle], workload->name(handle));
+        }
+    }
+
+    string get(int pid) const {
+        auto it = names.find(pid);
+        return it != names.end() ? string(it->second) : "PID " + to_string(pid);
+    }
+};
+
+/**
+ * Write JSON String
+ * Quotes and escapes text for a JSON document
+ */
+void writeJsonString(ostream& output, string_view text) {
+    output << '"';
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            output << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            output << ' ';
+        } else {
+            output << c;
+        }
+    }
+    output << '"';
+}
+
+} // namespace
+
+/**
+ * Get Trace Event Type Name Implementation
+ */
+const char* traceEventTypeToString(TraceEventType type) {
+    switch (type) {
+        case TraceEventType::ARRIVAL:
+            return "arrival";
+        case TraceEventType::DISPATCH:
+            return "dispatch";
+        case TraceEventType::PREEMPT:
+            return "preempt";
+        case TraceEventType::COMPLETE:
+            return "complete";
+        case TraceEventType::BLOCK:
+            return "block";
+        case TraceEventType::WAKEUP:
+            return "wakeup";
+    }
+    return "unknown";
+}
+
+// ========================================================================================
+// TRACE RECORDER
+// ========================================================================================
+
+/**
+ * Trace Recorder Constructor Implementation
+ */
+TraceRecorder::TraceRecorder(size_t capacity)
+    : buffer(capacity > 0 ? capacity : 1), used(0), recordCount(0), failed(false) {}
+
+/**
+ * Destructor Implementation
+ */
+TraceRecorder::~TraceRecorder() {
+    close();
+}
+
+/**
+ * Open Log Implementation
+ */
+bool TraceRecorder::open(const string& filePath) {
+    close();
+
+    output.open(filePath, ios::binary | ios::trunc);
+    if (!output) {
+        cerr << "Error: Cannot create trace file " << filePath << endl;
+        return false;
+    }
+    path = filePath;
+    used = 0;
+    recordCount = 0;
+    failed = false;
+
+    TraceHeader header;
+    memcpy(header.magic, TRACE_MAGIC, sizeof(TRACE_MAGIC));
+    header.version = TRACE_VERSION;
+    header.recordSize = sizeof(TraceRecord);
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    return true;
+}
+
+/**
+ * Close Log Implementation
+ */
+bool TraceRecorder::close() {
+    if (!output.is_open()) {
+        return !failed;
+    }
+
+    writeBuffer();
+    output.close();
+    if (!output || failed) {
+        cerr << "Error: Failed to write trace file " << path << endl;
+        failed = true;
+    }
+    return !failed;
+}
+
+/**
+ * Write Buffer Implementation
+ * Records are counted here rather than in record() to keep the hot path short
+ */
+void TraceRecorder::writeBuffer() {
+    if (used == 0) return;
+    PROFILE_SCOPE(ProfilePhase::OUTPUT);
+
+    recordCount += used;
+    if (output.is_open()) {
+        output.write(reinterpret_cast<const char*>(buffer.data()),
+                     static_cast<streamsize>(used * sizeof(TraceRecord)));
+        failed = failed || !output;
+    }
+    used = 0;
+}
+
+/**
+ * Flush Implementation
+ */
+void TraceRecorder::flush() {
+    writeBuffer();
+    if (output.is_open()) {
+        output.flush();
+    }
+}
+
+// ========================================================================================
+// TRACE EXPORTER
+// ========================================================================================
+
+/**
+ * Read Trace Implementation
+ */
+bool TraceExporter::readTrace(const string& path, vector<TraceRecord>& records) {
+    records.clear();
+
+    ifstream input(path, ios::binary | ios::ate);
+    if (!input) {
+        cerr << "Error: Cannot open trace file " << path << endl;
+        return false;
+    }
+    streamoff fileSize = input.tellg();
+    input.seekg(0);
+
+    TraceHeader header;
+    if (fileSize < static_cast<streamoff>(sizeof(header)) ||
+        !input.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        memcmp(header.magic, TRACE_MAGIC, sizeof(TRACE_MAGIC)) != 0) {
+        cerr << "Error: " << path << " is not a trace file" << endl;
+        return false;
+    }
+    if (header.version != TRACE_VERSION || header.recordSize != sizeof(TraceRecord)) {
+        cerr << "Error: Unsupported trace file version " << header.version
+             << " in " << path << endl;
+        return false;
+    }
+
+    streamoff payload = fileSize - static_cast<streamoff>(sizeof(header));
+    if (payload % static_cast<streamoff>(sizeof(TraceRecord)) != 0) {
+        cerr << "Warning: Ignoring truncated record at the end of " << path << endl;
+    }
+    records.resize(static_cast<size_t>(payload / static_cast<streamoff>(sizeof(TraceRecord))));
+    if (!input.read(reinterpret_cast<char*>(records.data()),
+                    static_cast<streamsize>(records.size() * sizeof(TraceRecord)))) {
+        cerr << "Error: Failed to read trace file " << path << endl;
+        records.clear();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Build Gantt Segments Implementation
+ */
+vector<GanttSegment> TraceExporter::buildSegments(const vector<TraceRecord>& records) {
+    vector<GanttSegment> segments;
+    vector<int> openSegment;    // Per CPU: index of the segment still running (-1 if idle)
+
+    for (const TraceRecord& record : records) {
+        if (record.type == TraceEventType::ARRIVAL || record.type == TraceEventType::WAKEUP) {
+            continue;
+        }
+        if (record.cpu >= openSegment.size()) {
+            openSegment.resize(record.cpu + 1u, -1);
+        }
+        int& open = openSegment[record.cpu];
+
+        if (record.type == TraceEventType::DISPATCH) {
+            if (open >= 0) {
+                // A dispatch without a matching end: close at the new dispatch
+                segments[open].end = record.time;
+                segments[open].endType = TraceEventType::PREEMPT;
+            }
+            GanttSegment segment;
+            segment.cpu = record.cpu;
+            segment.pid = record.pid;
+            segment.start = record.time;
+            segment.end = record.time;
+            open = static_cast<int>(segments.size());
+            segments.push_back(segment);
+        } else if (open >= 0 && segments[open].pid == record.pid) {
+            segments[open].end = record.time;
+            segments[open].endType = record.type;
+            open = -1;
+        }
+    }
+
+    return segments;
+}
+
+/**
+ * Export Chrome Trace JSON Implementation
+ */
+bool TraceExporter::exportChromeJson(const vector<TraceRecord>& records, const string& outputPath,
+                                     const Workload* workload) {
+    ofstream output(outputPath, ios::trunc);
+    if (!output) {
+        cerr << "Error: Cannot create " << outputPath << endl;
+        return false;
+    }
+
+    NameLookup names(workload);
+    vector<GanttSegment> segments = buildSegments(records);
+    bool first = true;
+    auto separator = [&]() {
+        output << (first ? "\n" : ",\n");
+        first = false;
+    };
+
+    output << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    // Track names: one thread per CPU
+    int cpuCount = 1;
+    for (const GanttSegment& segment : segments) {
+        cpuCount = max(cpuCount, segment.cpu + 1);
+    }
+    for (int cpu = 0; cpu < cpuCount; ++cpu) {
+        separator();
+        output << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << cpu
+               << ",\"args\":{\"name\":\"CPU " << cpu << "\"}}";
+    }
+
+    for (const GanttSegment& segment : segments) {
+        separator();
+        output << "{\"name\":";
+        writeJsonString(output, names.get(segment.pid));
+        output << ",\"cat\":\"cpu\",\"ph\":\"X\",\"ts\":" << segment.start
+               << ",\"dur\":" << (segment.end - segment.start)
+               << ",\"pid\":0,\"tid\":" << segment.cpu
+               << ",\"args\":{\"pid\":" << segment.pid
+               << ",\"end\":\"" << traceEventTypeToString(segment.endType) << "\"}}";
+    }
+
+    for (const TraceRecord& record : records) {
+        if (record.type != TraceEventType::ARRIVAL) continue;
+        separator();
+        output << "{\"name\":";
+        writeJsonString(output, names.get(record.pid));
+        output << ",\"cat\":\"arrival\",\"ph\":\"i\",\"s\":\"g\",\"ts\":" << record.time
+               << ",\"pid\":0,\"tid\":0,\"args\":{\"pid\":" << record.pid << "}}";
+    }
+
+    output << "\n]}\n";
+    output.close();
+    if (!output) {
+        cerr << "Error: Failed to write " << outputPath << endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Export Gantt CSV Implementation
+ */
+bool TraceExporter::exportCsv(const vector<TraceRecord>& records, const string& outputPath,
+                              const Workload* workload) {
+    ofstream output(outputPath, ios::trunc);
+    if (!output) {
+        cerr << "Error: Cannot create " << outputPath << endl;
+        return false;
+    }
+
+    NameLookup names(workload);
+    output << "cpu,pid,name,start,end,duration,end_event\n";
+    for (const GanttSegment& segment : buildSegments(records)) {
+        output << segment.cpu << ',' << segment.pid << ',' << names.get(segment.pid) << ','
+               << segment.start << ',' << segment.end << ',' << (segment.end - segment.start) << ','
+               << traceEventTypeToString(segment.endType) << '\n';
+    }
+
+    output.close();
+    if (!output) {
+        cerr << "Error: Failed to write " << outputPath << endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Export Trace File Implementation
+ */
+bool TraceExporter::exportFile(const string& tracePath, const string& outputPath,
+                               const Workload* workload) {
+    vector<TraceRecord> records;
+    if (!readTrace(tracePath, records)) {
+        return false;
+    }
+
+    bool csv = outputPath.size() >= 4 && outputPath.compare(outputPath.size() - 4, 4, ".csv") == 0;
+    return csv ? exportCsv(records, outputPath, workload)
+               : exportChromeJson(records, outputPath, workload);
+}
@@ -0,0 +1,74 @@
+/**
+ * TraceSink.cpp - Buffered Execution Trace Output Implementation File
+ *
+ * This source file contains the implementation of the buffered trace sink.
+ *
+ */
+
+#include "TraceSink.h"
+
+#include <charconv>     // For locale-free integer formatting
+
+#include "Instrumentation.h" // Include hot-path profiling counters
+
+/**
+ * Trace Sink Constructor Implementation
+ */
+TraceSink::TraceSink(ostream& stream, size_t bufferSize)
+    : output(stream), capacity(bufferSize > 0 ? bufferSize : 1)
+{
+    buffer.reserve(capacity + 128);
+}
+
+/**
+ * Destructor Implementation
+ */
+TraceSink::~TraceSink() {
+    flush();
+}
+
+/**
+ * Append Text Implementation
+ */
+TraceSink& TraceSink::operator<<(string_view text) {
+    buffer.append(text.data(), text.size());
+    if (buffer.size() >= capacity) {
+        PROFILE_SCOPE(ProfilePhase::OUTPUT);
+        output.write(buffer.data(), static_cast<streamsize>(buffer.size()));
+        buffer.clear();
+    }
+    return *this;
+}
+
+TraceSink& TraceSink::operator<<(const char* text) {
+    return *this << string_view(text);
+}
+
+TraceSink& TraceSink::operator<<(char c) {
+    return *this << string_view(&c, 1);
+}
+
+/**
+ * Append Integer Implementation
+ */
+TraceSink& TraceSink::operator<<(int64_t value) {
+    char digits[24];
+    auto result = to_chars(digits, digits + sizeof(digits), value);
+    return *this << string_view(digits, static_cast<size_t>(result.ptr - digits));
+}
+
+TraceSink& TraceSink::operator<<(int value) {
+    return *this << static_cast<int64_t>(value);
+}
+
+/**
+ * Flush Implementation
+ */
+void TraceSink::flush() {
+    PROFILE_SCOPE(ProfilePhase::OUTPUT);
+    if (!buffer.empty()) {
+        output.write(buffer.data(), static_cast<streamsize>(buffer.size()));
+        buffer.clear();
+    }
+    output.flush();
+}
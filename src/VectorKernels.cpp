@@ -0,0 +1,352 @@
+/**
+ * VectorKernels.cpp - Vectorised Column Kernels Implementation File
+ *
+ * This source file contains the scalar, AVX2 and NEON implementations of the
+ * column kernels and the run-time choice between them. The AVX2 functions are
+ * compiled for that instruction set on their own, so the rest of the program
+ * keeps the baseline target and still runs on processors without AVX2.
+ *
+ */
+
+#include "VectorKernels.h"
+
+#if !defined(VECTOR_KERNELS_SCALAR) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define VECTOR_KERNELS_HAVE_AVX2
+#include <immintrin.h>  // For AVX2 intrinsics
+#elif !defined(VECTOR_KERNELS_SCALAR) && defined(__aarch64__)
+#define VECTOR_KERNELS_HAVE_NEON
+#include <arm_neon.h>   // For NEON intrinsics
+#endif
+
+namespace {
+
+// ========================================================================================
+// SCALAR KERNELS
+// ========================================================================================
+
+ProcessMetricTotals sumScalar(const SimTime* arrival, const SimTime* start,
+                              const SimTime* completion, const SimTime* waiting, size_t count) {
+    ProcessMetricTotals totals;
+    for (size_t i = 0; i < count; ++i) {
+        totals.waiting += waiting[i];
+        totals.turnaround += completion[i] >= 0 ? completion[i] - arrival[i] : 0;
+        totals.response += start[i] >= 0 ? start[i] - arrival[i] : -1;
+    }
+    return totals;
+}
+
+size_t findInvalidScalar(const SimTime* arrival, const int* burst, size_t begin, size_t count) {
+    for (size_t i = begin; i < count; ++i) {
+        if (burst[i] <= 0 || arrival[i] < 0) {
+            return i;
+        }
+    }
+    return count;
+}
+
+size_t findMinimumScalar(const int64_t* high, const int64_t* low, size_t begin, size_t best, size_t count) {
+    for (size_t i = begin; i < count; ++i) {
+        if (high[i] < high[best] || (high[i] == high[best] && low[i] < low[best])) best = i;
+    }
+    return best;
+}
+
+// ========================================================================================
+// AVX2 KERNELS
+// ========================================================================================
+
+#ifdef VECTOR_KERNELS_HAVE_AVX2
+
+bool hasAvx2() {
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+
+/**
+ * Leave AVX
+ * Clears the upper register halves before returning to code built for the
+ * baseline target, which would otherwise pay a state transition penalty on
+ * every SSE instruction (the compiler does not insert this on its own here)
+ */
+__attribute__((target("avx2")))
+inline void leaveAvx() {
+    _mm256_zeroupper();
+}
+
+__attribute__((target("avx2")))
+int64_t horizontalSum(__m256i lanes) {
+    alignas(32) int64_t values[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(values), lanes);
+    return values[0] + values[1] + values[2] + values[3];
+}
+
+/**
+ * Sum Process Metrics (AVX2)
+ * Four rows per step; the -1 "not yet" markers become comparison masks
+ */
+__attribute__((target("avx2")))
+ProcessMetricTotals sumAvx2(const SimTime* arrival, const SimTime* start,
+                            const SimTime* completion, const SimTime* waiting, size_t count) {
+    const __m256i minusOne = _mm256_set1_epi64x(-1);
+    __m256i waitingSum = _mm256_setzero_si256();
+    __m256i turnaroundSum = _mm256_setzero_si256();
+    __m256i responseSum = _mm256_setzero_si256();
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i arrived = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(arrival + i));
+        __m256i started = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(start + i));
+        __m256i completed = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(completion + i));
+        __m256i waited = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(waiting + i));
+
+        __m256i isCompleted = _mm256_cmpgt_epi64(completed, minusOne);
+        __m256i isStarted = _mm256_cmpgt_epi64(started, minusOne);
+        waitingSum = _mm256_add_epi64(waitingSum, waited);
+        turnaroundSum = _mm256_add_epi64(turnaroundSum,
+                                         _mm256_and_si256(isCompleted, _mm256_sub_epi64(completed, arrived)));
+        responseSum = _mm256_add_epi64(responseSum,
+                                       _mm256_blendv_epi8(minusOne, _mm256_sub_epi64(started, arrived), isStarted));
+    }
+
+    ProcessMetricTotals totals;
+    totals.waiting = horizontalSum(waitingSum);
+    totals.turnaround = horizontalSum(turnaroundSum);
+    totals.response = horizontalSum(responseSum);
+    leaveAvx();
+
+    ProcessMetricTotals tail = sumScalar(arrival + i, start + i, completion + i, waiting + i, count - i);
+    totals.waiting += tail.waiting;
+    totals.turnaround += tail.turnaround;
+    totals.response += tail.response;
+    return totals;
+}
+
+/**
+ * Find Invalid Process (AVX2)
+ * Eight rows per step: one vector of bursts, two of arrivals
+ */
+__attribute__((target("avx2")))
+size_t findInvalidAvx2(const SimTime* arrival, const int* burst, size_t count) {
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i zero = _mm256_setzero_si256();
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i bursts = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(burst + i));
+        __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(arrival + i));
+        __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(arrival + i + 4));
+
+        unsigned invalid = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(one, bursts))));
+        invalid |= static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(zero, low))));
+        invalid |= static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(zero, high)))) << 4;
+        if (invalid != 0) {
+            leaveAvx();
+            return i + static_cast<size_t>(__builtin_ctz(invalid));
+        }
+    }
+    leaveAvx();
+    return findInvalidScalar(arrival, burst, i, count);
+}
+
+/**
+ * Find Minimum (AVX2)
+ * Each lane keeps the first smallest pair of its column in one pass, and the
+ * four lane winners are then compared
+ */
+__attribute__((target("avx2")))
+size_t findMinimumAvx2(const int64_t* high, const int64_t* low, size_t count) {
+    if (count < 8) {
+        return findMinimumScalar(high, low, 1, 0, count);
+    }
+
+    __m256i bestHigh = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(high));
+    __m256i bestLow = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(low));
+    __m256i bestIndex = _mm256_set_epi64x(3, 2, 1, 0);
+    __m256i index = bestIndex;
+    const __m256i step = _mm256_set1_epi64x(4);
+
+    size_t i = 4;
+    for (; i + 4 <= count; i += 4) {
+        __m256i highs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(high + i));
+        __m256i lows = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(low + i));
+        index = _mm256_add_epi64(index, step);
+
+        __m256i less = _mm256_or_si256(_mm256_cmpgt_epi64(bestHigh, highs),
+                                       _mm256_and_si256(_mm256_cmpeq_epi64(bestHigh, highs),
+                                                        _mm256_cmpgt_epi64(bestLow, lows)));
+        bestHigh = _mm256_blendv_epi8(bestHigh, highs, less);
+        bestLow = _mm256_blendv_epi8(bestLow, lows, less);
+        bestIndex = _mm256_blendv_epi8(bestIndex, index, less);
+    }
+
+    alignas(32) int64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), bestIndex);
+    leaveAvx();
+    size_t best = static_cast<size_t>(lanes[0]);
+    for (int lane = 1; lane < 4; ++lane) {
+        size_t candidate = static_cast<size_t>(lanes[lane]);
+        if (high[candidate] < high[best] ||
+            (high[candidate] == high[best] && (low[candidate] < low[best] ||
+                                               (low[candidate] == low[best] && candidate < best)))) {
+            best = candidate;
+        }
+    }
+    return findMinimumScalar(high, low, i, best, count);
+}
+
+#endif // VECTOR_KERNELS_HAVE_AVX2
+
+// ========================================================================================
+// NEON KERNELS
+// ========================================================================================
+
+#ifdef VECTOR_KERNELS_HAVE_NEON
+
+/**
+ * Sum Process Metrics (NEON)
+ * Two rows per step
+ */
+ProcessMetricTotals sumNeon(const SimTime* arrival, const SimTime* start,
+                            const SimTime* completion, const SimTime* waiting, size_t count) {
+    const int64x2_t zero = vdupq_n_s64(0);
+    const int64x2_t minusOne = vdupq_n_s64(-1);
+    int64x2_t waitingSum = zero;
+    int64x2_t turnaroundSum = zero;
+    int64x2_t responseSum = zero;
+
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        int64x2_t arrived = vld1q_s64(arrival + i);
+        int64x2_t started = vld1q_s64(start + i);
+        int64x2_t completed = vld1q_s64(completion + i);
+
+        waitingSum = vaddq_s64(waitingSum, vld1q_s64(waiting + i));
+        turnaroundSum = vaddq_s64(turnaroundSum,
+                                  vbslq_s64(vcgeq_s64(completed, zero), vsubq_s64(completed, arrived), zero));
+        responseSum = vaddq_s64(responseSum,
+                                vbslq_s64(vcgeq_s64(started, zero), vsubq_s64(started, arrived), minusOne));
+    }
+
+    ProcessMetricTotals totals = sumScalar(arrival + i, start + i, completion + i, waiting + i, count - i);
+    totals.waiting += vaddvq_s64(waitingSum);
+    totals.turnaround += vaddvq_s64(turnaroundSum);
+    totals.response += vaddvq_s64(responseSum);
+    return totals;
+}
+
+/**
+ * Find Invalid Process (NEON)
+ * Four rows per step; a flagged block is rescanned for the exact row
+ */
+size_t findInvalidNeon(const SimTime* arrival, const int* burst, size_t count) {
+    const int32x4_t zero32 = vdupq_n_s32(0);
+    const int64x2_t zero64 = vdupq_n_s64(0);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        uint32x4_t badBurst = vcleq_s32(vld1q_s32(burst + i), zero32);
+        uint64x2_t badArrival = vorrq_u64(vcltq_s64(vld1q_s64(arrival + i), zero64),
+                                          vcltq_s64(vld1q_s64(arrival + i + 2), zero64));
+        if (vmaxvq_u32(badBurst) != 0 || (vgetq_lane_u64(badArrival, 0) | vgetq_lane_u64(badArrival, 1)) != 0) {
+            return findInvalidScalar(arrival, burst, i, i + 4);
+        }
+    }
+    return findInvalidScalar(arrival, burst, i, count);
+}
+
+/**
+ * Find Minimum (NEON)
+ * Two lanes, as in the AVX2 version
+ */
+size_t findMinimumNeon(const int64_t* high, const int64_t* low, size_t count) {
+    if (count < 4) {
+        return findMinimumScalar(high, low, 1, 0, count);
+    }
+
+    int64x2_t bestHigh = vld1q_s64(high);
+    int64x2_t bestLow = vld1q_s64(low);
+    const int64_t firstIndices[2] = {0, 1};
+    int64x2_t bestIndex = vld1q_s64(firstIndices);
+    int64x2_t index = bestIndex;
+    const int64x2_t step = vdupq_n_s64(2);
+
+    size_t i = 2;
+    for (; i + 2 <= count; i += 2) {
+        int64x2_t highs = vld1q_s64(high + i);
+        int64x2_t lows = vld1q_s64(low + i);
+        index = vaddq_s64(index, step);
+
+        uint64x2_t less = vorrq_u64(vcgtq_s64(bestHigh, highs),
+                                    vandq_u64(vceqq_s64(bestHigh, highs), vcgtq_s64(bestLow, lows)));
+        bestHigh = vbslq_s64(less, highs, bestHigh);
+        bestLow = vbslq_s64(less, lows, bestLow);
+        bestIndex = vbslq_s64(less, index, bestIndex);
+    }
+
+    size_t first = static_cast<size_t>(vgetq_lane_s64(bestIndex, 0));
+    size_t second = static_cast<size_t>(vgetq_lane_s64(bestIndex, 1));
+    bool secondWins = high[second] < high[first] ||
+                      (high[second] == high[first] && (low[second] < low[first] ||
+                                                       (low[second] == low[first] && second < first)));
+    return findMinimumScalar(high, low, i, secondWins ? second : first, count);
+}
+
+#endif // VECTOR_KERNELS_HAVE_NEON
+
+} // namespace
+
+// ========================================================================================
+// DISPATCH
+// ========================================================================================
+
+/**
+ * Sum Process Metrics Implementation
+ */
+ProcessMetricTotals sumProcessMetrics(const SimTime* arrival, const SimTime* start,
+                                      const SimTime* completion, const SimTime* waiting, size_t count) {
+#if defined(VECTOR_KERNELS_HAVE_AVX2)
+    if (hasAvx2()) return sumAvx2(arrival, start, completion, waiting, count);
+#elif defined(VECTOR_KERNELS_HAVE_NEON)
+    return sumNeon(arrival, start, completion, waiting, count);
+#endif
+    return sumScalar(arrival, start, completion, waiting, count);
+}
+
+/**
+ * Find Invalid Process Implementation
+ */
+size_t findInvalidProcess(const SimTime* arrival, const int* burst, size_t count) {
+#if defined(VECTOR_KERNELS_HAVE_AVX2)
+    if (hasAvx2()) return findInvalidAvx2(arrival, burst, count);
+#elif defined(VECTOR_KERNELS_HAVE_NEON)
+    return findInvalidNeon(arrival, burst, count);
+#endif
+    return findInvalidScalar(arrival, burst, 0, count);
+}
+
+/**
+ * Find Minimum Implementation
+ */
+size_t findMinimum(const int64_t* high, const int64_t* low, size_t count) {
+    if (count == 0) {
+        return 0;
+    }
+#if defined(VECTOR_KERNELS_HAVE_AVX2)
+    if (hasAvx2()) return findMinimumAvx2(high, low, count);
+#elif defined(VECTOR_KERNELS_HAVE_NEON)
+    return findMinimumNeon(high, low, count);
+#endif
+    return findMinimumScalar(high, low, 1, 0, count);
+}
+
+/**
+ * Get Vector Instruction Set Implementation
+ */
+string getVectorInstructionSet() {
+#if defined(VECTOR_KERNELS_HAVE_AVX2)
+    if (hasAvx2()) return "avx2";
+#elif defined(VECTOR_KERNELS_HAVE_NEON)
+    return "neon";
+#endif
+    return "scalar";
+}
@@ -0,0 +1,283 @@
+/**
+ * WorkloadGenerator.cpp - Synthetic Workload Generator Implementation File
+ *
+ * This source file contains the seeded random number generator, the arrival
+ * and burst sampling and the workload generator itself.
+ *
+ */
+
+#include "WorkloadGenerator.h"
+
+#include <algorithm>    // For min and max
+#include <cmath>        // For log, pow and floor
+#include <iostream>     // For warnings
+
+// ========================================================================================
+// DISTRIBUTION NAMES
+// ========================================================================================
+
+/**
+ * Get Arrival Pattern Name Implementation
+ */
+string arrivalPatternToString(ArrivalPattern pattern) {
+    switch (pattern) {
+        case ArrivalPattern::BATCH:
+            return "batch";
+        case ArrivalPattern::POISSON:
+            return "poisson";
+        case ArrivalPattern::BURSTY:
+            return "bursty";
+        default:
+            return "unknown";
+    }
+}
+
+/**
+ * Get Burst Distribution Name Implementation
+ */
+string burstDistributionToString(BurstDistribution distribution) {
+    switch (distribution) {
+        case BurstDistribution::UNIFORM:
+            return "uniform";
+        case BurstDistribution::EXPONENTIAL:
+            return "exponential";
+        case BurstDistribution::PARETO:
+            return "pareto";
+        case BurstDistribution::BIMODAL:
+            return "bimodal";
+        default:
+            return "unknown";
+    }
+}
+
+// ========================================================================================
+// WORKLOAD GENERATOR IMPLEMENTATION
+// ========================================================================================
+
+/**
+ * Workload Generator Constructor Implementation
+ */
+WorkloadGenerator::WorkloadGenerator(const WorkloadGeneratorOptions& shape)
+    : options(shape), clock(0.0), produced(0), groupLeft(0), hasPending(false)
+{
+    const WorkloadGeneratorOptions defaults;
+    auto check = [](double& value, bool valid, double fallback, const char* what) {
+        if (!valid) {
+            cerr << "Warning: Invalid generator " << what << " " << value << ". Using " << fallback << "." << endl;
+            value = fallback;
+        }
+    };
+    check(options.arrivalRate, options.arrivalRate > 0.0, defaults.arrivalRate, "arrival rate");
+    check(options.burstiness, options.burstiness >= 1.0, defaults.burstiness, "burstiness");
+    check(options.meanGroupSize, options.meanGroupSize >= 1.0, defaults.meanGroupSize, "mean group size");
+    check(options.meanBurst, options.meanBurst >= 1.0, defaults.meanBurst, "mean burst");
+    check(options.paretoShape, options.paretoShape > 1.0, defaults.paretoShape, "Pareto shape");
+    check(options.longBurstRatio, options.longBurstRatio >= 1.0, defaults.longBurstRatio, "long burst ratio");
+    check(options.longBurstFraction, options.longBurstFraction >= 0.0 && options.longBurstFraction <= 1.0,
+          defaults.longBurstFraction, "long burst fraction");
+    if (options.maxBurst < 1) {
+        cerr << "Warning: Invalid generator burst limit " << options.maxBurst
+             << ". Using " << defaults.maxBurst << "." << endl;
+        options.maxBurst = defaults.maxBurst;
+    }
+
+    double total = 0.0;
+    for (int i = 0; i < 3; ++i) {
+        total += max(options.priorityMix[i], 0.0);
+        mixTotal[i] = total;
+    }
+    if (total <= 0.0) {
+        cerr << "Warning: Priority mix has no positive weight. Using MEDIUM only." << endl;
+        mixTotal[0] = 0.0;
+        mixTotal[1] = mixTotal[2] = 1.0;
+    }
+
+    rewind();
+}
+
+/**
+ * Next Random Number Implementation
+ * xoshiro256** (Blackman and Vigna)
+ */
+uint64_t WorkloadGenerator::nextRandom() {
+    auto rotl = [](uint64_t x, int k) { return (x << k) | (x >> (64 - k)); };
+    uint64_t result = rotl(state[1] * 5, 7) * 9;
+    uint64_t shifted = state[1] << 17;
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= shifted;
+    state[3] = rotl(state[3], 45);
+    return result;
+}
+
+/**
+ * Uniform Implementation
+ *
+ * @return Uniform value in [0, 1) with 53 random bits
+ */
+double WorkloadGenerator::uniform() {
+    return static_cast<double>(nextRandom() >> 11) * 0x1.0p-53;
+}
+
+/**
+ * Exponential Implementation
+ * Inverse CDF; 1 - u lies in (0, 1], so the logarithm is finite
+ */
+double WorkloadGenerator::exponential(double mean) {
+    return -mean * log(1.0 - uniform());
+}
+
+/**
+ * Draw Gap Implementation
+ * A BURSTY group of mean size g at arrival rate r spans g / r on average:
+ * g - 1 short gaps of mean 1 / (r * burstiness) plus one long gap for the rest
+ */
+double WorkloadGenerator::drawGap() {
+    const double rate = options.arrivalRate;
+    switch (options.arrivals) {
+        case ArrivalPattern::BATCH:
+            return 0.0;
+        case ArrivalPattern::POISSON:
+            return exponential(1.0 / rate);
+        case ArrivalPattern::BURSTY:
+            break;
+    }
+
+    if (groupLeft > 0) {
+        groupLeft--;
+        return exponential(1.0 / (rate * options.burstiness));
+    }
+
+    // New group: geometric size of mean g, then the gap that opens it
+    const double size = options.meanGroupSize;
+    groupLeft = size > 1.0 ? static_cast<uint64_t>(floor(log(1.0 - uniform()) / log(1.0 - 1.0 / size))) : 0;
+    double quiet = size / rate - (size - 1.0) / (rate * options.burstiness);
+    return exponential(quiet);
+}
+
+/**
+ * Draw Burst Implementation
+ */
+int WorkloadGenerator::drawBurst() {
+    const double mean = options.meanBurst;
+    double value = mean;
+    switch (options.bursts) {
+        case BurstDistribution::UNIFORM:
+            value = 1.0 + uniform() * (2.0 * mean - 2.0);
+            break;
+        case BurstDistribution::EXPONENTIAL:
+            value = exponential(mean);
+            break;
+        case BurstDistribution::PARETO: {
+            const double shape = options.paretoShape;
+            const double scale = mean * (shape - 1.0) / shape;
+            value = scale / pow(1.0 - uniform(), 1.0 / shape);
+            break;
+        }
+        case BurstDistribution::BIMODAL: {
+            // Short mode s and long mode ratio * s, mixed to the requested mean,
+            // each spread uniformly over +-50%
+            const double fraction = options.longBurstFraction;
+            const double shortBurst = mean / (1.0 - fraction + fraction * options.longBurstRatio);
+            double mode = uniform() < fraction ? shortBurst * options.longBurstRatio : shortBurst;
+            value = mode * (0.5 + uniform());
+            break;
+        }
+    }
+    return static_cast<int>(min(max(value, 1.0), static_cast<double>(options.maxBurst)) + 0.5);
+}
+
+/**
+ * Draw Priority Implementation
+ */
+Priority WorkloadGenerator::drawPriority() {
+    double pick = uniform() * mixTotal[2];
+    if (pick < mixTotal[0]) return Priority::HIGH;
+    if (pick < mixTotal[1]) return Priority::MEDIUM;
+    return Priority::LOW;
+}
+
+/**
+ * Draw Next Process Implementation
+ * Every process consumes its gap, burst and priority draws in that order
+ */
+void WorkloadGenerator::drawNext() {
+    if (options.count > 0 && produced >= options.count) {
+        hasPending = false;
+        return;
+    }
+
+    clock += drawGap();
+    pending.arrivalTime = static_cast<SimTime>(clock);
+    pending.burstTime = drawBurst();
+    pending.priority = drawPriority();
+    produced++;
+    hasPending = true;
+}
+
+bool WorkloadGenerator::hasNext() const {
+    return hasPending;
+}
+
+SimTime WorkloadGenerator::peekArrivalTime() const {
+    return hasPending ? pending.arrivalTime : 0;
+}
+
+bool WorkloadGenerator::next(ProcessSpec& spec) {
+    if (!hasPending) {
+        return false;
+    }
+
+    spec.name = pending.name;
+    spec.arrivalTime = pending.arrivalTime;
+    spec.burstTime = pending.burstTime;
+    spec.priority = pending.priority;
+    spec.pid = -1;
+    spec.ioBursts.clear();
+    drawNext();
+    return true;
+}
+
+/**
+ * Rewind Implementation
+ * The seed is expanded into the xoshiro state with SplitMix64
+ */
+bool WorkloadGenerator::rewind() {
+    uint64_t seed = options.seed;
+    for (uint64_t& word : state) {
+        uint64_t z = (seed += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        word = z ^ (z >> 31);
+    }
+
+    clock = 0.0;
+    produced = 0;
+    groupLeft = 0;
+    pending.name = options.name;
+    pending.pid = -1;
+    pending.ioBursts.clear();
+    drawNext();
+    return true;
+}
+
+/**
+ * Generate Workload Implementation
+ */
+shared_ptr<Workload> WorkloadGenerator::generate(const WorkloadGeneratorOptions& shape) {
+    if (shape.count == 0) {
+        cerr << "Error: Cannot materialise an unbounded generated workload" << endl;
+        return nullptr;
+    }
+
+    WorkloadGenerator generator(shape);
+    auto workload = make_shared<Workload>();
+    workload->reserve(static_cast<size_t>(shape.count));
+    ProcessSpec spec;
+    while (generator.next(spec)) {
+        workload->add(spec.name, spec.arrivalTime, spec.burstTime, spec.priority);
+    }
+    return workload;
+}
@@ -0,0 +1,760 @@
+/**
+ * WorkloadLoader.cpp - Trace File Workload Loader Implementation File
+ *
+ * This source file contains the memory-mapped CSV parser and the binary
+ * columnar reader and writer for workloads.
+ *
+ */
+
+#include "WorkloadLoader.h"
+
+#include <cctype>       // For isdigit
+#include <charconv>     // For allocation-free number parsing
+#include <cstring>      // For memcpy, memchr and memcmp
+#include <fstream>      // For binary output and the read fallback
+#include <iostream>     // For error reporting
+#include <vector>       // For column buffers
+
+#if defined(__unix__) || defined(__APPLE__)
+#define WORKLOAD_LOADER_HAVE_MMAP 1
+#include <fcntl.h>      // For open
+#include <sys/mman.h>   // For mmap
+#include <sys/stat.h>   // For fstat
+#include <unistd.h>     // For close
+#endif
+
+// ========================================================================================
+// FILE FORMAT CONSTANTS
+// ========================================================================================
+
+static const char BINARY_MAGIC[8] = {'O', 'S', 'S', 'W', 'K', 'L', 'D', '\0'};
+static const uint32_t BINARY_VERSION = 4;
+static const uint32_t BINARY_VERSION_NO_GROUPS = 3; // Readable version without the group section
+static const uint32_t BINARY_VERSION_NO_TIMING = 2; // Readable version without the timing section
+static const uint32_t BINARY_VERSION_NO_IO = 1;    // Oldest readable version (no I/O section)
+static const size_t MAX_REPORTED_LINES = 10;   // Malformed lines reported individually
+
+static_assert(sizeof(int) == sizeof(int32_t), "binary workload columns assume 32-bit int");
+static_assert(sizeof(Priority) == sizeof(uint8_t), "binary workload columns assume 8-bit priority");
+
+/**
+ * Binary Header
+ * Fixed-size prefix of a binary workload file
+ */
+struct BinaryHeader {
+    char magic[8];              // BINARY_MAGIC
+    uint32_t version;           // BINARY_VERSION
+    uint32_t reserved;          // Always 0
+    uint64_t processCount;      // Rows in every column
+    uint64_t nameCount;         // Distinct strings in the name pool
+    uint64_t nameBytes;         // Size of the name character blob
+};
+
+// ========================================================================================
+// MAPPED FILE
+// ========================================================================================
+
+/**
+ * Mapped File
+ * Read-only view of a whole file: memory-mapped where available,
+ * otherwise read into a buffer
+ */
+class MappedFile {
+private:
+    const char* bytes;          // Start of the file contents
+    size_t length;              // File size in bytes
+#ifdef WORKLOAD_LOADER_HAVE_MMAP
+    void* mapping;              // Mapping to release (nullptr if none)
+#endif
+    vector<char> buffer;        // Fallback storage
+
+public:
+    MappedFile() : bytes(nullptr), length(0)
+#ifdef WORKLOAD_LOADER_HAVE_MMAP
+        , mapping(nullptr)
+#endif
+    {}
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() {
+#ifdef WORKLOAD_LOADER_HAVE_MMAP
+        if (mapping) {
+            munmap(mapping, length);
+        }
+#endif
+    }
+
+    /**
+     * Open File
+     *
+     * @param path - File to map
+     * @return True if the contents are available
+     */
+    bool open(const string& path) {
+#ifdef WORKLOAD_LOADER_HAVE_MMAP
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+
+        struct stat info;
+        if (fstat(fd, &info) != 0) {
+            ::close(fd);
+            return false;
+        }
+
+        length = static_cast<size_t>(info.st_size);
+        if (length == 0) {
+            ::close(fd);
+            bytes = "";
+            return true;
+        }
+
+        void* address = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (address == MAP_FAILED) {
+            length = 0;
+            return false;
+        }
+
+        madvise(address, length, MADV_SEQUENTIAL);
+        mapping = address;
+        bytes = static_cast<const char*>(address);
+        return true;
+#else
+        ifstream input(path, ios::binary | ios::ate);
+        if (!input) {
+            return false;
+        }
+        buffer.resize(static_cast<size_t>(input.tellg()));
+        input.seekg(0);
+        input.read(buffer.data(), static_cast<streamsize>(buffer.size()));
+        if (!input && !buffer.empty()) {
+            return false;
+        }
+        bytes = buffer.data();
+        length = buffer.size();
+        return true;
+#endif
+    }
+
+    const char* data() const { return bytes; }
+    size_t size() const { return length; }
+};
+
+// ========================================================================================
+// CSV PARSING HELPERS
+// ========================================================================================
+
+/**
+ * Is Blank Character
+ */
+static bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+/**
+ * Next Field
+ * Extracts the next field of a line. Fields are separated by a comma and/or blanks.
+ *
+ * @param cursor - Current position, advanced past the field and its separator
+ * @param end - End of the line
+ * @param field - Receives the field (without surrounding blanks)
+ * @return False if the line has no more fields
+ */
+static bool nextField(const char*& cursor, const char* end, string_view& field) {
+    while (cursor < end && isBlank(*cursor)) cursor++;
+    if (cursor >= end) {
+        return false;
+    }
+
+    const char* start = cursor;
+    while (cursor < end && *cursor != ',' && !isBlank(*cursor)) cursor++;
+    field = string_view(start, static_cast<size_t>(cursor - start));
+
+    while (cursor < end && isBlank(*cursor)) cursor++;
+    if (cursor < end && *cursor == ',') cursor++;
+    return true;
+}
+
+/**
+ * Is Text Field
+ * Header fields are words; anything starting like a number is a bad value
+ *
+ * @param field - Field text
+ * @return True if the field is non-empty and does not start with a digit or sign
+ */
+static bool isTextField(string_view field) {
+    return !field.empty() && !isdigit(static_cast<unsigned char>(field.front())) &&
+           field.front() != '+' && field.front() != '-';
+}
+
+/**
+ * Parse Integer Field
+ *
+ * @param field - Field text
+ * @param value - Receives the value
+ * @return True if the whole field is a valid integer
+ */
+template <typename T>
+static bool parseInteger(string_view field, T& value) {
+    if (field.empty()) {
+        return false;
+    }
+    const char* begin = field.data();
+    const char* end = begin + field.size();
+    if (*begin == '+') begin++;
+    auto result = from_chars(begin, end, value);
+    return result.ec == errc() && result.ptr == end;
+}
+
+/**
+ * Parse Timing Field
+ * Real-time attributes are written "period=N" and "deadline=N"
+ *
+ * @param field - Field text
+ * @param period - Receives the value of a period field
+ * @param deadline - Receives the value of a deadline field
+ * @param valid - Set to false if the field is a timing field with a bad value
+ * @return True if the field is a timing field
+ */
+static bool parseTimingField(string_view field, int& period, int& deadline, bool& valid) {
+    static const string_view PERIOD_KEY = "period=";
+    static const string_view DEADLINE_KEY = "deadline=";
+    int* target = nullptr;
+    if (field.substr(0, PERIOD_KEY.size()) == PERIOD_KEY) {
+        target = &period;
+        field.remove_prefix(PERIOD_KEY.size());
+    } else if (field.substr(0, DEADLINE_KEY.size()) == DEADLINE_KEY) {
+        target = &deadline;
+        field.remove_prefix(DEADLINE_KEY.size());
+    } else {
+        return false;
+    }
+    valid = parseInteger(field, *target) && *target >= 0;
+    return true;
+}
+
+/**
+ * Parse Group Field
+ * The process group is written "group=PATH"
+ *
+ * @param field - Field text
+ * @param group - Receives the group path
+ * @param valid - Set to false if the field is a group field with a bad path
+ * @return True if the field is a group field
+ */
+static bool parseGroupField(string_view field, string_view& group, bool& valid) {
+    static const string_view GROUP_KEY = "group=";
+    if (field.substr(0, GROUP_KEY.size()) != GROUP_KEY) {
+        return false;
+    }
+    group = field.substr(GROUP_KEY.size());
+    valid = Workload::isValidGroupPath(group);
+    return true;
+}
+
+// ========================================================================================
+// LOADING IMPLEMENTATION
+// ========================================================================================
+
+/**
+ * Load Workload Implementation
+ */
+shared_ptr<Workload> WorkloadLoader::load(const string& path, WorkloadFormat format) {
+    if (format == WorkloadFormat::AUTO) {
+        format = detectFormat(path);
+    }
+
+    switch (format) {
+        case WorkloadFormat::BINARY:
+            return loadBinary(path);
+        case WorkloadFormat::CSV:
+            return loadCsv(path);
+        case WorkloadFormat::AUTO:
+        default:
+            cerr << "Error: Cannot open workload file " << path << endl;
+            return nullptr;
+    }
+}
+
+/**
+ * Detect Format Implementation
+ */
+WorkloadFormat WorkloadLoader::detectFormat(const string& path) {
+    ifstream input(path, ios::binary);
+    if (!input) {
+        return WorkloadFormat::AUTO;
+    }
+
+    char magic[sizeof(BINARY_MAGIC)] = {};
+    input.read(magic, sizeof(magic));
+    if (input.gcount() == static_cast<streamsize>(sizeof(magic)) &&
+        memcmp(magic, BINARY_MAGIC, sizeof(magic)) == 0) {
+        return WorkloadFormat::BINARY;
+    }
+    return WorkloadFormat::CSV;
+}
+
+/**
+ * Load CSV Workload Implementation
+ *
+ * Algorithm flow:
+ * 1. Map the file and count its lines to reserve every column once.
+ * 2. Walk the lines in place; fields are string_views into the mapping and
+ *    numbers are parsed with from_chars, so no line is ever copied.
+ * 3. Parse each line with parseCsvLine() and append the row to the workload
+ *    (validation matches Workload::add()).
+ */
+shared_ptr<Workload> WorkloadLoader::loadCsv(const string& path) {
+    MappedFile file;
+    if (!file.open(path)) {
+        cerr << "Error: Cannot open workload file " << path << endl;
+        return nullptr;
+    }
+
+    const char* cursor = file.data();
+    const char* end = cursor + file.size();
+
+    size_t lineEstimate = 1;
+    for (const char* scan = cursor;
+         (scan = static_cast<const char*>(memchr(scan, '\n', static_cast<size_t>(end - scan)))) != nullptr;
+         ++scan) {
+        lineEstimate++;
+    }
+
+    auto workload = make_shared<Workload>();
+    workload->reserve(lineEstimate);
+
+    size_t lineNumber = 0;
+    size_t malformedLines = 0;
+    bool seenData = false;
+    CsvProcessLine row;         // One I/O request buffer for the whole file
+
+    while (cursor < end) {
+        const char* lineEnd = static_cast<const char*>(memchr(cursor, '\n', static_cast<size_t>(end - cursor)));
+        if (!lineEnd) {
+            lineEnd = end;
+        }
+        const char* line = cursor;
+        cursor = lineEnd + 1;
+        lineNumber++;
+
+        CsvLineKind kind = parseCsvLine(string_view(line, static_cast<size_t>(lineEnd - line)), !seenData, row);
+        if (kind == CsvLineKind::BLANK) {
+            continue;
+        }
+        seenData = true;
+        if (kind == CsvLineKind::HEADER) {
+            continue;
+        }
+        if (kind == CsvLineKind::MALFORMED) {
+            if (++malformedLines <= MAX_REPORTED_LINES) {
+                cerr << "Warning: Skipping malformed process on line " << lineNumber
+                     << " of " << path << endl;
+            }
+            continue;
+        }
+
+        ProcessHandle handle = workload->addRow(row.name, row.arrival, row.burst, row.priority, -1, false);
+        if (!row.ioBursts.empty()) {
+            workload->setIoBursts(handle, row.ioBursts);
+        }
+        if (row.period > 0 || row.deadline > 0) {
+            workload->setTiming(handle, row.period, row.deadline);
+        }
+        if (!row.group.empty()) {
+            workload->setGroup(handle, row.group);
+        }
+    }
+
+    if (malformedLines > MAX_REPORTED_LINES) {
+        cerr << "Warning: Skipped " << malformedLines << " malformed lines in " << path << endl;
+    }
+    if (malformedLines > 0 && workload->size() == 0) {
+        cerr << "Error: " << path << " has no valid processes" << endl;
+        return nullptr;
+    }
+
+    return workload;
+}
+
+/**
+ * Parse CSV Line Implementation
+ * Fields after the priority are I/O requests, timing fields or the group
+ * field; a timing or group field may also take the priority's place
+ */
+CsvLineKind WorkloadLoader::parseCsvLine(string_view text, bool firstLine, CsvProcessLine& process) {
+    const char* line = text.data();
+    const char* lineEnd = line + text.size();
+    while (line < lineEnd && isBlank(*line)) line++;
+    if (line == lineEnd || *line == '#') {
+        return CsvLineKind::BLANK;
+    }
+
+    string_view arrivalField, burstField, priorityField, ioField;
+    int priority = static_cast<int>(Priority::MEDIUM);
+    process.arrival = 0;
+    process.burst = 0;
+    process.period = 0;
+    process.deadline = 0;
+    process.group = string_view();
+    process.ioBursts.clear();
+
+    bool valid = nextField(line, lineEnd, process.name) &&
+                 nextField(line, lineEnd, arrivalField) &&
+                 nextField(line, lineEnd, burstField) &&
+                 parseInteger(arrivalField, process.arrival) &&
+                 parseInteger(burstField, process.burst);
+    if (valid && nextField(line, lineEnd, priorityField) &&
+        !parseTimingField(priorityField, process.period, process.deadline, valid) &&
+        !parseGroupField(priorityField, process.group, valid) &&
+        !parseInteger(priorityField, priority)) {
+        valid = false;
+    }
+    while (valid && nextField(line, lineEnd, ioField)) {
+        if (parseTimingField(ioField, process.period, process.deadline, valid) ||
+            parseGroupField(ioField, process.group, valid)) {
+            continue;
+        }
+        IoBurst request;
+        valid = Workload::parseIoBurst(ioField, request);
+        process.ioBursts.push_back(request);
+    }
+    if (valid && !process.ioBursts.empty() &&
+        !Workload::checkIoBursts(process.ioBursts.data(), process.ioBursts.size(), max(process.burst, 1))) {
+        valid = false;
+    }
+
+    if (!valid) {
+        // A first line with text in the arrival and burst columns is a column header
+        return firstLine && isTextField(arrivalField) && isTextField(burstField) ? CsvLineKind::HEADER
+                                                                                : CsvLineKind::MALFORMED;
+    }
+    if (priority < static_cast<int>(Priority::HIGH) || priority > static_cast<int>(Priority::LOW)) {
+        priority = static_cast<int>(Priority::MEDIUM);
+    }
+    process.priority = static_cast<Priority>(priority);
+    return CsvLineKind::PROCESS;
+}
+
+/**
+ * Load Binary Workload Implementation
+ * Columns are bulk-copied, then validated in one pass
+ */
+shared_ptr<Workload> WorkloadLoader::loadBinary(const string& path) {
+    MappedFile file;
+    if (!file.open(path)) {
+        cerr << "Error: Cannot open workload file " << path << endl;
+        return nullptr;
+    }
+
+    BinaryHeader header;
+    if (file.size() < sizeof(header)) {
+        cerr << "Error: " << path << " is too small to be a binary workload" << endl;
+        return nullptr;
+    }
+    memcpy(&header, file.data(), sizeof(header));
+
+    if (memcmp(header.magic, BINARY_MAGIC, sizeof(BINARY_MAGIC)) != 0) {
+        cerr << "Error: " << path << " is not a binary workload file" << endl;
+        return nullptr;
+    }
+    if (header.version != BINARY_VERSION && header.version != BINARY_VERSION_NO_GROUPS &&
+        header.version != BINARY_VERSION_NO_TIMING && header.version != BINARY_VERSION_NO_IO) {
+        cerr << "Error: " << path << " has unsupported binary workload version "
+             << header.version << endl;
+        return nullptr;
+    }
+
+    const uint64_t n = header.processCount;
+    const uint64_t rowBytes = sizeof(int32_t) + sizeof(int64_t) + sizeof(int32_t) +
+                              sizeof(uint8_t) + sizeof(uint32_t);
+    const uint64_t ioBurstBytes = sizeof(int32_t) + sizeof(int32_t) + sizeof(uint16_t);
+    const uint64_t limit = file.size();
+    bool intact = n <= limit / rowBytes && header.nameCount < limit / sizeof(uint64_t) &&
+                  header.nameBytes <= limit;
+    uint64_t ioStart = intact ? sizeof(header) + n * rowBytes +
+                                (header.nameCount + 1) * sizeof(uint64_t) + header.nameBytes : 0;
+    uint64_t ioCounts[2] = {0, 0};     // offsetCount, burstCount
+    uint64_t timingStart = 0;
+    uint64_t timingCount = 0;
+    uint64_t groupStart = 0;
+    uint64_t groupCounts[3] = {0, 0, 0};   // groupCount, pathCount, pathBytes
+    if (intact && header.version == BINARY_VERSION_NO_IO) {
+        intact = ioStart == limit;
+    } else if (intact) {
+        intact = ioStart <= limit && limit - ioStart >= sizeof(ioCounts);
+        if (intact) {
+            memcpy(ioCounts, file.data() + ioStart, sizeof(ioCounts));
+            uint64_t rest = limit - ioStart - sizeof(ioCounts);
+            intact = ioCounts[0] <= n + 1 && ioCounts[1] <= rest / ioBurstBytes &&
+                     ioCounts[0] * sizeof(uint32_t) + ioCounts[1] * ioBurstBytes <= rest &&
+                     (ioCounts[1] == 0) == (ioCounts[0] == 0) && ioCounts[0] != 1;
+            timingStart = ioStart + sizeof(ioCounts) + ioCounts[0] * sizeof(uint32_t) + ioCounts[1] * ioBurstBytes;
+        }
+        if (intact && header.version == BINARY_VERSION_NO_TIMING) {
+            intact = timingStart == limit;
+        } else if (intact) {
+            intact = limit - timingStart >= sizeof(timingCount);
+            if (intact) {
+                memcpy(&timingCount, file.data() + timingStart, sizeof(timingCount));
+                uint64_t rest = limit - timingStart - sizeof(timingCount);
+                intact = timingCount <= n && timingCount * 2 * sizeof(int32_t) <= rest;
+                groupStart = timingStart + sizeof(timingCount) + timingCount * 2 * sizeof(int32_t);
+            }
+        }
+        if (intact && header.version == BINARY_VERSION_NO_GROUPS) {
+            intact = groupStart == limit;
+        } else if (intact && header.version == BINARY_VERSION) {
+            intact = limit - groupStart >= sizeof(groupCounts);
+            if (intact) {
+                memcpy(groupCounts, file.data() + groupStart, sizeof(groupCounts));
+                uint64_t rest = limit - groupStart - sizeof(groupCounts);
+                intact = groupCounts[0] <= n && groupCounts[1] < rest / sizeof(uint64_t) &&
+                         groupCounts[0] * sizeof(uint32_t) + (groupCounts[1] + 1) * sizeof(uint64_t) +
+                         groupCounts[2] == rest;
+            }
+        }
+    }
+    if (!intact) {
+        cerr << "Error: " << path << " is truncated or corrupt" << endl;
+        return nullptr;
+    }
+
+    auto workload = make_shared<Workload>();
+    const char* cursor = file.data() + sizeof(header);
+    auto readColumn = [&cursor](auto& column, size_t count) {
+        column.resize(count);
+        size_t bytes = count * sizeof(column[0]);
+        if (bytes > 0) {
+            memcpy(column.data(), cursor, bytes);
+        }
+        cursor += bytes;
+    };
+
+    vector<uint64_t> nameOffsets;
+    readColumn(workload->pid, n);
+    readColumn(workload->arrivalTime, n);
+    readColumn(workload->burstTime, n);
+    readColumn(workload->priority, n);
+    readColumn(workload->nameId, n);
+    readColumn(nameOffsets, header.nameCount + 1);
+    const char* nameBlob = cursor;
+
+    // Name pool (ids are preserved)
+    workload->names.reserve(header.nameCount);
+    for (uint64_t i = 0; i < header.nameCount; ++i) {
+        if (nameOffsets[i] > nameOffsets[i + 1] || nameOffsets[i + 1] > header.nameBytes) {
+            cerr << "Error: " << path << " has a corrupt name table" << endl;
+            return nullptr;
+        }
+        workload->names.append(string_view(nameBlob + nameOffsets[i],
+                                           nameOffsets[i + 1] - nameOffsets[i]));
+    }
+
+    // Validate rows and rebuild the derived workload state
+    bool increasingPids = true;
+    for (uint64_t i = 0; i < n; ++i) {
+        int8_t level = static_cast<int8_t>(workload->priority[i]);
+        if (workload->nameId[i] >= header.nameCount || workload->pid[i] < 0 ||
+            workload->arrivalTime[i] < 0 || workload->burstTime[i] <= 0 ||
+            level < static_cast<int8_t>(Priority::HIGH) || level > static_cast<int8_t>(Priority::LOW)) {
+            cerr << "Error: " << path << " has an invalid process in row " << i << endl;
+            return nullptr;
+        }
+        if (i > 0) {
+            if (workload->arrivalTime[i] < workload->arrivalTime[i - 1]) {
+                workload->sortedByArrival = false;
+            }
+            if (workload->pid[i] <= workload->pid[i - 1]) {
+                increasingPids = false;
+            }
+        }
+        workload->maxPid = max(workload->maxPid, workload->pid[i]);
+    }
+    workload->nextPid = workload->maxPid + 1;
+
+    // I/O section: compressed rows of requests, checked row by row
+    if (ioCounts[1] > 0) {
+        vector<int32_t> cpuBefore;
+        vector<int32_t> duration;
+        vector<uint16_t> device;
+        cursor = file.data() + ioStart + sizeof(ioCounts);
+        readColumn(workload->ioOffset, ioCounts[0]);
+        readColumn(cpuBefore, ioCounts[1]);
+        readColumn(duration, ioCounts[1]);
+        readColumn(device, ioCounts[1]);
+
+        workload->ioBursts.resize(ioCounts[1]);
+        for (uint64_t i = 0; i < ioCounts[1]; ++i) {
+            workload->ioBursts[i] = {cpuBefore[i], duration[i], device[i]};
+        }
+
+        const vector<uint32_t>& offsets = workload->ioOffset;
+        bool validIo = offsets.front() == 0 && offsets.back() == ioCounts[1];
+        // Every row's slice must lie in the table before any of them is read
+        for (size_t row = 0; validIo && row + 1 < offsets.size(); ++row) {
+            validIo = offsets[row] <= offsets[row + 1] && offsets[row + 1] <= ioCounts[1];
+        }
+        for (size_t row = 0; validIo && row + 1 < offsets.size(); ++row) {
+            validIo = Workload::checkIoBursts(workload->ioBursts.data() + offsets[row],
+                                              offsets[row + 1] - offsets[row], workload->burstTime[row]);
+        }
+        if (!validIo) {
+            cerr << "Error: " << path << " has an invalid I/O burst table" << endl;
+            return nullptr;
+        }
+    }
+
+    // Timing section: periods and deadlines up to the last row that has one
+    if (timingCount > 0) {
+        cursor = file.data() + timingStart + sizeof(timingCount);
+        readColumn(workload->period, timingCount);
+        readColumn(workload->relativeDeadline, timingCount);
+        bool validTiming = workload->relativeDeadline.back() > 0;
+        for (uint64_t i = 0; validTiming && i < timingCount; ++i) {
+            validTiming = workload->period[i] >= 0 && workload->relativeDeadline[i] >= 0 &&
+                          (workload->period[i] == 0 || workload->relativeDeadline[i] > 0);
+        }
+        if (!validTiming) {
+            cerr << "Error: " << path << " has an invalid timing table" << endl;
+            return nullptr;
+        }
+    }
+
+    // Group section: group path ids up to the last grouped row, then the path pool
+    if (groupCounts[1] > 0) {
+        vector<uint64_t> pathOffsets;
+        cursor = file.data() + groupStart + sizeof(groupCounts);
+        readColumn(workload->group, groupCounts[0]);
+        readColumn(pathOffsets, groupCounts[1] + 1);
+        const char* pathBlob = cursor;
+
+        bool validGroups = groupCounts[0] == 0 || workload->group.back() != 0;
+        for (uint64_t i = 0; validGroups && i < groupCounts[1]; ++i) {
+            validGroups = pathOffsets[i] <= pathOffsets[i + 1] && pathOffsets[i + 1] <= groupCounts[2];
+            if (validGroups) {
+                string_view groupPath(pathBlob + pathOffsets[i], pathOffsets[i + 1] - pathOffsets[i]);
+                validGroups = (i == 0) == groupPath.empty() && Workload::isValidGroupPath(groupPath);
+                workload->groupPaths.append(groupPath);
+            }
+        }
+        for (uint64_t i = 0; validGroups && i < groupCounts[0]; ++i) {
+            validGroups = workload->group[i] < groupCounts[1];
+        }
+        if (!validGroups) {
+            cerr << "Error: " << path << " has an invalid group table" << endl;
+            return nullptr;
+        }
+    } else if (groupCounts[0] > 0) {
+        cerr << "Error: " << path << " has an invalid group table" << endl;
+        return nullptr;
+    }
+
+    if (!increasingPids) {
+        workload->usedPids.reserve(n);
+        for (int processPid : workload->pid) {
+            if (!workload->usedPids.insert(processPid).second) {
+                cerr << "Error: " << path << " contains duplicate PID " << processPid << endl;
+                return nullptr;
+            }
+        }
+    }
+
+    return workload;
+}
+
+// ========================================================================================
+// SAVING IMPLEMENTATION
+// ========================================================================================
+
+/**
+ * Save Binary Workload Implementation
+ */
+bool WorkloadLoader::saveBinary(const Workload& workload, const string& path) {
+    ofstream output(path, ios::binary | ios::trunc);
+    if (!output) {
+        cerr << "Error: Cannot create workload file " << path << endl;
+        return false;
+    }
+
+    // Name table: offsets into one character blob
+    const StringPool& names = workload.names;
+    vector<uint64_t> nameOffsets(names.size() + 1, 0);
+    for (size_t i = 0; i < names.size(); ++i) {
+        nameOffsets[i + 1] = nameOffsets[i] + names.get(static_cast<uint32_t>(i)).size();
+    }
+
+    BinaryHeader header;
+    memcpy(header.magic, BINARY_MAGIC, sizeof(BINARY_MAGIC));
+    header.version = BINARY_VERSION;
+    header.reserved = 0;
+    header.processCount = workload.size();
+    header.nameCount = names.size();
+    header.nameBytes = nameOffsets.back();
+
+    auto writeColumn = [&output](const auto& column) {
+        output.write(reinterpret_cast<const char*>(column.data()),
+                     static_cast<streamsize>(column.size() * sizeof(column[0])));
+    };
+
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    writeColumn(workload.pid);
+    writeColumn(workload.arrivalTime);
+    writeColumn(workload.burstTime);
+    writeColumn(workload.priority);
+    writeColumn(workload.nameId);
+    writeColumn(nameOffsets);
+    for (size_t i = 0; i < names.size(); ++i) {
+        string_view text = names.get(static_cast<uint32_t>(i));
+        output.write(text.data(), static_cast<streamsize>(text.size()));
+    }
+
+    // I/O section, split into columns so no struct padding reaches the file
+    const vector<IoBurst>& bursts = workload.ioBursts;
+    uint64_t ioCounts[2] = {workload.ioOffset.size(), bursts.size()};
+    vector<int32_t> cpuBefore(bursts.size());
+    vector<int32_t> duration(bursts.size());
+    vector<uint16_t> device(bursts.size());
+    for (size_t i = 0; i < bursts.size(); ++i) {
+        cpuBefore[i] = bursts[i].cpuBefore;
+        duration[i] = bursts[i].duration;
+        device[i] = bursts[i].device;
+    }
+    output.write(reinterpret_cast<const char*>(ioCounts), sizeof(ioCounts));
+    writeColumn(workload.ioOffset);
+    writeColumn(cpuBefore);
+    writeColumn(duration);
+    writeColumn(device);
+
+    // Timing section
+    uint64_t timingCount = workload.relativeDeadline.size();
+    output.write(reinterpret_cast<const char*>(&timingCount), sizeof(timingCount));
+    writeColumn(workload.period);
+    writeColumn(workload.relativeDeadline);
+
+    // Group section: path ids, then the path pool as offsets into one blob
+    const StringPool& paths = workload.groupPaths;
+    vector<uint64_t> pathOffsets(paths.size() + 1, 0);
+    for (size_t i = 0; i < paths.size(); ++i) {
+        pathOffsets[i + 1] = pathOffsets[i] + paths.get(static_cast<uint32_t>(i)).size();
+    }
+    uint64_t groupCounts[3] = {workload.group.size(), paths.size(), pathOffsets.back()};
+    output.write(reinterpret_cast<const char*>(groupCounts), sizeof(groupCounts));
+    writeColumn(workload.group);
+    writeColumn(pathOffsets);
+    for (size_t i = 0; i < paths.size(); ++i) {
+        string_view text = paths.get(static_cast<uint32_t>(i));
+        output.write(text.data(), static_cast<streamsize>(text.size()));
+    }
+
+    output.close();
+    if (!output) {
+        cerr << "Error: Failed to write workload file " << path << endl;
+        return false;
+    }
+    return true;
+}
@@ -1,28 +1,67 @@
 #include <iostream>
+#include <fstream>
+#include <memory>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <iomanip>
+#include <thread>
+#include <filesystem>
 #include "Process.h"
+#include "ProcessTable.h"
+#include "FCFSScheduler.h"
+#include "SJFScheduler.h"
+#include "RoundRobinScheduler.h"
+#include "PriorityScheduler.h"
+#include "MLFQScheduler.h"
+#include "CFSScheduler.h"
+#include "EDFScheduler.h"
+#include "LiveArrivalSource.h"
+#include "RateMonotonicScheduler.h"
+#include "ComparisonRunner.h"
+#include "DistributedSweep.h"
+#include "GroupScheduling.h"
+#include "QuantumSweep.h"
+#include "ReplicationRunner.h"
+#include "ResultsWriter.h"
+#include "Schedulability.h"
+#include "TraceRecorder.h"
+#include "WorkloadGenerator.h"
+#include "WorkloadLoader.h"
 using namespace std;
 
 // ========================================================================================
 // DEMONSTRATION AND TESTING FUNCTIONS
 // ========================================================================================
 
+/**
+ * Create Sample Workload
+ * Small built-in process set used when no trace file is given
+ * 
+ * @return Sample workload
+ */
+shared_ptr<Workload> createSampleWorkload() {
+    // Create sample processes with varied characteristics
+    // Process parameters: (name, arrival_time, burst_time, priority)
+    auto sampleProcesses = make_shared<Workload>();
+    sampleProcesses->add("P1", 0, 8, Priority::MEDIUM);   // Long CPU-bound process
+    sampleProcesses->add("P2", 1, 4, Priority::HIGH);     // Short high-priority process
+    sampleProcesses->add("P3", 2, 9, Priority::LOW);      // Long low-priority process
+    sampleProcesses->add("P4", 3, 5, Priority::MEDIUM);   // Medium process
+    sampleProcesses->add("P5", 4, 2, Priority::HIGH);     // Short high-priority process
+    return sampleProcesses;
+}
+
 /**
  * Demonstrate Scheduling Algorithms
  * 
  * Creates a set of sample processes and runs them through all
- * implemented scheduling algorithms for comparison.
- * Displays execution traces and performance statistics.
+ * implemented scheduling algorithms in parallel for comparison.
+ * Displays per-algorithm performance statistics and a comparison table.
  */
 void demonstrateScheduling() {
-    // Create sample processes with varied characteristics
-    // Process parameters: (name, arrival_time, burst_time, priority)
-    vector<shared_ptr<Process>> sampleProcesses = {
-        make_shared<Process>("P1", 0, 8, Priority::MEDIUM),   // Long CPU-bound process
-        make_shared<Process>("P2", 1, 4, Priority::HIGH),    // Short high-priority process  
-        make_shared<Process>("P3", 2, 9, Priority::LOW),     // Long low-priority process
-        make_shared<Process>("P4", 3, 5, Priority::MEDIUM),  // Medium process
-        make_shared<Process>("P5", 4, 2, Priority::HIGH)     // Short high-priority process
-    };
+    // The workload is shared read-only by every scheduler below
+    auto sampleProcesses = createSampleWorkload();
     
     // Display program header and process information
     cout << "=== OS Process Scheduling System Demo ===" << endl;
@@ -36,46 +75,1181 @@ void demonstrateScheduling() {
     cout << string(40, '-') << endl;
     
     // Display process details
-    for (const auto& process : sampleProcesses) {
-        cout << setw(5) << process->pid 
-             << setw(8) << process->name
-             << setw(10) << process->arrivalTime
-             << setw(8) << process->burstTime
-             << setw(10) << static_cast<int>(process->priority) << endl;
-    }
-    
-    // Create instances of all scheduling algorithms
-    vector<unique_ptr<Scheduler>> schedulers;
-    schedulers.push_back(make_unique<FCFSScheduler>());
-    schedulers.push_back(make_unique<SJFScheduler>());
-    schedulers.push_back(make_unique<RoundRobinScheduler>(3));  // Quantum = 3
-    schedulers.push_back(make_unique<PriorityScheduler>());
-    
-    // Run each scheduling algorithm
-    for (auto& scheduler : schedulers) {
-        // Add copies of processes to scheduler (each algorithm gets fresh processes)
-        for (const auto& process : sampleProcesses) {
-            auto processCopy = make_shared<Process>(process->name, process->arrivalTime, 
-                                                   process->burstTime, process->priority);
-            scheduler->addProcess(processCopy);
-        }
-        
-        // Execute the scheduling algorithm
-        scheduler->schedule();
-        
-        // Display performance statistics
-        scheduler->printStatistics();
-        
-        // Wait for user input before proceeding to next algorithm
-        cout << "Press Enter to continue to next algorithm...";
-        cin.get();
+    for (ProcessHandle process = 0; process < sampleProcesses->size(); ++process) {
+        cout << setw(5) << sampleProcesses->pid[process]
+             << setw(8) << sampleProcesses->name(process)
+             << setw(10) << sampleProcesses->arrivalTime[process]
+             << setw(8) << sampleProcesses->burstTime[process]
+             << setw(10) << static_cast<int>(sampleProcesses->priority[process]) << endl;
+    }
+    
+    // Register all scheduling algorithms on the shared workload
+    ComparisonRunner runner(sampleProcesses);
+    runner.addScheduler(make_unique<FCFSScheduler>());
+    runner.addScheduler(make_unique<SJFScheduler>());
+    runner.addScheduler(make_unique<SJFScheduler>(true));
+    runner.addScheduler(make_unique<RoundRobinScheduler>(3), "Round Robin (q=3)");  // Quantum = 3
+    runner.addScheduler(make_unique<PriorityScheduler>());
+    runner.addScheduler(make_unique<PriorityScheduler>(true));
+    runner.addScheduler(make_unique<MLFQScheduler>(3, 3), "MLFQ (3 levels, q=3)");
+    runner.addScheduler(make_unique<CFSScheduler>());
+    
+    // Run every algorithm in parallel, each on its own process table
+    runner.run();
+    
+    // Display performance statistics of each algorithm
+    for (size_t i = 0; i < runner.getSchedulerCount(); ++i) {
+        runner.getScheduler(i).printStatistics();
     }
+    runner.printComparison();
+    
+    // Search for the Round Robin quantum with the lowest average waiting time
+    QuantumSweep sweep(sampleProcesses, SchedulingMetric::WAITING_TIME);
+    sweep.addQuantumRange(1, 8);
+    sweep.run();
+    sweep.printResults();
     
     cout << "\n=== Simulation Complete ===" << endl;
     cout << "Compare the average waiting times, turnaround times, and response times" << endl;
     cout << "to understand the performance characteristics of each algorithm." << endl;
 }
 
+// ========================================================================================
+// COMMAND LINE INTERFACE
+// ========================================================================================
+
+/**
+ * Command Line Options
+ * Settings of one batch run
+ */
+struct CommandLineOptions {
+    string algorithm = "all";               // fcfs, sjf, srtf, rr, priority, ppriority, mlfq, cfs, edf, rm or all
+    int quantum = 3;                        // Round Robin time quantum (MLFQ: level 0 quantum)
+    int mlfqLevels = 3;                     // MLFQ levels
+    int boostInterval = 100;                // MLFQ priority boost interval (0 = never)
+    int agingThreshold = 50;                // MLFQ aging threshold (0 = no aging)
+    int targetLatency = 24;                 // CFS target latency
+    int minGranularity = 3;                 // CFS minimum granularity
+    string inputPath;                       // Workload trace (empty = built-in sample)
+    WorkloadFormat inputFormat = WorkloadFormat::AUTO;  // Format of the trace
+    bool generate = false;                  // Use a synthetic workload instead of a trace
+    bool live = false;                      // Simulate processes submitted on stdin while running
+    LiveClock liveClock = LiveClock::VIRTUAL;  // Clock of the live feed
+    double timeScale = 1000.0;              // Live wall clock: time units per second
+    WorkloadGeneratorOptions generator;     // Shape of the synthetic workload
+    string outputFormat = "table";          // table or csv
+    Verbosity verbosity = Verbosity::NORMAL;  // Reporting level
+    size_t threads = 0;                     // Worker threads (0 = all cores)
+    int cpus = 1;                           // Simulated CPUs
+    LoadBalancing balancing = LoadBalancing::GLOBAL_QUEUE;  // How CPUs share ready processes
+    int balanceInterval = 10;               // Time between periodic balancing passes
+    DispatchCosts dispatchCosts;            // Overhead charged on every dispatch
+    int throughputWindow = 100;             // Initial width of the throughput windows
+    int releaseHorizon = 0;                 // Time after which periodic jobs stop (0 = automatic)
+    string groupsPath;                      // Process group hierarchy (empty = no groups)
+    shared_ptr<const GroupHierarchy> groups;  // Loaded from groupsPath
+    bool sweep = false;                     // Run a Round Robin quantum sweep instead
+    int sweepFirst = 1;                     // Smallest swept quantum
+    int sweepLast = 10;                     // Largest swept quantum
+    int sweepStep = 1;                      // Increment between swept quanta
+    SchedulingMetric objective = SchedulingMetric::WAITING_TIME;  // Sweep objective
+    int forkAt = -1;                        // Compare from a snapshot taken at this time (-1 = off)
+    string forkFrom = "fcfs";               // Algorithm that runs up to the fork
+    int replications = 0;                   // Most seeded replications per algorithm (0 = a single run)
+    double ciWidth = 0.0;                   // Target relative half-width of the intervals (0 = run them all)
+    double confidence = 0.95;               // Confidence level of the intervals
+    int coordinatorPort = -1;               // Coordinate a distributed sweep on this port (-1 = off)
+    int localWorkers = 0;                   // Sweep workers run inside the coordinator
+    bool seeds = false;                     // Sweep one generated workload per seed
+    int seedFirst = 1;                      // First swept seed
+    int seedLast = 1;                       // Last swept seed
+    int shardSize = 0;                      // Most runs per shard (0 = the worker's threads)
+    int retries = SweepCoordinator::DEFAULT_RETRIES;  // Requeues of a run whose worker failed
+    double shardTimeout = 0.0;              // Seconds a worker may stay silent (0 = no limit)
+    string workerHost;                      // Coordinator to work for (empty = not a worker)
+    int workerPort = 0;                     // Port of that coordinator
+    string cacheDirectory;                  // Worker workload cache (empty = none)
+    string saveBinaryPath;                  // Convert the input to binary and exit
+    string recordPath;                      // Binary execution trace to record
+    string profilePath;                     // Engine profile counters to dump as JSON
+    string resultsPath;                     // Per-process results to export (.csv or columnar)
+    bool compressResults = false;           // Delta compress the columnar results
+    string convertInputPath;                // Columnar results to convert
+    string convertOutputPath;               // CSV destination of the conversion
+    string exportTracePath;                 // Binary execution trace to convert
+    string exportOutputPath;                // Gantt chart destination (.json or .csv)
+    bool demo = false;                      // Run the demonstration instead
+};
+
+/**
+ * Print Usage
+ * 
+ * @param program - Program name from argv[0]
+ */
+void printUsage(const char* program) {
+    cout << "Usage: " << program << " [options]\n"
+         << "\n"
+         << "Options:\n"
+         << "  -a, --algorithm NAME     fcfs, sjf, srtf, rr, priority, ppriority, mlfq, cfs,\n"
+         << "                           edf, rm or all (default: all; ppriority is preemptive\n"
+         << "                           priority, rm is rate monotonic; all includes edf and rm\n"
+         << "                           when the workload has deadlines)\n"
+         << "  -q, --quantum N          Round Robin time quantum, MLFQ level 0 quantum (default: 3)\n"
+         << "      --levels N           MLFQ levels, quantum doubles per level (default: 3)\n"
+         << "      --boost N            MLFQ priority boost interval, 0 = never (default: 100)\n"
+         << "      --aging N            MLFQ aging threshold, 0 = off (default: 50)\n"
+         << "      --latency N          CFS target latency (default: 24)\n"
+         << "      --granularity N      CFS minimum granularity (default: 3)\n"
+         << "  -i, --input FILE         Workload trace, CSV or binary (default: built-in sample)\n"
+         << "      --input-format FMT   auto, csv or binary (default: auto)\n"
+         << "      --generate N         Stream N synthetic processes instead of a trace\n"
+         << "      --seed N             Generator seed (default: 1)\n"
+         << "      --arrivals MODE      poisson, bursty or batch (default: poisson)\n"
+         << "      --rate R             Mean arrivals per time unit (default: 0.08)\n"
+         << "      --bursts DIST        exponential, pareto, bimodal or uniform\n"
+         << "                           (default: exponential)\n"
+         << "      --mean-burst N       Mean CPU burst (default: 10)\n"
+         << "      --priority-mix H:M:L Relative weights of the priority classes\n"
+         << "                           (default: 1:1:1)\n"
+         << "      --live CLOCK         Simulate processes submitted on stdin while the run\n"
+         << "                           goes on, following the virtual clock (arrival column)\n"
+         << "                           or the wall clock (arrival on receipt)\n"
+         << "      --time-scale N       Live wall clock time units per second (default: 1000)\n"
+         << "  -o, --output FMT         table or csv (default: table)\n"
+         << "  -v, --verbosity N        0 = results only, 1 = progress messages,\n"
+         << "                           2 = execution trace and per-process tables (default: 1)\n"
+         << "  -t, --threads N          Worker threads, 0 = all cores (default: 0)\n"
+         << "  -c, --cpus N             Simulated CPUs, 1 to 256 (default: 1)\n"
+         << "      --balance MODE       global, periodic or steal (default: global)\n"
+         << "      --balance-interval N Time between periodic balancing passes (default: 10)\n"
+         << "      --switch-cost N      CPU time per context switch (default: 0)\n"
+         << "      --warmup-cost N      Cache warmup of a process that did not run last\n"
+         << "                           on its CPU (default: 0)\n"
+         << "      --migration-cost N   Extra cost of a dispatch on another CPU (default: 0)\n"
+         << "      --throughput-window N  Initial throughput window width, doubled as\n"
+         << "                             the run grows (default: 100)\n"
+         << "      --horizon T          Time after which periodic processes release no more\n"
+         << "                           jobs, 0 = one hyperperiod after the last first release\n"
+         << "                           (default: 0)\n"
+         << "      --groups FILE        Share the CPUs between the process groups declared in\n"
+         << "                           FILE (path,weight[,quota=N][,period=N] per line);\n"
+         << "                           processes join the group of their group=PATH field\n"
+         << "      --sweep FIRST:LAST[:STEP]  Round Robin quantum sweep\n"
+         << "      --objective METRIC   Sweep objective: waiting, turnaround, response\n"
+         << "                           or switches (default: waiting)\n"
+         << "      --fork-at T          Run --fork-from up to time T, then compare the\n"
+         << "                           algorithms from that snapshot\n"
+         << "      --fork-from NAME     Algorithm that runs before the fork (default: fcfs)\n"
+         << "      --replications N     Run up to N seeded replications of --generate per\n"
+         << "                           algorithm and report confidence intervals\n"
+         << "      --ci-width PCT       Stop replicating once the average waiting, turnaround\n"
+         << "                           and response intervals are within PCT% of their means\n"
+         << "      --confidence PCT     Confidence level of the intervals (default: 95)\n"
+         << "      --coordinator PORT   Coordinate a distributed sweep of the -a algorithms\n"
+         << "                           (--sweep quanta for rr and mlfq) on every workload;\n"
+         << "                           workers connect to PORT (0 = any free port)\n"
+         << "      --seeds FIRST:LAST   Coordinator: one --generate workload per seed\n"
+         << "      --local-workers N    Coordinator: also run N workers in this process\n"
+         << "      --shard-size N       Coordinator: most runs per shard (default: the\n"
+         << "                           worker's thread count)\n"
+         << "      --retries N          Coordinator: requeues of a run whose worker failed\n"
+         << "                           (default: 3)\n"
+         << "      --shard-timeout S    Coordinator: requeue a shard after S silent seconds\n"
+         << "                           (default: 0 = never)\n"
+         << "      --worker HOST:PORT   Run sweep shards for a coordinator until it is done\n"
+         << "      --cache DIR          Worker: keep received workloads in DIR\n"
+         << "      --save-binary FILE   Write the workload in binary format and exit\n"
+         << "      --record FILE        Record a binary execution trace (one algorithm only)\n"
+         << "      --profile FILE       Write the engine profile counters of every run as\n"
+         << "                           JSON (needs a build with -DSCHEDULER_PROFILING)\n"
+         << "      --results FILE       Stream per-process results (one algorithm only):\n"
+         << "                           CSV if FILE ends in .csv, columnar binary otherwise\n"
+         << "      --compress           Delta compress the columnar --results file\n"
+         << "      --convert-results IN OUT  Convert a columnar results file to CSV\n"
+         << "      --export-gantt TRACE OUT  Convert a recorded trace to a Gantt chart:\n"
+         << "                           CSV if OUT ends in .csv, Chrome trace JSON otherwise\n"
+         << "      --demo               Run the built-in demonstration\n"
+         << "  -h, --help               Show this help\n";
+}
+
+/**
+ * Parse Integer Argument
+ * 
+ * @param text - Argument text
+ * @param value - Receives the value
+ * @return True if the whole argument is an integer
+ */
+bool parseIntegerArgument(const string& text, int& value) {
+    try {
+        size_t used = 0;
+        value = stoi(text, &used);
+        return used == text.size();
+    } catch (const exception&) {
+        return false;
+    }
+}
+
+/**
+ * Parse Real Argument
+ * 
+ * @param text - Argument text
+ * @param value - Receives the value
+ * @return True if the whole argument is a number
+ */
+bool parseRealArgument(const string& text, double& value) {
+    try {
+        size_t used = 0;
+        value = stod(text, &used);
+        return used == text.size();
+    } catch (const exception&) {
+        return false;
+    }
+}
+
+/**
+ * Parse Command Line
+ * 
+ * @param argc - Argument count
+ * @param argv - Arguments
+ * @param options - Receives the parsed settings
+ * @return 0 to run, 1 if help was printed, -1 on invalid arguments
+ */
+int parseCommandLine(int argc, char* argv[], CommandLineOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        
+        // Options taking a value
+        auto value = [&](string& out) {
+            if (i + 1 >= argc) {
+                cerr << "Error: Option " << arg << " requires a value" << endl;
+                return false;
+            }
+            out = argv[++i];
+            return true;
+        };
+        auto number = [&](int& out, int minimum) {
+            string text;
+            if (!value(text)) return false;
+            if (!parseIntegerArgument(text, out) || out < minimum) {
+                cerr << "Error: Invalid value '" << text << "' for " << arg << endl;
+                return false;
+            }
+            return true;
+        };
+        
+        string text;
+        int parsed = 0;
+        if (arg == "-h" || arg == "--help") {
+            printUsage(argv[0]);
+            return 1;
+        } else if (arg == "--demo") {
+            options.demo = true;
+        } else if (arg == "-a" || arg == "--algorithm") {
+            if (!value(options.algorithm)) return -1;
+            const string& name = options.algorithm;
+            if (name != "fcfs" && name != "sjf" && name != "srtf" && name != "rr" &&
+                name != "priority" && name != "ppriority" && name != "mlfq" && name != "cfs" &&
+                name != "edf" && name != "rm" && name != "all") {
+                cerr << "Error: Unknown algorithm '" << options.algorithm << "'" << endl;
+                return -1;
+            }
+        } else if (arg == "-q" || arg == "--quantum") {
+            if (!number(options.quantum, 1)) return -1;
+        } else if (arg == "--levels") {
+            if (!number(options.mlfqLevels, 1)) return -1;
+            if (options.mlfqLevels > MultilevelReadyQueue::MAX_LEVELS) {
+                cerr << "Error: MLFQ supports at most " << MultilevelReadyQueue::MAX_LEVELS << " levels" << endl;
+                return -1;
+            }
+        } else if (arg == "--boost") {
+            if (!number(options.boostInterval, 0)) return -1;
+        } else if (arg == "--aging") {
+            if (!number(options.agingThreshold, 0)) return -1;
+        } else if (arg == "--latency") {
+            if (!number(options.targetLatency, 1)) return -1;
+        } else if (arg == "--granularity") {
+            if (!number(options.minGranularity, 1)) return -1;
+        } else if (arg == "-i" || arg == "--input") {
+            if (!value(options.inputPath)) return -1;
+        } else if (arg == "--input-format") {
+            if (!value(text)) return -1;
+            if (text == "auto") options.inputFormat = WorkloadFormat::AUTO;
+            else if (text == "csv") options.inputFormat = WorkloadFormat::CSV;
+            else if (text == "binary") options.inputFormat = WorkloadFormat::BINARY;
+            else {
+                cerr << "Error: Unknown input format '" << text << "'" << endl;
+                return -1;
+            }
+        } else if (arg == "--generate") {
+            if (!number(parsed, 1)) return -1;
+            options.generate = true;
+            options.generator.count = static_cast<uint64_t>(parsed);
+        } else if (arg == "--live") {
+            if (!value(text)) return -1;
+            if (text == "virtual") options.liveClock = LiveClock::VIRTUAL;
+            else if (text == "wall") options.liveClock = LiveClock::WALL;
+            else {
+                cerr << "Error: Unknown live clock '" << text << "'" << endl;
+                return -1;
+            }
+            options.live = true;
+        } else if (arg == "--time-scale") {
+            if (!value(text)) return -1;
+            if (!parseRealArgument(text, options.timeScale) || !(options.timeScale > 0.0)) {
+                cerr << "Error: Invalid value '" << text << "' for " << arg << endl;
+                return -1;
+            }
+        } else if (arg == "--seed") {
+            if (!number(parsed, 0)) return -1;
+            options.generator.seed = static_cast<uint64_t>(parsed);
+        } else if (arg == "--arrivals") {
+            if (!value(text)) return -1;
+            if (text == "poisson") options.generator.arrivals = ArrivalPattern::POISSON;
+            else if (text == "bursty") options.generator.arrivals = ArrivalPattern::BURSTY;
+            else if (text == "batch") options.generator.arrivals = ArrivalPattern::BATCH;
+            else {
+                cerr << "Error: Unknown arrival pattern '" << text << "'" << endl;
+                return -1;
+            }
+        } else if (arg == "--rate") {
+            if (!value(text)) return -1;
+            if (!parseRealArgument(text, options.generator.arrivalRate) || !(options.generator.arrivalRate > 0.0)) {
+                cerr << "Error: Invalid value '" << text << "' for " << arg << endl;
+                return -1;
+            }
+        } else if (arg == "--bursts") {
+            if (!value(text)) return -1;
+            if (text == "exponential") options.generator.bursts = BurstDistribution::EXPONENTIAL;
+            else if (text == "pareto") options.generator.bursts = BurstDistribution::PARETO;
+            else if (text == "bimodal") options.generator.bursts = BurstDistribution::BIMODAL;
+            else if (text == "uniform") options.generator.bursts = BurstDistribution::UNIFORM;
+            else {
+                cerr << "Error: Unknown burst distribution '" << text << "'" << endl;
+                return -1;
+            }
+        } else if (arg == "--mean-burst") {
+            if (!number(parsed, 1)) return -1;
+            options.generator.meanBurst = parsed;
+        } else if (arg == "--priority-mix") {
+            if (!value(text)) return -1;
+            size_t first = text.find(':');
+            size_t second = first == string::npos ? string::npos : text.find(':', first + 1);
+            double* mix = options.generator.priorityMix;
+            bool ok = second != string::npos &&
+                      parseRealArgument(text.substr(0, first), mix[0]) &&
+                      parseRealArgument(text.substr(first + 1, second - first - 1), mix[1]) &&
+                      parseRealArgument(text.substr(second + 1), mix[2]) &&
+                      mix[0] >= 0.0 && mix[1] >= 0.0 && mix[2] >= 0.0 && mix[0] + mix[1] + mix[2] > 0.0;
+            if (!ok) {
+                cerr << "Error: Invalid priority mix '" << text << "' (expected HIGH:MEDIUM:LOW weights)" << endl;
+                return -1;
+            }
+        } else if (arg == "-o" || arg == "--output") {
+            if (!value(options.outputFormat)) return -1;
+            if (options.outputFormat != "table" && options.outputFormat != "csv") {
+                cerr << "Error: Unknown output format '" << options.outputFormat << "'" << endl;
+                return -1;
+            }
+        } else if (arg == "-v" || arg == "--verbosity") {
+            if (!number(parsed, 0)) return -1;
+            options.verbosity = static_cast<Verbosity>(min(parsed, static_cast<int>(Verbosity::TRACE)));
+        } else if (arg == "-t" || arg == "--threads") {
+            if (!number(parsed, 0)) return -1;
+            options.threads = static_cast<size_t>(parsed);
+        } else if (arg == "-c" || arg == "--cpus") {
+            if (!number(options.cpus, 1)) return -1;
+            if (options.cpus > 256) {
+                cerr << "Error: At most 256 CPUs can be simulated" << endl;
+                return -1;
+            }
+        } else if (arg == "--balance") {
+            if (!value(text)) return -1;
+            if (text == "global") options.balancing = LoadBalancing::GLOBAL_QUEUE;
+            else if (text == "periodic") options.balancing = LoadBalancing::PERIODIC;
+            else if (text == "steal") options.balancing = LoadBalancing::WORK_STEALING;
+            else {
+                cerr << "Error: Unknown balancing mode '" << text << "'" << endl;
+                return -1;
+            }
+        } else if (arg == "--balance-interval") {
+            if (!number(options.balanceInterval, 1)) return -1;
+        } else if (arg == "--switch-cost") {
+            if (!number(parsed, 0)) return -1;
+            options.dispatchCosts.contextSwitch = parsed;
+        } else if (arg == "--warmup-cost") {
+            if (!number(parsed, 0)) return -1;
+            options.dispatchCosts.cacheWarmup = parsed;
+        } else if (arg == "--migration-cost") {
+            if (!number(parsed, 0)) return -1;
+            options.dispatchCosts.migration = parsed;
+        } else if (arg == "--throughput-window") {
+            if (!number(options.throughputWindow, 1)) return -1;
+        } else if (arg == "--horizon") {
+            if (!number(options.releaseHorizon, 0)) return -1;
+        } else if (arg == "--groups") {
+            if (!value(options.groupsPath)) return -1;
+        } else if (arg == "--sweep") {
+            if (!value(text)) return -1;
+            size_t first = text.find(':');
+            size_t second = first == string::npos ? string::npos : text.find(':', first + 1);
+            bool ok = first != string::npos &&
+                      parseIntegerArgument(text.substr(0, first), options.sweepFirst) &&
+                      parseIntegerArgument(text.substr(first + 1, second - first - 1), options.sweepLast) &&
+                      (second == string::npos || parseIntegerArgument(text.substr(second + 1), options.sweepStep));
+            if (!ok || options.sweepFirst < 1 || options.sweepLast < options.sweepFirst || options.sweepStep < 1) {
+                cerr << "Error: Invalid sweep range '" << text << "' (expected FIRST:LAST[:STEP])" << endl;
+                return -1;
+            }
+            options.sweep = true;
+        } else if (arg == "--objective") {
+            if (!value(text)) return -1;
+            if (text == "waiting") options.objective = SchedulingMetric::WAITING_TIME;
+            else if (text == "turnaround") options.objective = SchedulingMetric::TURNAROUND_TIME;
+            else if (text == "response") options.objective = SchedulingMetric::RESPONSE_TIME;
+            else if (text == "switches") options.objective = SchedulingMetric::CONTEXT_SWITCHES;
+            else {
+                cerr << "Error: Unknown objective '" << text << "'" << endl;
+                return -1;
+            }
+        } else if (arg == "--fork-at") {
+            if (!number(options.forkAt, 0)) return -1;
+        } else if (arg == "--fork-from") {
+            if (!value(options.forkFrom)) return -1;
+            const string& name = options.forkFrom;
+            if (name != "fcfs" && name != "sjf" && name != "srtf" && name != "rr" &&
+                name != "priority" && name != "ppriority" && name != "mlfq" && name != "cfs" &&
+                name != "edf" && name != "rm") {
+                cerr << "Error: Unknown algorithm '" << options.forkFrom << "' for --fork-from" << endl;
+                return -1;
+            }
+        } else if (arg == "--replications") {
+            if (!number(options.replications, 1)) return -1;
+        } else if (arg == "--ci-width") {
+            if (!value(text)) return -1;
+            if (!parseRealArgument(text, options.ciWidth) || !(options.ciWidth > 0.0)) {
+                cerr << "Error: Invalid value '" << text << "' for " << arg << endl;
+                return -1;
+            }
+            options.ciWidth /= 100.0;
+        } else if (arg == "--confidence") {
+            if (!value(text)) return -1;
+            if (!parseRealArgument(text, options.confidence) ||
+                !(options.confidence > 0.0 && options.confidence < 100.0)) {
+                cerr << "Error: Invalid value '" << text << "' for " << arg << endl;
+                return -1;
+            }
+            options.confidence /= 100.0;
+        } else if (arg == "--coordinator") {
+            if (!number(options.coordinatorPort, 0)) return -1;
+        } else if (arg == "--local-workers") {
+            if (!number(options.localWorkers, 1)) return -1;
+        } else if (arg == "--seeds") {
+            if (!value(text)) return -1;
+            size_t colon = text.find(':');
+            bool ok = colon != string::npos &&
+                      parseIntegerArgument(text.substr(0, colon), options.seedFirst) &&
+                      parseIntegerArgument(text.substr(colon + 1), options.seedLast);
+            if (!ok || options.seedFirst < 0 || options.seedLast < options.seedFirst) {
+                cerr << "Error: Invalid seed range '" << text << "' (expected FIRST:LAST)" << endl;
+                return -1;
+            }
+            options.seeds = true;
+        } else if (arg == "--shard-size") {
+            if (!number(options.shardSize, 1)) return -1;
+        } else if (arg == "--retries") {
+            if (!number(options.retries, 0)) return -1;
+        } else if (arg == "--shard-timeout") {
+            if (!value(text)) return -1;
+            if (!parseRealArgument(text, options.shardTimeout) || !(options.shardTimeout > 0.0)) {
+                cerr << "Error: Invalid value '" << text << "' for " << arg << endl;
+                return -1;
+            }
+        } else if (arg == "--worker") {
+            if (!value(text)) return -1;
+            size_t colon = text.rfind(':');
+            if (colon == string::npos || colon == 0 ||
+                !parseIntegerArgument(text.substr(colon + 1), options.workerPort) ||
+                options.workerPort < 1 || options.workerPort > 65535) {
+                cerr << "Error: Invalid coordinator address '" << text << "' (expected HOST:PORT)" << endl;
+                return -1;
+            }
+            options.workerHost = text.substr(0, colon);
+        } else if (arg == "--cache") {
+            if (!value(options.cacheDirectory)) return -1;
+        } else if (arg == "--save-binary") {
+            if (!value(options.saveBinaryPath)) return -1;
+        } else if (arg == "--record") {
+            if (!value(options.recordPath)) return -1;
+        } else if (arg == "--profile") {
+            if (!value(options.profilePath)) return -1;
+        } else if (arg == "--results") {
+            if (!value(options.resultsPath)) return -1;
+        } else if (arg == "--compress") {
+            options.compressResults = true;
+        } else if (arg == "--convert-results") {
+            if (!value(options.convertInputPath) || !value(options.convertOutputPath)) return -1;
+        } else if (arg == "--export-gantt") {
+            if (!value(options.exportTracePath) || !value(options.exportOutputPath)) return -1;
+        } else {
+            cerr << "Error: Unknown option '" << arg << "'" << endl;
+            return -1;
+        }
+    }
+    
+    if (options.generate && !options.inputPath.empty()) {
+        cerr << "Error: --generate and --input cannot be combined" << endl;
+        return -1;
+    }
+    if (!options.recordPath.empty() && (options.algorithm == "all" || options.sweep)) {
+        cerr << "Error: --record needs a single algorithm (-a) and no --sweep" << endl;
+        return -1;
+    }
+    if (options.forkAt >= 0 && options.sweep) {
+        cerr << "Error: --fork-at and --sweep cannot be combined" << endl;
+        return -1;
+    }
+    if (options.replications > 0 && (!options.generate || options.sweep || options.forkAt >= 0 ||
+                                     !options.recordPath.empty() || !options.saveBinaryPath.empty())) {
+        cerr << "Error: --replications needs --generate, without --sweep, --fork-at, --record or --save-binary" << endl;
+        return -1;
+    }
+    if (options.live && (options.algorithm == "all" || options.generate || !options.inputPath.empty() ||
+                         options.sweep || options.forkAt >= 0 || options.replications > 0 ||
+                         !options.saveBinaryPath.empty() || !options.exportTracePath.empty())) {
+        cerr << "Error: --live needs a single algorithm (-a), without --input, --generate, --sweep,"
+             << " --fork-at, --replications, --save-binary or --export-gantt" << endl;
+        return -1;
+    }
+    if (!options.resultsPath.empty() && (options.algorithm == "all" || options.sweep || options.replications > 0)) {
+        cerr << "Error: --results needs a single algorithm (-a), without --sweep or --replications" << endl;
+        return -1;
+    }
+    if (options.compressResults &&
+        (options.resultsPath.empty() || ResultsWriter::formatFromPath(options.resultsPath) == ResultsFormat::CSV)) {
+        cerr << "Error: --compress needs a columnar --results file" << endl;
+        return -1;
+    }
+    if (!options.profilePath.empty() && (options.sweep || options.replications > 0)) {
+        cerr << "Error: --profile cannot be combined with --sweep or --replications" << endl;
+        return -1;
+    }
+    if (!options.groupsPath.empty() && (options.sweep || options.forkAt >= 0 || options.replications > 0 ||
+                                        options.coordinatorPort >= 0 || !options.workerHost.empty())) {
+        cerr << "Error: --groups cannot be combined with --sweep, --fork-at, --replications,"
+             << " --coordinator or --worker" << endl;
+        return -1;
+    }
+    if (options.ciWidth > 0.0 && options.replications == 0) {
+        cerr << "Error: --ci-width needs --replications" << endl;
+        return -1;
+    }
+    bool coordinator = options.coordinatorPort >= 0;
+    if (coordinator && options.coordinatorPort > 65535) {
+        cerr << "Error: Invalid port " << options.coordinatorPort << " for --coordinator" << endl;
+        return -1;
+    }
+    if ((coordinator || !options.workerHost.empty()) &&
+        (options.live || options.forkAt >= 0 || options.replications > 0 || !options.recordPath.empty() ||
+         !options.resultsPath.empty() || !options.profilePath.empty() || !options.saveBinaryPath.empty() ||
+         !options.exportTracePath.empty())) {
+        cerr << "Error: --coordinator and --worker cannot be combined with --live, --fork-at, --replications,"
+             << " --record, --results, --profile, --save-binary or --export-gantt" << endl;
+        return -1;
+    }
+    if (coordinator && !options.workerHost.empty()) {
+        cerr << "Error: --coordinator and --worker cannot be combined (use --local-workers)" << endl;
+        return -1;
+    }
+    if (!coordinator && (options.seeds || options.localWorkers > 0 || options.shardSize > 0 ||
+                         options.retries != static_cast<int>(SweepCoordinator::DEFAULT_RETRIES) ||
+                         options.shardTimeout > 0.0)) {
+        cerr << "Error: --seeds, --local-workers, --shard-size, --retries and --shard-timeout need --coordinator" << endl;
+        return -1;
+    }
+    if (options.seeds && !options.generate) {
+        cerr << "Error: --seeds needs --generate" << endl;
+        return -1;
+    }
+    if (!options.cacheDirectory.empty() && options.workerHost.empty()) {
+        cerr << "Error: --cache needs --worker" << endl;
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * Create Scheduler
+ * 
+ * @param algorithm - fcfs, sjf, srtf, rr, priority, ppriority, mlfq, cfs, edf or rm
+ * @param options - Policy parameters (quantum, MLFQ and CFS settings)
+ * @return New scheduler (nullptr for an unknown name)
+ */
+unique_ptr<Scheduler> createScheduler(const string& algorithm, const CommandLineOptions& options) {
+    int quantum = options.quantum;
+    if (algorithm == "fcfs") return make_unique<FCFSScheduler>();
+    if (algorithm == "sjf") return make_unique<SJFScheduler>();
+    if (algorithm == "srtf") return make_unique<SJFScheduler>(true);
+    if (algorithm == "rr") return make_unique<RoundRobinScheduler>(quantum);
+    if (algorithm == "priority") return make_unique<PriorityScheduler>();
+    if (algorithm == "ppriority") return make_unique<PriorityScheduler>(true);
+    if (algorithm == "mlfq") {
+        return make_unique<MLFQScheduler>(options.mlfqLevels, quantum,
+                                          options.boostInterval, options.agingThreshold);
+    }
+    if (algorithm == "cfs") return make_unique<CFSScheduler>(options.targetLatency, options.minGranularity);
+    if (algorithm == "edf") return make_unique<EDFScheduler>();
+    if (algorithm == "rm") return make_unique<RateMonotonicScheduler>();
+    return nullptr;
+}
+
+/**
+ * Get Scheduler Label
+ * 
+ * @param algorithm - Command line name of the algorithm
+ * @param scheduler - Scheduler created for it
+ * @param options - Policy parameters shown in the label
+ * @return Name shown in the result tables
+ */
+string getSchedulerLabel(const string& algorithm, const Scheduler& scheduler, const CommandLineOptions& options) {
+    string label = scheduler.getAlgorithmName();
+    if (algorithm == "rr") {
+        label += " (q=" + to_string(options.quantum) + ")";
+    } else if (algorithm == "mlfq") {
+        label += " (" + to_string(options.mlfqLevels) + " levels, q=" + to_string(options.quantum) + ")";
+    }
+    return label;
+}
+
+/**
+ * Configure Machine
+ * Applies the CPU, balancing, overhead, throughput, release horizon and
+ * process group settings
+ * 
+ * @param scheduler - Scheduler to configure
+ * @param options - Parsed settings
+ */
+void configureMachine(Scheduler& scheduler, const CommandLineOptions& options) {
+    scheduler.setCpuCount(options.cpus);
+    scheduler.setLoadBalancing(options.balancing, options.balanceInterval);
+    scheduler.setDispatchCosts(options.dispatchCosts);
+    scheduler.setThroughputWindow(options.throughputWindow);
+    scheduler.setReleaseHorizon(options.releaseHorizon);
+    if (options.groups) {
+        scheduler.setProcessGroups(options.groups);
+    }
+}
+
+/**
+ * Write Profile
+ * One JSON object per compared run, in table order
+ * 
+ * @param path - Destination file
+ * @param runner - Runner whose schedulers ran
+ * @return True if the file was written
+ */
+bool writeProfile(const string& path, const ComparisonRunner& runner) {
+    ofstream output(path, ios::trunc);
+    if (!output) {
+        cerr << "Error: Cannot open " << path << " for writing" << endl;
+        return false;
+    }
+    
+    output << "[\n";
+    for (size_t i = 0; i < runner.getSchedulerCount(); ++i) {
+        output << "  ";
+        runner.getScheduler(i).getProfile().printJson(output, runner.getResults()[i].label);
+        output << (i + 1 < runner.getSchedulerCount() ? ",\n" : "\n");
+    }
+    output << "]\n";
+    if (!output) {
+        cerr << "Error: Failed to write " << path << endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Create Sweep Factory
+ * Builds the schedulers of distributed sweep tasks from the command line
+ * policy parameters and the coordinator's machine settings
+ * 
+ * @param options - Parsed settings
+ * @return Factory for SweepWorker
+ */
+SweepSchedulerFactory createSweepFactory(const CommandLineOptions& options) {
+    return [options](const SweepTask& task, const SweepSettings& settings) {
+        CommandLineOptions run = options;
+        run.quantum = task.quantum > 0 ? task.quantum : options.quantum;
+        run.cpus = settings.cpus;
+        run.balancing = settings.balancing;
+        run.balanceInterval = settings.balanceInterval;
+        run.dispatchCosts = settings.dispatchCosts;
+        run.throughputWindow = settings.throughputWindow;
+        run.releaseHorizon = settings.releaseHorizon;
+        run.mlfqLevels = settings.mlfqLevels;
+        run.boostInterval = settings.boostInterval;
+        run.agingThreshold = settings.agingThreshold;
+        run.targetLatency = settings.targetLatency;
+        run.minGranularity = settings.minGranularity;
+        auto scheduler = createScheduler(task.algorithm, run);
+        if (scheduler) {
+            configureMachine(*scheduler, run);
+        }
+        return scheduler;
+    };
+}
+
+/**
+ * Run Sweep Worker
+ * Serves a distributed sweep coordinator until the sweep is done
+ * 
+ * @param options - Parsed settings
+ * @return Process exit code
+ */
+int runSweepWorker(const CommandLineOptions& options) {
+    bool progress = options.verbosity >= Verbosity::NORMAL;
+    if (!options.cacheDirectory.empty()) {
+        error_code error;
+        filesystem::create_directories(options.cacheDirectory, error);
+        if (error) {
+            cerr << "Error: Cannot create cache directory " << options.cacheDirectory << endl;
+            return 1;
+        }
+    }
+    
+    SweepWorker worker(createSweepFactory(options), options.threads);
+    worker.setCacheDirectory(options.cacheDirectory);
+    if (progress) {
+        cerr << "Working for " << options.workerHost << ":" << options.workerPort << endl;
+    }
+    bool success = worker.run(options.workerHost, options.workerPort);
+    if (progress) {
+        cerr << "Ran " << worker.getShardCount() << " shards; received "
+             << worker.getWorkloadsReceived() << " workloads" << endl;
+    }
+    return success ? 0 : 1;
+}
+
+/**
+ * Run Sweep Coordinator
+ * Distributes every configuration on every workload over the workers that
+ * connect, then prints one pooled row per configuration
+ * 
+ * @param options - Parsed settings
+ * @return Process exit code
+ */
+int runSweepCoordinator(const CommandLineOptions& options) {
+    bool progress = options.verbosity >= Verbosity::NORMAL;
+    
+    // Workloads: one per seed, one generated, the trace or the built-in sample
+    vector<pair<shared_ptr<const Workload>, string>> workloads;
+    if (options.generate) {
+        int first = options.seeds ? options.seedFirst : static_cast<int>(options.generator.seed);
+        int last = options.seeds ? options.seedLast : first;
+        for (int seed = first; seed <= last; ++seed) {
+            WorkloadGeneratorOptions shape = options.generator;
+            shape.seed = static_cast<uint64_t>(seed);
+            workloads.emplace_back(WorkloadGenerator::generate(shape), "seed " + to_string(seed));
+        }
+    } else if (options.inputPath.empty()) {
+        workloads.emplace_back(createSampleWorkload(), "built-in sample");
+    } else {
+        workloads.emplace_back(WorkloadLoader::load(options.inputPath, options.inputFormat), options.inputPath);
+    }
+    bool deadlines = false;
+    for (const auto& workload : workloads) {
+        if (!workload.first) {
+            return 1;
+        }
+        deadlines = deadlines || workload.first->hasDeadlines();
+    }
+    
+    vector<string> algorithms = {options.algorithm};
+    if (options.algorithm == "all") {
+        algorithms = {"fcfs", "sjf", "srtf", "rr", "priority", "ppriority", "mlfq", "cfs"};
+        if (deadlines) {
+            algorithms.push_back("edf");
+            algorithms.push_back("rm");
+        }
+    }
+    
+    // Configurations: the swept quanta for the quantum-based policies
+    vector<pair<string, int>> configurations;
+    for (const auto& algorithm : algorithms) {
+        if (algorithm != "rr" && algorithm != "mlfq") {
+            configurations.emplace_back(algorithm, 0);
+        } else if (!options.sweep) {
+            configurations.emplace_back(algorithm, options.quantum);
+        } else {
+            for (int quantum = options.sweepFirst; quantum <= options.sweepLast; quantum += options.sweepStep) {
+                configurations.emplace_back(algorithm, quantum);
+            }
+        }
+    }
+    
+    SweepSettings settings;
+    settings.cpus = options.cpus;
+    settings.balancing = options.balancing;
+    settings.balanceInterval = options.balanceInterval;
+    settings.dispatchCosts = options.dispatchCosts;
+    settings.throughputWindow = options.throughputWindow;
+    settings.releaseHorizon = options.releaseHorizon;
+    settings.mlfqLevels = options.mlfqLevels;
+    settings.boostInterval = options.boostInterval;
+    settings.agingThreshold = options.agingThreshold;
+    settings.targetLatency = options.targetLatency;
+    settings.minGranularity = options.minGranularity;
+    
+    // Workload-major order, so that a shard shares one workload
+    SweepCoordinator coordinator(settings, options.objective);
+    for (const auto& workload : workloads) {
+        uint32_t index = coordinator.addWorkload(workload.first, workload.second);
+        for (const auto& configuration : configurations) {
+            CommandLineOptions labelled = options;
+            labelled.quantum = configuration.second > 0 ? configuration.second : options.quantum;
+            string label = getSchedulerLabel(configuration.first, *createScheduler(configuration.first, labelled),
+                                             labelled);
+            coordinator.addTask(configuration.first, configuration.second, index, label);
+        }
+    }
+    coordinator.setShardSize(static_cast<size_t>(options.shardSize));
+    coordinator.setRetries(static_cast<unsigned>(options.retries));
+    coordinator.setShardTimeout(options.shardTimeout);
+    coordinator.setProgress(progress);
+    if (!coordinator.listen(options.coordinatorPort)) {
+        return 1;
+    }
+    
+    // In-process workers share the cores of this machine
+    vector<thread> localWorkers;
+    size_t localThreads = options.threads;
+    if (options.localWorkers > 0 && localThreads == 0) {
+        localThreads = max<size_t>(1, thread::hardware_concurrency() / static_cast<size_t>(options.localWorkers));
+    }
+    for (int i = 0; i < options.localWorkers; ++i) {
+        localWorkers.emplace_back([&options, &coordinator, localThreads]() {
+            SweepWorker worker(createSweepFactory(options), localThreads);
+            worker.run("127.0.0.1", coordinator.getPort());
+        });
+    }
+    
+    auto sweepStart = chrono::steady_clock::now();
+    bool success = coordinator.run();
+    for (thread& worker : localWorkers) {
+        worker.join();
+    }
+    if (progress) {
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - sweepStart).count();
+        cerr << "Swept " << coordinator.getResults().size() << " runs in " << fixed << setprecision(3)
+             << seconds << " s" << endl;
+    }
+    
+    if (options.outputFormat == "csv") coordinator.printCsv(); else coordinator.printResults();
+    return success ? 0 : 1;
+}
+
+/**
+ * Run Batch
+ * Non-interactive run driven by the command line options
+ * 
+ * @param options - Parsed settings (receives the loaded process groups)
+ * @return Process exit code
+ */
+int runBatch(CommandLineOptions& options) {
+    // Constructor and per-event messages only at trace level; progress goes to cerr
+    // so that stdout carries nothing but the requested output
+    Scheduler::setDefaultVerbosity(options.verbosity >= Verbosity::TRACE ? Verbosity::TRACE : Verbosity::QUIET);
+    bool progress = options.verbosity >= Verbosity::NORMAL;
+    
+    // Offline results conversion
+    if (!options.convertInputPath.empty()) {
+        if (!ResultsReader::convertToCsv(options.convertInputPath, options.convertOutputPath)) {
+            return 1;
+        }
+        if (progress) {
+            cerr << "Wrote results to " << options.convertOutputPath << endl;
+        }
+        return 0;
+    }
+    
+    // Distributed parameter sweep
+    if (!options.workerHost.empty()) {
+        return runSweepWorker(options);
+    }
+    if (options.coordinatorPort >= 0) {
+        return runSweepCoordinator(options);
+    }
+    
+    // Generated processes are streamed into each run in constant memory, unless
+    // the workload itself is needed (saving, Gantt export, quantum sweeps, forks)
+    bool streamed = options.generate && options.saveBinaryPath.empty() &&
+                    options.exportTracePath.empty() && !options.sweep && options.forkAt < 0;
+    
+    // Load the workload
+    auto loadStart = chrono::steady_clock::now();
+    shared_ptr<Workload> workload;
+    if (streamed || options.live) {
+        workload = make_shared<Workload>();
+    } else if (options.generate) {
+        workload = WorkloadGenerator::generate(options.generator);
+    } else if (options.inputPath.empty()) {
+        workload = createSampleWorkload();
+    } else {
+        workload = WorkloadLoader::load(options.inputPath, options.inputFormat);
+    }
+    if (!workload) {
+        return 1;
+    }
+    if (progress && options.live) {
+        cerr << "Reading live submissions from stdin (" << liveClockToString(options.liveClock) << " clock";
+        if (options.liveClock == LiveClock::WALL) {
+            cerr << ", " << options.timeScale << " time units per second";
+        }
+        cerr << ")" << endl;
+    } else if (progress && streamed) {
+        cerr << "Streaming " << options.generator.count << " generated processes ("
+             << arrivalPatternToString(options.generator.arrivals) << " arrivals, "
+             << burstDistributionToString(options.generator.bursts) << " bursts, seed "
+             << options.generator.seed << ")" << endl;
+    } else if (progress) {
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - loadStart).count();
+        cerr << "Loaded " << workload->size() << " processes from "
+             << (options.generate ? "generator" : options.inputPath.empty() ? "built-in sample" : options.inputPath)
+             << " in " << fixed << setprecision(3) << seconds << " s" << endl;
+    }
+    
+    if (!options.saveBinaryPath.empty()) {
+        if (!WorkloadLoader::saveBinary(*workload, options.saveBinaryPath)) {
+            return 1;
+        }
+        if (progress) {
+            cerr << "Wrote binary workload to " << options.saveBinaryPath << endl;
+        }
+        return 0;
+    }
+    
+    // Offline Gantt chart export; the workload only supplies process names
+    if (!options.exportTracePath.empty()) {
+        if (!TraceExporter::exportFile(options.exportTracePath, options.exportOutputPath, workload.get())) {
+            return 1;
+        }
+        if (progress) {
+            cerr << "Wrote Gantt chart to " << options.exportOutputPath << endl;
+        }
+        return 0;
+    }
+    
+    if (!options.groupsPath.empty()) {
+        options.groups = GroupHierarchy::load(options.groupsPath);
+        if (!options.groups) {
+            return 1;
+        }
+        if (progress) {
+            cerr << "Loaded " << options.groups->getGroups().size() << " process groups from "
+                 << options.groupsPath << endl;
+        }
+    }
+    
+    bool csv = options.outputFormat == "csv";
+    
+    // Round Robin parameter search
+    if (options.sweep) {
+        QuantumSweep sweep(workload, options.objective, options.threads);
+        sweep.addQuantumRange(options.sweepFirst, options.sweepLast, options.sweepStep);
+        sweep.setMachine(options.cpus, options.balancing, options.balanceInterval);
+        sweep.setDispatchCosts(options.dispatchCosts);
+        sweep.run();
+        if (csv) sweep.printCsv(); else sweep.printResults();
+        return sweep.getBest() ? 0 : 1;
+    }
+    
+    vector<string> algorithms = {options.algorithm};
+    if (options.algorithm == "all") {
+        algorithms = {"fcfs", "sjf", "srtf", "rr", "priority", "ppriority", "mlfq", "cfs"};
+        if (workload->hasDeadlines()) {
+            algorithms.push_back("edf");
+            algorithms.push_back("rm");
+        }
+    }
+    
+    // Monte Carlo replications; every algorithm sees the same seeded streams
+    if (options.replications > 0) {
+        bool success = true;
+        for (size_t i = 0; i < algorithms.size(); ++i) {
+            const string& algorithm = algorithms[i];
+            ReplicationRunner replications([&options, &algorithm]() {
+                auto scheduler = createScheduler(algorithm, options);
+                configureMachine(*scheduler, options);
+                return scheduler;
+            }, options.generator, options.threads);
+            replications.setReplications(ReplicationRunner::DEFAULT_MIN_REPLICATIONS,
+                                         static_cast<size_t>(options.replications));
+            replications.setTargetWidth(options.ciWidth);
+            replications.setConfidence(options.confidence);
+            replications.setLabel(getSchedulerLabel(algorithm, *createScheduler(algorithm, options), options));
+            success = replications.run() && success;
+            if (progress) {
+                cerr << "Replicated " << algorithm << " " << replications.getReplicationCount() << " times"
+                     << (options.ciWidth > 0.0 ? (replications.hasConverged() ? " (target width reached)"
+                                                                             : " (target width not reached)") : "")
+                     << endl;
+            }
+            if (csv) replications.printCsv(i == 0); else replications.printResults();
+        }
+        return success ? 0 : 1;
+    }
+    
+    // Algorithm comparison
+    ComparisonRunner runner(workload, options.threads);
+    runner.setVerbosity(options.verbosity >= Verbosity::TRACE ? Verbosity::TRACE : Verbosity::QUIET);
+    
+    // What-if analysis: one common prefix, then every algorithm branches off its snapshot
+    if (options.forkAt >= 0) {
+        auto prefix = createScheduler(options.forkFrom, options);
+        prefix->setCpuCount(options.cpus);
+        prefix->setLoadBalancing(options.balancing, options.balanceInterval);
+        prefix->setDispatchCosts(options.dispatchCosts);
+        prefix->setThroughputWindow(options.throughputWindow);
+        prefix->setReleaseHorizon(options.releaseHorizon);
+        prefix->setWorkload(workload);
+        if (!prefix->runUntil(options.forkAt)) {
+            return 1;
+        }
+        auto snapshot = prefix->snapshot();
+        if (!snapshot) {
+            return 1;
+        }
+        if (progress) {
+            cerr << "Forked from " << snapshot->algorithm << " at time " << snapshot->time << " ("
+                 << snapshot->completedProcesses << " of " << workload->size() << " processes completed)" << endl;
+        }
+        runner.setSnapshot(snapshot);
+    }
+    unique_ptr<LiveArrivalSource> liveSource;
+    if (options.live) {
+        liveSource = make_unique<LiveArrivalSource>(options.liveClock, options.timeScale);
+    }
+    LiveArrivalSource* feed = liveSource.get();
+    shared_ptr<TraceRecorder> recorder;
+    if (!options.recordPath.empty()) {
+        recorder = make_shared<TraceRecorder>();
+        if (!recorder->open(options.recordPath)) {
+            return 1;
+        }
+    }
+    
+    shared_ptr<ResultsWriter> resultsWriter;
+    if (!options.resultsPath.empty()) {
+        resultsWriter = make_shared<ResultsWriter>();
+        if (!resultsWriter->open(options.resultsPath, ResultsWriter::formatFromPath(options.resultsPath),
+                                 options.compressResults)) {
+            return 1;
+        }
+    }
+    
+    for (const auto& algorithm : algorithms) {
+        auto scheduler = createScheduler(algorithm, options);
+        string label = getSchedulerLabel(algorithm, *scheduler, options);
+        scheduler->setTraceRecorder(recorder);
+        scheduler->setResultsWriter(resultsWriter);
+        configureMachine(*scheduler, options);
+        if (streamed) {
+            scheduler->setArrivalSource(make_unique<WorkloadGenerator>(options.generator), false);
+        } else if (liveSource) {
+            scheduler->setArrivalSource(std::move(liveSource), false);
+        }
+        runner.addScheduler(std::move(scheduler), label);
+    }
+    
+    // The live feed: stdin lines are submitted while the simulation runs; on the
+    // virtual clock each line also moves the clock to its arrival time
+    thread producer;
+    if (feed) {
+        producer = thread([feed, &options]() {
+            StreamArrivalSource input(cin);
+            ProcessSpec spec;
+            while (input.next(spec)) {
+                SimTime arrival = spec.arrivalTime;
+                feed->submit(std::move(spec));
+                if (options.liveClock == LiveClock::VIRTUAL) {
+                    feed->advanceClock(arrival);
+                }
+            }
+            feed->close();
+        });
+    }
+    
+    const auto& results = runner.run();
+    
+    if (producer.joinable()) {
+        producer.join();
+        if (progress) {
+            cerr << "Simulated " << feed->getReceivedCount() << " live submissions ("
+                 << feed->getLateCount() << " arrived after their time)" << endl;
+        }
+    }
+    
+    if (!options.profilePath.empty()) {
+        if (!isProfilingEnabled()) {
+            cerr << "Warning: Built without SCHEDULER_PROFILING, the profile counters are all zero" << endl;
+        }
+        if (!writeProfile(options.profilePath, runner)) {
+            return 1;
+        }
+        if (progress) {
+            cerr << "Wrote engine profile to " << options.profilePath << endl;
+        }
+    }
+    
+    if (resultsWriter) {
+        uint64_t rows = resultsWriter->getRecordCount();
+        if (!resultsWriter->close()) {
+            return 1;
+        }
+        if (progress) {
+            cerr << "Wrote results of " << rows << " processes to " << options.resultsPath << endl;
+        }
+    }
+    
+    if (recorder) {
+        uint64_t records = recorder->getRecordCount();
+        if (!recorder->close()) {
+            return 1;
+        }
+        if (progress) {
+            cerr << "Recorded " << records << " trace events to " << options.recordPath << endl;
+        }
+    }
+    
+    if (options.verbosity >= Verbosity::TRACE && !csv) {
+        for (size_t i = 0; i < runner.getSchedulerCount(); ++i) {
+            runner.getScheduler(i).printStatistics();
+        }
+    }
+    if (csv) runner.printCsv(); else runner.printComparison();
+    
+    // CPU shares and throttling of every group
+    if (!csv && options.groups) {
+        for (size_t i = 0; i < runner.getSchedulerCount(); ++i) {
+            cout << endl;
+            runner.getScheduler(i).printGroupStatistics();
+        }
+    }
+    
+    // Offline guarantees next to the simulated misses
+    if (!csv && workload->hasDeadlines()) {
+        SchedulabilityReport report = analyseSchedulability(*workload, options.cpus);
+        if (!report.tasks.empty()) {
+            printSchedulability(report, *workload);
+        }
+    }
+    
+    for (const auto& result : results) {
+        if (!result.success) return 1;
+    }
+    return 0;
+}
+
 // ========================================================================================
 // MAIN FUNCTION
 // ========================================================================================
@@ -85,15 +1259,27 @@ void demonstrateScheduling() {
  * Entry point of the program
  * Handles program execution and error management
  */
-int main() {
+int main(int argc, char* argv[]) {
     try {
-        // Run the scheduling demonstration
-        demonstrateScheduling();
+        CommandLineOptions options;
+        int status = parseCommandLine(argc, argv, options);
+        if (status != 0) {
+            if (status < 0) {
+                cerr << "Run '" << argv[0] << " --help' for usage." << endl;
+            }
+            return status < 0 ? 2 : 0;
+        }
+        
+        if (options.demo) {
+            // Run the scheduling demonstration
+            demonstrateScheduling();
+            return 0;
+        }
+        
+        return runBatch(options);
     } catch (const exception& e) {
         // Handle any unexpected errors
         cerr << "Error: " << e.what() << endl;
         return 1;
     }
-    
-    return 0;  // Successful program termination
 }
@@ -0,0 +1,176 @@
+/**
+ * GroupEquivalenceTest.cpp - Empty Group Hierarchy Regression Test
+ *
+ * Standalone test program for process groups. With a hierarchy that declares
+ * no groups every process sits in the root group, which has no quota, so a
+ * grouped run must reproduce the flat run exactly. The test simulates seeded
+ * synthetic workloads (some processes with deadlines, some periodic) under
+ * every Scheduler subclass, every load balancing strategy and 1, 2 and 4 CPUs,
+ * once without and once with the empty hierarchy, and compares the metrics
+ * and counters of the two runs. Mismatches are listed on stderr and make the
+ * exit code 1.
+ *
+ * Build and run (from the repository root):
+ *   g++ -std=c++17 -O2 -pthread -I include src/[A-Z]*.cpp tests/GroupEquivalenceTest.cpp -o group_equivalence_test
+ *   ./group_equivalence_test
+ *
+ */
+
+#include <iostream>     // For input/output operations
+#include <memory>       // For smart pointers
+#include <string>       // For string operations
+#include <vector>       // For dynamic arrays
+
+#include "CFSScheduler.h"
+#include "EDFScheduler.h"
+#include "FCFSScheduler.h"
+#include "GroupScheduling.h"
+#include "MLFQScheduler.h"
+#include "PriorityScheduler.h"
+#include "ProcessTable.h"
+#include "RateMonotonicScheduler.h"
+#include "RoundRobinScheduler.h"
+#include "SJFScheduler.h"
+#include "WorkloadGenerator.h"
+
+using namespace std;
+
+namespace {
+
+// ========================================================================================
+// CONFIGURATION
+// ========================================================================================
+
+const vector<string> ALGORITHMS = {"fcfs", "sjf", "srtf", "rr", "priority", "ppriority",
+                                   "mlfq", "cfs", "edf", "rm"};
+const vector<LoadBalancing> STRATEGIES = {LoadBalancing::GLOBAL_QUEUE, LoadBalancing::PERIODIC,
+                                          LoadBalancing::WORK_STEALING};
+const vector<int> CPU_COUNTS = {1, 2, 4};
+constexpr uint64_t SEEDS = 20;              // Workloads per configuration
+constexpr uint64_t PROCESSES = 300;         // Processes per workload
+
+unique_ptr<Scheduler> createScheduler(const string& algorithm) {
+    if (algorithm == "fcfs") return make_unique<FCFSScheduler>();
+    if (algorithm == "sjf") return make_unique<SJFScheduler>();
+    if (algorithm == "srtf") return make_unique<SJFScheduler>(true);
+    if (algorithm == "rr") return make_unique<RoundRobinScheduler>(3);
+    if (algorithm == "priority") return make_unique<PriorityScheduler>();
+    if (algorithm == "ppriority") return make_unique<PriorityScheduler>(true);
+    if (algorithm == "mlfq") return make_unique<MLFQScheduler>(3, 3);
+    if (algorithm == "cfs") return make_unique<CFSScheduler>();
+    if (algorithm == "edf") return make_unique<EDFScheduler>();
+    if (algorithm == "rm") return make_unique<RateMonotonicScheduler>();
+    return nullptr;
+}
+
+// ========================================================================================
+// WORKLOADS AND RUNS
+// ========================================================================================
+
+/**
+ * Generate Workload
+ * Poisson arrivals near full load; every third process gets a deadline and
+ * every eighth is periodic, so the real-time policies have work to order
+ *
+ * @param seed - Generator seed
+ * @return Generated workload
+ */
+shared_ptr<Workload> generateWorkload(uint64_t seed) {
+    WorkloadGeneratorOptions shape;
+    shape.seed = seed;
+    shape.count = PROCESSES;
+    shape.arrivalRate = 0.09;
+    auto workload = WorkloadGenerator::generate(shape);
+    for (ProcessHandle handle = 0; handle < workload->size(); ++handle) {
+        if (handle % 8 == 0) {
+            workload->setTiming(handle, 400, 0);
+        } else if (handle % 3 == 0) {
+            workload->setTiming(handle, 0, 4 * workload->burstTime[handle]);
+        }
+    }
+    return workload;
+}
+
+/**
+ * Run Summary
+ * Everything a run reports that an empty hierarchy must leave unchanged
+ */
+struct RunSummary {
+    double waiting = 0.0;
+    double turnaround = 0.0;
+    double response = 0.0;
+    SimTime makespan = 0;
+    long long switches = 0;
+    long long migrations = 0;
+    long long events = 0;
+
+    bool operator==(const RunSummary& other) const {
+        return waiting == other.waiting && turnaround == other.turnaround && response == other.response &&
+               makespan == other.makespan && switches == other.switches && migrations == other.migrations &&
+               events == other.events;
+    }
+};
+
+ostream& operator<<(ostream& out, const RunSummary& summary) {
+    return out << "waiting " << summary.waiting << ", turnaround " << summary.turnaround
+               << ", response " << summary.response << ", makespan " << summary.makespan
+               << ", switches " << summary.switches << ", migrations " << summary.migrations
+               << ", events " << summary.events;
+}
+
+RunSummary simulate(const string& algorithm, LoadBalancing strategy, int cpus,
+                    const shared_ptr<Workload>& workload, const shared_ptr<const GroupHierarchy>& groups) {
+    auto scheduler = createScheduler(algorithm);
+    scheduler->setCpuCount(cpus);
+    scheduler->setLoadBalancing(strategy);
+    if (groups) {
+        scheduler->setProcessGroups(groups);
+    }
+    scheduler->setWorkload(workload);
+    scheduler->schedule();
+
+    RunSummary summary;
+    summary.waiting = scheduler->getAverageWaitingTime();
+    summary.turnaround = scheduler->getAverageTurnaroundTime();
+    summary.response = scheduler->getAverageResponseTime();
+    summary.makespan = scheduler->getTotalExecutionTime();
+    summary.switches = scheduler->getContextSwitchCount();
+    summary.migrations = scheduler->getMigrationCount();
+    summary.events = scheduler->getEventCount();
+    return summary;
+}
+
+} // namespace
+
+// ========================================================================================
+// MAIN
+// ========================================================================================
+
+int main() {
+    Scheduler::setDefaultVerbosity(Verbosity::QUIET);
+    auto emptyHierarchy = make_shared<const GroupHierarchy>();
+    int runs = 0;
+    int failures = 0;
+
+    for (uint64_t seed = 1; seed <= SEEDS; ++seed) {
+        auto workload = generateWorkload(seed);
+        for (const string& algorithm : ALGORITHMS) {
+            for (LoadBalancing strategy : STRATEGIES) {
+                for (int cpus : CPU_COUNTS) {
+                    RunSummary flat = simulate(algorithm, strategy, cpus, workload, nullptr);
+                    RunSummary grouped = simulate(algorithm, strategy, cpus, workload, emptyHierarchy);
+                    runs++;
+                    if (!(flat == grouped)) {
+                        failures++;
+                        cerr << "FAIL " << algorithm << ", " << loadBalancingToString(strategy) << ", "
+                             << cpus << " CPUs, seed " << seed << "\n  flat:    " << flat
+                             << "\n  grouped: " << grouped << endl;
+                    }
+                }
+            }
+        }
+    }
+
+    cout << runs << " configurations, " << failures << " mismatches" << endl;
+    return failures > 0 ? 1 : 0;
+}